@@ -0,0 +1,1755 @@
+/**
+ * @file charconv.h
+ * @brief 整数和浮点数与十进制文本的相互转换
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "utility.h"
+
+/**
+ * @brief 整数转换为文本的支持
+ *
+ */
+namespace cppfastbox::detail
+{
+    // 与整数类型大小相同的无符号整数类型
+    template <typename type>
+    using charconv_unsigned_t = decltype(::cppfastbox::detail::get_fixed_size_integral<false, sizeof(type)>());
+
+    // 无符号整数的最大十进制位数
+    template <typename unsigned_type>
+    consteval inline ::std::size_t get_max_digits() noexcept
+    {
+        auto value{static_cast<unsigned_type>(-1)};
+        auto digits{0zu};
+        do {
+            value /= 10;
+            digits++;
+        }
+        while(value != 0);
+        return digits;
+    }
+
+    template <typename unsigned_type>
+    constexpr inline auto max_digits{::cppfastbox::detail::get_max_digits<unsigned_type>()};
+
+    // 10的幂表，下标为指数
+    template <typename unsigned_type>
+    struct power10_table
+    {
+        unsigned_type data[::cppfastbox::detail::max_digits<unsigned_type>];
+    };
+
+    template <typename unsigned_type>
+    consteval inline ::cppfastbox::detail::power10_table<unsigned_type> get_power10_table() noexcept
+    {
+        ::cppfastbox::detail::power10_table<unsigned_type> table{};
+        unsigned_type power{1};
+        for(auto& i : table.data)
+        {
+            i = power;
+            power *= 10;
+        }
+        return table;
+    }
+
+    template <typename unsigned_type>
+    constexpr inline auto power10{::cppfastbox::detail::get_power10_table<unsigned_type>()};
+
+    // 00到99的两位数字表
+    struct digit_pair_table
+    {
+        char data[200];
+    };
+
+    consteval inline ::cppfastbox::detail::digit_pair_table get_digit_pair_table() noexcept
+    {
+        ::cppfastbox::detail::digit_pair_table table{};
+        for(auto i{0zu}; i < 100; i++)
+        {
+            table.data[i * 2] = static_cast<char>('0' + i / 10);
+            table.data[i * 2 + 1] = static_cast<char>('0' + i % 10);
+        }
+        return table;
+    }
+
+    constexpr inline auto digit_pairs{::cppfastbox::detail::get_digit_pair_table()};
+
+    // 无符号整数的有效位数，value为0时为0
+    template <typename unsigned_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t charconv_bit_width(unsigned_type value) noexcept
+    {
+        if constexpr(sizeof(unsigned_type) <= sizeof(::std::uint64_t))
+        {
+            return static_cast<::std::size_t>(::std::bit_width(static_cast<::std::uint64_t>(value)));
+        }
+        else
+        {
+            auto high{static_cast<::std::uint64_t>(value >> 64)};
+            if(high != 0) { return 64 + static_cast<::std::size_t>(::std::bit_width(high)); }
+            return static_cast<::std::size_t>(::std::bit_width(static_cast<::std::uint64_t>(value)));
+        }
+    }
+
+    /**
+     * @brief 无符号整数的十进制位数
+     *
+     * @note 1233 / 4096近似于log10(2)，由有效位数估计的位数至多多1，再与10的幂比较修正；0视为1
+     */
+    template <typename unsigned_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t digit_count(unsigned_type value) noexcept
+    {
+        value |= 1;
+        auto estimate{::cppfastbox::detail::charconv_bit_width(value) * 1233 >> 12};
+        return estimate + 1 - (value < ::cppfastbox::detail::power10<unsigned_type>.data[estimate]);
+    }
+
+    // 将0到99写为两位数字
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline void write_digit_pair(char_type* dest, ::std::size_t value) noexcept
+    {
+        dest[0] = static_cast<char_type>(::cppfastbox::detail::digit_pairs.data[value * 2]);
+        dest[1] = static_cast<char_type>(::cppfastbox::detail::digit_pairs.data[value * 2 + 1]);
+    }
+
+    /**
+     * @brief 从end向前写入value的全部数字
+     *
+     * @tparam word_type 用于计算的整数类型，不超过32位的整数使用32位除法
+     */
+    template <typename word_type, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline void write_digits_backward(char_type* end, word_type value) noexcept
+    {
+        while(value >= 100)
+        {
+            end -= 2;
+            ::cppfastbox::detail::write_digit_pair(end, static_cast<::std::size_t>(value % 100));
+            value /= 100;
+        }
+        if(value >= 10) { ::cppfastbox::detail::write_digit_pair(end - 2, static_cast<::std::size_t>(value)); }
+        else { end[-1] = static_cast<char_type>('0' + value); }
+    }
+
+    /**
+     * @brief 将小于10^8的整数转换为8个数字字符
+     *
+     * @return 按内存顺序排列的8个字符
+     * @note 依次将每个通道拆分为高低两半：先拆为两个4位数，再以乘法和移位同时拆分所有通道，不需要除法的依赖链
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::uint64_t swar_eight_digits(::std::uint32_t value) noexcept
+    {
+        auto word{static_cast<::std::uint64_t>(value / 10000) | (static_cast<::std::uint64_t>(value % 10000) << 32)};
+        // 10486 / 2^20近似于1 / 100，对小于10^4的数精确
+        auto high{((word * 10486) >> 20) & 0x0000'007f'0000'007fu};
+        word = high | ((word - high * 100) << 16);
+        // 103 / 2^10近似于1 / 10，对小于100的数精确
+        high = ((word * 103) >> 10) & 0x000f'000f'000f'000fu;
+        word = high | ((word - high * 10) << 8);
+        word += 0x3030'3030'3030'3030u;
+        if constexpr(::cppfastbox::is_big_endian) { word = ::std::byteswap(word); }
+        return word;
+    }
+
+    // 从end向前写入value的低digits位数字，不足时以0填充
+    template <::std::size_t digits, typename word_type, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline void write_fixed_digits_backward(char_type* end, word_type value) noexcept
+    {
+        if constexpr(digits == 8 && sizeof(char_type) == 1)
+        {
+            if !consteval
+            {
+                auto word{::cppfastbox::detail::swar_eight_digits(static_cast<::std::uint32_t>(value % 100'000'000))};
+                __builtin_memcpy(end - 8, &word, 8);
+                return;
+            }
+        }
+        for(auto i{0zu}; i < digits / 2; i++)
+        {
+            end -= 2;
+            ::cppfastbox::detail::write_digit_pair(end, static_cast<::std::size_t>(value % 100));
+            value /= 100;
+        }
+        if constexpr(digits % 2 != 0) { end[-1] = static_cast<char_type>('0' + value); }
+    }
+
+    /**
+     * @brief 浮点数的格式
+     *
+     * @note float、double和float128分别为IEEE 754的binary32、binary64和binary128
+     */
+    template <typename float_type>
+    struct float_format
+    {
+        using bits_type = ::cppfastbox::detail::charconv_unsigned_t<float_type>;
+        // 有效位数，包括隐含位
+        constexpr static int precision{sizeof(float_type) == 4 ? 24 : (sizeof(float_type) == 8 ? 53 : 113)};
+        constexpr static int exponent_bits{sizeof(float_type) == 4 ? 8 : (sizeof(float_type) == 8 ? 11 : 15)};
+        constexpr static int bias{(1 << (exponent_bits - 1)) - 1};
+        // 规格化数的最小和最大指数
+        constexpr static int min_exponent{1 - bias};
+        constexpr static int max_exponent{bias};
+        // 最短表示的最大十进制位数
+        constexpr static ::std::size_t max_digits{sizeof(float_type) == 4 ? 9zu : (sizeof(float_type) == 8 ? 17zu : 36zu)};
+        // 十进制指数的最大位数
+        constexpr static ::std::size_t max_exponent_digits{sizeof(float_type) == 4 ? 2zu : (sizeof(float_type) == 8 ? 3zu : 4zu)};
+    };
+
+    /**
+     * @brief 转换为十进制文本后的最大字符数
+     *
+     * @note 有符号整数的最小值为负的max / 2 + 1；浮点数为负号、全部有效数字、小数点和指数
+     */
+    template <typename type>
+    consteval inline ::std::size_t get_to_chars_max_length() noexcept
+    {
+        if constexpr(::cppfastbox::floating_point<type>)
+        {
+            using format = ::cppfastbox::detail::float_format<type>;
+            return 1 + format::max_digits + 1 + 2 + format::max_exponent_digits;
+        }
+        else
+        {
+            using unsigned_type = ::cppfastbox::detail::charconv_unsigned_t<type>;
+            constexpr auto max{static_cast<unsigned_type>(-1)};
+            if constexpr(::cppfastbox::signed_integral<type>)
+            {
+                return 1 + ::cppfastbox::detail::digit_count(static_cast<unsigned_type>(max / 2 + 1));
+            }
+            else { return ::cppfastbox::detail::digit_count(max); }
+        }
+    }
+
+    /**
+     * @brief 从end向前写入无符号整数的全部数字
+     *
+     * @note 64位整数每次除以10^8，余数使用32位运算写入，缩短除法的依赖链；128位整数每次除以10^19，余数使用64位运算写入
+     */
+    template <typename unsigned_type, typename char_type>
+    constexpr inline void write_unsigned_backward(char_type* end, unsigned_type value) noexcept
+    {
+        if constexpr(sizeof(unsigned_type) <= sizeof(::std::uint32_t))
+        {
+            ::cppfastbox::detail::write_digits_backward<::std::uint32_t>(end, value);
+        }
+        else if constexpr(sizeof(unsigned_type) == sizeof(::std::uint64_t))
+        {
+            constexpr auto chunk{100'000'000u};
+            while(value >= chunk)
+            {
+                ::cppfastbox::detail::write_fixed_digits_backward<8>(end, static_cast<::std::uint32_t>(value % chunk));
+                value /= chunk;
+                end -= 8;
+            }
+            ::cppfastbox::detail::write_digits_backward<::std::uint32_t>(end, static_cast<::std::uint32_t>(value));
+        }
+        else
+        {
+            constexpr auto chunk_digits{19zu};
+            constexpr auto chunk{static_cast<unsigned_type>(::cppfastbox::detail::power10<::std::uint64_t>.data[chunk_digits])};
+            while(value > static_cast<::std::uint64_t>(-1))
+            {
+                ::cppfastbox::detail::write_fixed_digits_backward<chunk_digits>(end, static_cast<::std::uint64_t>(value % chunk));
+                value /= chunk;
+                end -= chunk_digits;
+            }
+            ::cppfastbox::detail::write_digits_backward<::std::uint64_t>(end, static_cast<::std::uint64_t>(value));
+        }
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    // 可以转换为十进制文本的整数，不包括bool
+    template <typename type>
+    concept to_chars_integral = ::cppfastbox::integral<type> && !::std::same_as<type, bool>;
+
+    // 可以与十进制文本相互转换的浮点数，float128需要原生128位整数
+    template <typename type>
+    concept charconv_floating_point = ::std::same_as<type, float> || ::std::same_as<type, double> ||
+                                      (::cppfastbox::is_native_float128<type> && ::cppfastbox::int128_support);
+
+    // 转换为十进制文本后的最大字符数，包括负号
+    template <typename type>
+        requires (::cppfastbox::to_chars_integral<type> || ::cppfastbox::charconv_floating_point<type>)
+    constexpr inline auto to_chars_max_length{::cppfastbox::detail::get_to_chars_max_length<type>()};
+
+    /**
+     * @brief 获取整数转换为十进制文本后的字符数
+     *
+     * @param value 要转换的整数
+     * @return 字符数，包括负号
+     */
+    template <::cppfastbox::to_chars_integral type>
+    [[nodiscard]] constexpr inline ::std::size_t to_chars_length(type value) noexcept
+    {
+        using unsigned_type = ::cppfastbox::detail::charconv_unsigned_t<type>;
+        auto magnitude{static_cast<unsigned_type>(value)};
+        if constexpr(::cppfastbox::signed_integral<type>)
+        {
+            if(value < 0) { return 1 + ::cppfastbox::detail::digit_count(static_cast<unsigned_type>(0 - magnitude)); }
+        }
+        return ::cppfastbox::detail::digit_count(magnitude);
+    }
+
+    /**
+     * @brief 将整数转换为十进制文本
+     *
+     * @param dest 输出，至少需要容纳to_chars_length(value)个字符
+     * @param value 要转换的整数
+     * @return 输出的结尾，不写入结束符
+     * @note 先计算位数，再从结尾向前每次写入两位数字
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::to_chars_integral type>
+    constexpr inline char_type* to_chars(char_type* dest, type value) noexcept
+    {
+        using unsigned_type = ::cppfastbox::detail::charconv_unsigned_t<type>;
+        auto magnitude{static_cast<unsigned_type>(value)};
+        if constexpr(::cppfastbox::signed_integral<type>)
+        {
+            if(value < 0)
+            {
+                *dest++ = static_cast<char_type>('-');
+                magnitude = static_cast<unsigned_type>(0 - magnitude);
+            }
+        }
+        auto* end{dest + ::cppfastbox::detail::digit_count(magnitude)};
+        ::cppfastbox::detail::write_unsigned_backward(end, magnitude);
+        return end;
+    }
+
+    /**
+     * @brief 将整数转换为十进制文本
+     *
+     * @param first 输出的起始
+     * @param last 输出的结尾
+     * @param value 要转换的整数
+     * @return 输出的结尾，不写入结束符；[first, last)不足以容纳时返回nullptr且不写入
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::to_chars_integral type>
+    constexpr inline char_type* to_chars(char_type* first, char_type* last, type value) noexcept
+    {
+        auto capacity{static_cast<::std::size_t>(last - first)};
+        if(capacity < ::cppfastbox::to_chars_max_length<type> && capacity < ::cppfastbox::to_chars_length(value)) { return nullptr; }
+        return ::cppfastbox::to_chars(first, value);
+    }
+}  // namespace cppfastbox
+
+/**
+ * @brief 文本转换为整数的支持
+ *
+ */
+namespace cppfastbox::detail
+{
+    // 是否可以使用ssse3每次解析16位数字
+    constexpr inline auto support_from_chars_simd{::cppfastbox::cpu_flags::x86::ssse3_support};
+
+    // 字符对应的数字，不是数字时不小于10
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::uint32_t digit_value(char_type ch) noexcept
+    {
+        return static_cast<::std::uint32_t>(static_cast<::std::make_unsigned_t<char_type>>(ch)) - '0';
+    }
+
+    /**
+     * @brief 8个字符中从第一个字符开始的连续数字的个数
+     *
+     * @param word 以小端序读取的8个字符
+     * @note 数字加0x46和减0x30均不会进位或借位，因此第一个非数字字节总是被标记
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t swar_digit_count(::std::uint64_t word) noexcept
+    {
+        auto non_digit{(word | (word + 0x4646'4646'4646'4646u) | (word - 0x3030'3030'3030'3030u)) & 0x8080'8080'8080'8080u};
+        return static_cast<::std::size_t>(::std::countr_zero(non_digit)) / 8;
+    }
+
+    /**
+     * @brief 解析8位数字
+     *
+     * @param word 以小端序读取的8个数字减去'0'后的值
+     * @note 依次将相邻的1位、2位和4位数字合并
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::uint64_t swar_parse_eight_digits(::std::uint64_t word) noexcept
+    {
+        word = word * 10 + (word >> 8);
+        constexpr auto mask{0x0000'00ff'0000'00ffu};
+        constexpr auto high_multiplier{100 + (::std::uint64_t{1'000'000} << 32)};
+        constexpr auto low_multiplier{1 + (::std::uint64_t{10'000} << 32)};
+        return ((word & mask) * high_multiplier + ((word >> 16) & mask) * low_multiplier) >> 32;
+    }
+
+    // 解析数字时使用的向量类型
+    template <::std::size_t vector_size, typename element_type>
+    using charconv_vector_t [[__gnu__::__vector_size__(vector_size)]] = element_type;
+
+    /**
+     * @brief 以ssse3解析16位数字
+     *
+     * @param value 16个字符均为数字时写入解析结果
+     * @return 16个字符是否均为数字
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline bool simd_parse_sixteen_digits(const char_type* ptr, ::std::uint64_t& value) noexcept
+    {
+        // 内建函数要求的向量类型
+        using vi8 = ::cppfastbox::detail::charconv_vector_t<vector_size, char>;
+        using vu8 = ::cppfastbox::detail::charconv_vector_t<vector_size, unsigned char>;
+        using vi16 = ::cppfastbox::detail::charconv_vector_t<vector_size, short>;
+        using vi32 = ::cppfastbox::detail::charconv_vector_t<vector_size, int>;
+        vu8 digits;
+        __builtin_memcpy(&digits, ptr, vector_size);
+        digits -= '0';
+        if(__builtin_ia32_pmovmskb128(::std::bit_cast<vi8>(digits > 9)) != 0) { return false; }  //< sse2
+        // 相邻的数字依次合并为2位、4位和8位
+        constexpr vi8 pair_weight{10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1};
+        constexpr vi16 quad_weight{100, 1, 100, 1, 100, 1, 100, 1};
+        constexpr vi16 octet_weight{10000, 1, 10000, 1, 10000, 1, 10000, 1};
+        auto pairs{__builtin_ia32_pmaddubsw128(::std::bit_cast<vi8>(digits), pair_weight)};           //< ssse3
+        auto quads{__builtin_ia32_pmaddwd128(pairs, quad_weight)};                                   //< sse2
+        auto packed{__builtin_ia32_packssdw128(quads, quads)};                                       //< sse2
+        auto octets{::std::bit_cast<vi32>(__builtin_ia32_pmaddwd128(packed, octet_weight))};         //< sse2
+        value = static_cast<::std::uint64_t>(octets[0]) * 100'000'000 + static_cast<::std::uint64_t>(octets[1]);
+        return true;
+    }
+
+    /**
+     * @brief 解析连续的数字并追加到value之后，最多解析max_count位
+     *
+     * @return 解析结束的位置
+     * @note 单字节字符每次以ssse3解析16位或以swar解析至多8位，不会读取last之后的字符
+     */
+    template <typename word_type, typename char_type>
+    constexpr inline const char_type*
+        parse_digits(const char_type* first, const char_type* last, word_type& value, ::std::size_t max_count) noexcept
+    {
+        if !consteval
+        {
+            if constexpr(sizeof(char_type) == 1)
+            {
+                if constexpr(::cppfastbox::detail::support_from_chars_simd)
+                {
+                    ::std::uint64_t digits;
+                    while(max_count >= 16 && last - first >= 16 && ::cppfastbox::detail::simd_parse_sixteen_digits<16>(first, digits))
+                    {
+                        value = value * 10'000'000'000'000'000u + digits;
+                        first += 16;
+                        max_count -= 16;
+                    }
+                }
+                while(max_count != 0 && last - first >= 8)
+                {
+                    ::std::uint64_t word;
+                    __builtin_memcpy(&word, first, 8);
+                    if constexpr(::cppfastbox::is_big_endian) { word = ::std::byteswap(word); }
+                    auto count{::cppfastbox::detail::swar_digit_count(word)};
+                    if(count > max_count) { count = max_count; }
+                    if(count == 0) { return first; }
+                    // 丢弃数字之后的字节，剩余的数字移至高位，低位补0
+                    word = (word - 0x3030'3030'3030'3030u) << (64 - count * 8);
+                    value = value * ::cppfastbox::detail::power10<::std::uint64_t>.data[count] +
+                            ::cppfastbox::detail::swar_parse_eight_digits(word);
+                    first += count;
+                    max_count -= count;
+                    if(count != 8) { return first; }
+                }
+            }
+        }
+        for(; max_count != 0 && first != last; first++, max_count--)
+        {
+            auto digit{::cppfastbox::detail::digit_value(*first)};
+            if(digit >= 10) { break; }
+            value = value * 10 + digit;
+        }
+        return first;
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    // 文本转换为数值时的错误
+    enum class from_chars_error : ::std::size_t
+    {
+        ok,
+        invalid,   //< 开头不是数字
+        overflow,  //< 超出类型的范围
+    };
+
+    /**
+     * @brief 文本转换为数值的结果
+     *
+     */
+    template <::cppfastbox::character char_type>
+    struct from_chars_result
+    {
+        // 解析结束的位置，开头不是数字时为first
+        const char_type* ptr;
+        ::cppfastbox::from_chars_error error;
+
+        // 是否转换成功
+        explicit constexpr inline operator bool() const noexcept { return error == ::cppfastbox::from_chars_error::ok; }
+    };
+
+    /**
+     * @brief 将十进制文本转换为整数
+     *
+     * @param first 文本的起始
+     * @param last 文本的结尾
+     * @param value 转换成功时写入结果，失败时不修改
+     * @return 解析结束的位置和错误
+     * @note 与std::from_chars相同，有符号整数可以以'-'开头，不接受'+'和空白；超出范围时ptr指向全部数字之后
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::fixed_size_integral type>
+    constexpr inline ::cppfastbox::from_chars_result<char_type> from_chars(const char_type* first, const char_type* last, type& value) noexcept
+    {
+        using unsigned_type = ::cppfastbox::detail::charconv_unsigned_t<type>;
+        // 不超过64位的整数以64位解析，再检查范围
+        using word_type = ::std::conditional_t<(sizeof(type) > sizeof(::std::uint64_t)), unsigned_type, ::std::uint64_t>;
+        auto* ptr{first};
+        auto negative{false};
+        if constexpr(::cppfastbox::signed_integral<type>)
+        {
+            if(ptr != last && *ptr == static_cast<char_type>('-'))
+            {
+                negative = true;
+                ptr++;
+            }
+        }
+        auto* digits_begin{ptr};
+        while(ptr != last && *ptr == static_cast<char_type>('0')) { ptr++; }
+        // 前导0之后的max_digits - 1位数字不会使word_type溢出
+        word_type result{};
+        ptr = ::cppfastbox::detail::parse_digits(ptr, last, result, ::cppfastbox::detail::max_digits<word_type> - 1);
+        if(ptr == digits_begin) { return {first, ::cppfastbox::from_chars_error::invalid}; }
+        auto overflow{false};
+        if(ptr != last && ::cppfastbox::detail::digit_value(*ptr) < 10)
+        {
+            overflow = __builtin_mul_overflow(result, word_type{10}, &result) ||
+                       __builtin_add_overflow(result, word_type{::cppfastbox::detail::digit_value(*ptr)}, &result);
+            ptr++;
+            for(; ptr != last && ::cppfastbox::detail::digit_value(*ptr) < 10; ptr++) { overflow = true; }
+        }
+        // 负数的绝对值可以比正数的最大值大1
+        constexpr auto max{static_cast<word_type>(static_cast<unsigned_type>(-1) >> (::cppfastbox::signed_integral<type> ? 1 : 0))};
+        if(overflow || result > max + negative) { return {ptr, ::cppfastbox::from_chars_error::overflow}; }
+        auto magnitude{static_cast<unsigned_type>(result)};
+        value = static_cast<type>(negative ? static_cast<unsigned_type>(0 - magnitude) : magnitude);
+        return {ptr, ::cppfastbox::from_chars_error::ok};
+    }
+}  // namespace cppfastbox
+
+/**
+ * @brief 浮点数与文本相互转换的公共支持
+ *
+ */
+namespace cppfastbox::detail
+{
+    // 128位无符号整数的高64位和低64位
+    struct float_uint128
+    {
+        ::std::uint64_t high;
+        ::std::uint64_t low;
+    };
+
+    // 两个64位整数的128位乘积
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::cppfastbox::detail::float_uint128 multiply_64(::std::uint64_t a, ::std::uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        auto product{static_cast<::cppfastbox::native_uint128_t>(a) * b};
+        return {static_cast<::std::uint64_t>(product >> 64), static_cast<::std::uint64_t>(product)};
+#else
+        auto a_low{a & 0xffff'ffffu};
+        auto a_high{a >> 32};
+        auto b_low{b & 0xffff'ffffu};
+        auto b_high{b >> 32};
+        auto low_low{a_low * b_low};
+        auto low_high{a_low * b_high};
+        auto high_low{a_high * b_low};
+        auto middle{(low_low >> 32) + (low_high & 0xffff'ffffu) + (high_low & 0xffff'ffffu)};
+        return {a_high * b_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32), (middle << 32) | (low_low & 0xffff'ffffu)};
+#endif
+    }
+
+    /**
+     * @brief floor(exponent * log10(2))
+     *
+     * @note 1292913986 / 2^32近似于log10(2)，在float128的指数范围内结果精确
+     */
+    constexpr inline int floor_log10_pow2(::std::int64_t exponent) noexcept
+    {
+        return static_cast<int>((exponent * 1292913986) >> 32);
+    }
+
+    /**
+     * @brief 用于精确转换的无符号大整数
+     *
+     * @tparam capacity 最多容纳的32位字数
+     * @note 以小端序保存，size之后的字总是为0；只用于编译期生成表和极少进入的精确路径
+     */
+    template <::std::size_t capacity>
+    struct float_bigint
+    {
+        ::std::uint32_t data[capacity]{};
+        ::std::size_t size{};
+
+        constexpr inline void trim() noexcept
+        {
+            while(size != 0 && data[size - 1] == 0) { size--; }
+        }
+
+        constexpr inline void clear() noexcept
+        {
+            for(auto i{0zu}; i < size; i++) { data[i] = 0; }
+            size = 0;
+        }
+
+        template <typename unsigned_type>
+        constexpr inline void assign(unsigned_type value) noexcept
+        {
+            clear();
+            for(; size * 32 < sizeof(unsigned_type) * 8; size++) { data[size] = static_cast<::std::uint32_t>(value >> (size * 32)); }
+            trim();
+        }
+
+        // 复制other，只复制有效的字
+        constexpr inline void assign(const float_bigint& other) noexcept
+        {
+            for(auto i{0zu}; i < other.size; i++) { data[i] = other.data[i]; }
+            for(auto i{other.size}; i < size; i++) { data[i] = 0; }
+            size = other.size;
+        }
+
+        constexpr inline void assign_power2(::std::size_t exponent) noexcept
+        {
+            clear();
+            data[exponent / 32] = ::std::uint32_t{1} << exponent % 32;
+            size = exponent / 32 + 1;
+        }
+
+        constexpr inline ::std::size_t bit_width() const noexcept
+        {
+            return size == 0 ? 0 : (size - 1) * 32 + static_cast<::std::size_t>(::std::bit_width(data[size - 1]));
+        }
+
+        // 从第position位开始的64位，position可以为负，不存在的位视为0
+        constexpr inline ::std::uint64_t bits64(::std::ptrdiff_t position) const noexcept
+        {
+            ::std::uint64_t result{};
+            for(auto i{0}; i < 64; i++)
+            {
+                auto bit{position + i};
+                if(bit >= 0 && bit < static_cast<::std::ptrdiff_t>(size * 32) && (data[bit / 32] >> bit % 32 & 1) != 0)
+                {
+                    result |= ::std::uint64_t{1} << i;
+                }
+            }
+            return result;
+        }
+
+        // 低position位中是否有非0位
+        constexpr inline bool any_bits_below(::std::size_t position) const noexcept
+        {
+            for(auto i{0zu}; i < position / 32 && i < size; i++)
+            {
+                if(data[i] != 0) { return true; }
+            }
+            return position / 32 < size && (data[position / 32] & ((::std::uint32_t{1} << position % 32) - 1)) != 0;
+        }
+
+        constexpr inline int compare(const float_bigint& other) const noexcept
+        {
+            if(size != other.size) { return size < other.size ? -1 : 1; }
+            for(auto i{size}; i-- != 0;)
+            {
+                if(data[i] != other.data[i]) { return data[i] < other.data[i] ? -1 : 1; }
+            }
+            return 0;
+        }
+
+        constexpr inline void add(::std::uint32_t addend) noexcept
+        {
+            ::std::uint64_t carry{addend};
+            for(auto i{0zu}; carry != 0; i++)
+            {
+                auto sum{data[i] + carry};
+                data[i] = static_cast<::std::uint32_t>(sum);
+                carry = sum >> 32;
+                if(i == size) { size++; }
+            }
+        }
+
+        constexpr inline void add(const float_bigint& other) noexcept
+        {
+            auto count{size > other.size ? size : other.size};
+            ::std::uint64_t carry{};
+            for(auto i{0zu}; i < count; i++)
+            {
+                auto sum{data[i] + carry + other.data[i]};
+                data[i] = static_cast<::std::uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            if(carry != 0) { data[count++] = static_cast<::std::uint32_t>(carry); }
+            size = count;
+        }
+
+        // 减去不大于自身的other
+        constexpr inline void subtract(const float_bigint& other) noexcept
+        {
+            ::std::uint64_t borrow{};
+            for(auto i{0zu}; i < size; i++)
+            {
+                auto difference{data[i] - borrow - other.data[i]};
+                data[i] = static_cast<::std::uint32_t>(difference);
+                borrow = difference >> 63;
+            }
+            trim();
+        }
+
+        constexpr inline void multiply(::std::uint32_t multiplier) noexcept
+        {
+            ::std::uint64_t carry{};
+            for(auto i{0zu}; i < size; i++)
+            {
+                auto product{static_cast<::std::uint64_t>(data[i]) * multiplier + carry};
+                data[i] = static_cast<::std::uint32_t>(product);
+                carry = product >> 32;
+            }
+            if(carry != 0) { data[size++] = static_cast<::std::uint32_t>(carry); }
+        }
+
+        constexpr inline void multiply_power10(::std::size_t exponent) noexcept
+        {
+            for(; exponent >= 9; exponent -= 9) { multiply(1'000'000'000); }
+            if(exponent != 0) { multiply(::cppfastbox::detail::power10<::std::uint32_t>.data[exponent]); }
+        }
+
+        // 除以divisor并返回余数
+        constexpr inline ::std::uint32_t divide(::std::uint32_t divisor) noexcept
+        {
+            ::std::uint64_t remainder{};
+            for(auto i{size}; i-- != 0;)
+            {
+                auto current{(remainder << 32) | data[i]};
+                data[i] = static_cast<::std::uint32_t>(current / divisor);
+                remainder = current % divisor;
+            }
+            trim();
+            return static_cast<::std::uint32_t>(remainder);
+        }
+
+        constexpr inline void shift_left(::std::size_t count) noexcept
+        {
+            if(size == 0) { return; }
+            auto words{count / 32};
+            auto bits{count % 32};
+            if(bits != 0)
+            {
+                data[size + words] = data[size - 1] >> (32 - bits);
+                for(auto i{size - 1}; i != 0; i--) { data[i + words] = (data[i] << bits) | (data[i - 1] >> (32 - bits)); }
+                data[words] = data[0] << bits;
+                size += words + 1;
+            }
+            else
+            {
+                for(auto i{size}; i-- != 0;) { data[i + words] = data[i]; }
+                size += words;
+            }
+            for(auto i{0zu}; i < words; i++) { data[i] = 0; }
+            trim();
+        }
+
+        constexpr inline void shift_right(::std::size_t count) noexcept
+        {
+            auto words{count / 32};
+            auto bits{count % 32};
+            if(words >= size)
+            {
+                clear();
+                return;
+            }
+            auto new_size{size - words};
+            for(auto i{0zu}; i < new_size; i++)
+            {
+                auto high{bits != 0 && i + words + 1 < size ? data[i + words + 1] << (32 - bits) : 0u};
+                data[i] = (data[i + words] >> bits) | high;
+            }
+            for(auto i{new_size}; i < size; i++) { data[i] = 0; }
+            size = new_size;
+            trim();
+        }
+    };
+
+    // 大整数从第position位开始的128位
+    template <::std::size_t capacity>
+    consteval inline ::cppfastbox::detail::float_uint128 bigint_bits128(const ::cppfastbox::detail::float_bigint<capacity>& value,
+                                                                        ::std::ptrdiff_t position) noexcept
+    {
+        return {value.bits64(position + 64), value.bits64(position)};
+    }
+
+    consteval inline void increment(::cppfastbox::detail::float_uint128& value) noexcept
+    {
+        value.low++;
+        if(value.low == 0) { value.high++; }
+    }
+
+    // 5的幂表，下标为指数减去min_exponent
+    template <int min_exponent, int max_exponent>
+    struct power5_table
+    {
+        ::cppfastbox::detail::float_uint128 data[max_exponent - min_exponent + 1];
+    };
+
+    /**
+     * @brief 生成以128位表示的5^q，最高位总是为1
+     *
+     * @tparam eisel_lemire 为true时与fast_float的表相同，否则为Schubfach算法使用的表
+     * @note q >= 0时为5^q的最高128位，Schubfach算法再加1；q < 0时为floor(2^(127 + bit_width(5^-q)) / 5^-q) + 1，
+     *       Eisel-Lemire算法在q < -27时改为取floor(2^(2 * bit_width(5^-q) + 128) / 5^-q) + 1的最高128位。
+     *       先精确计算floor(2^1760 / 5^-q)，再截取所需的位
+     */
+    template <int min_exponent, int max_exponent, bool eisel_lemire>
+    consteval inline ::cppfastbox::detail::power5_table<min_exponent, max_exponent> get_power5_table() noexcept
+    {
+        using bigint = ::cppfastbox::detail::float_bigint<64>;
+        constexpr ::std::ptrdiff_t scale{1760};
+        ::cppfastbox::detail::power5_table<min_exponent, max_exponent> table{};
+        bigint power{};
+        power.assign(1u);
+        for(auto q{0}; q <= max_exponent; q++)
+        {
+            if(q >= min_exponent)
+            {
+                auto entry{::cppfastbox::detail::bigint_bits128(power, static_cast<::std::ptrdiff_t>(power.bit_width()) - 128)};
+                if constexpr(!eisel_lemire) { ::cppfastbox::detail::increment(entry); }
+                table.data[q - min_exponent] = entry;
+            }
+            power.multiply(5);
+        }
+        bigint quotient{};
+        quotient.assign_power2(scale);
+        power.assign(1u);
+        for(auto m{1}; -m >= min_exponent; m++)
+        {
+            quotient.divide(5);
+            power.multiply(5);
+            auto width{static_cast<::std::ptrdiff_t>(power.bit_width())};
+            ::cppfastbox::detail::float_uint128 entry;
+            if(eisel_lemire && m > 27)
+            {
+                bigint truncated{};
+                truncated.assign(quotient);
+                truncated.shift_right(static_cast<::std::size_t>(scale - 2 * width - 128));
+                truncated.add(1u);
+                entry = ::cppfastbox::detail::bigint_bits128(truncated, static_cast<::std::ptrdiff_t>(truncated.bit_width()) - 128);
+            }
+            else
+            {
+                entry = ::cppfastbox::detail::bigint_bits128(quotient, scale - 127 - width);
+                ::cppfastbox::detail::increment(entry);
+            }
+            if(-m <= max_exponent) { table.data[-m - min_exponent] = entry; }
+        }
+        return table;
+    }
+}  // namespace cppfastbox::detail
+
+/**
+ * @brief 浮点数转换为文本的支持
+ *
+ */
+namespace cppfastbox::detail
+{
+    // 十进制的有效数字和指数，值为significand * 10^exponent
+    template <typename float_type>
+    struct float_decimal
+    {
+        using significand_type =
+            ::std::conditional_t<sizeof(float_type) == 16, typename ::cppfastbox::detail::float_format<float_type>::bits_type, ::std::uint64_t>;
+        significand_type significand;
+        int exponent;
+    };
+
+    // float使用的64位表
+    struct schubfach_table_32
+    {
+        ::std::uint64_t data[77];
+    };
+
+    /**
+     * @brief Schubfach算法使用的10^-k的近似值，下标为-k减去最小值
+     *
+     * @note double的-k位于[-292, 326]，float的-k位于[-31, 45]且只需要64位
+     */
+    template <typename float_type>
+    consteval inline auto get_schubfach_table() noexcept
+    {
+        if constexpr(sizeof(float_type) == 4)
+        {
+            auto wide{::cppfastbox::detail::get_power5_table<-31, 45, false>()};
+            ::cppfastbox::detail::schubfach_table_32 table{};
+            for(auto i{0zu}; i < 77; i++)
+            {
+                auto& entry{wide.data[i]};
+                table.data[i] = (entry.low == 0 ? entry.high - 1 : entry.high) + 1;
+            }
+            return table;
+        }
+        else { return ::cppfastbox::detail::get_power5_table<-292, 326, false>(); }
+    }
+
+    template <typename float_type>
+    constexpr inline auto schubfach_table{::cppfastbox::detail::get_schubfach_table<float_type>()};
+
+    /**
+     * @brief 计算g * cp / 2^(2 * bits)并向奇数舍入
+     *
+     * @note bits为cp的位数，有余数时结果的最低位置1
+     */
+    template <typename float_type, typename table_entry, typename word_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline word_type schubfach_round_to_odd(const table_entry& g, word_type cp) noexcept
+    {
+        if constexpr(sizeof(float_type) == 4)
+        {
+            auto low{static_cast<::std::uint64_t>(static_cast<::std::uint32_t>(g)) * cp};
+            auto middle{(g >> 32) * cp + (low >> 32)};
+            auto y1{static_cast<::std::uint32_t>(middle >> 32)};
+            auto y0{static_cast<::std::uint32_t>(middle)};
+            return y1 | (y0 > 1);
+        }
+        else
+        {
+            auto x{::cppfastbox::detail::multiply_64(g.low, cp)};
+            auto y{::cppfastbox::detail::multiply_64(g.high, cp)};
+            auto y0{y.low + x.high};
+            auto y1{y.high + (y0 < y.low)};
+            return y1 | (y0 > 1);
+        }
+    }
+
+    /**
+     * @brief 以Schubfach算法计算float和double的最短十进制表示
+     *
+     * @param significand 不含隐含位的有效数字
+     * @param biased_exponent 偏移后的指数，不为全1
+     * @note 与Raffaello Giulietti的算法和Alexander Bolz的实现相同，结果的末尾可能有0；值不为0
+     */
+    template <typename float_type, typename bits_type>
+    constexpr inline ::cppfastbox::detail::float_decimal<float_type> schubfach_to_decimal(bits_type significand, int biased_exponent) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr int exponent_bias{format::bias + explicit_bits};
+        constexpr int min_k{sizeof(float_type) == 4 ? -31 : -292};
+        bits_type c;
+        int q;
+        if(biased_exponent != 0)
+        {
+            c = (bits_type{1} << explicit_bits) | significand;
+            q = biased_exponent - exponent_bias;
+            // 小整数直接得到结果
+            if(0 <= -q && -q < format::precision && (c & ((bits_type{1} << -q) - 1)) == 0) { return {c >> -q, 0}; }
+        }
+        else
+        {
+            c = significand;
+            q = 1 - exponent_bias;
+        }
+        auto even{c % 2 == 0};
+        // 有效数字为2的幂时与下一个较小的浮点数的距离只有一半
+        auto closer{significand == 0 && biased_exponent > 1};
+        bits_type cbl{4 * c - 2 + closer};
+        bits_type cb{4 * c};
+        bits_type cbr{4 * c + 2};
+        // k = floor(log10(3 / 4 * 2^q))或floor(log10(2^q))，h = q + floor(log2(10^-k)) + 1
+        auto k{(q * 1262611 - (closer ? 524031 : 0)) >> 22};
+        auto h{q + ((-k * 1741647) >> 19) + 1};
+        auto& g{::cppfastbox::detail::schubfach_table<float_type>.data[-k - min_k]};
+        auto vbl{::cppfastbox::detail::schubfach_round_to_odd<float_type>(g, static_cast<bits_type>(cbl << h))};
+        auto vb{::cppfastbox::detail::schubfach_round_to_odd<float_type>(g, static_cast<bits_type>(cb << h))};
+        auto vbr{::cppfastbox::detail::schubfach_round_to_odd<float_type>(g, static_cast<bits_type>(cbr << h))};
+        bits_type lower{vbl + !even};
+        bits_type upper{vbr - !even};
+        bits_type s{vb / 4};
+        if(s >= 10)
+        {
+            // 先尝试少一位的结果
+            bits_type sp{s / 10};
+            auto up_inside{lower <= 40 * sp};
+            auto wp_inside{40 * sp + 40 <= upper};
+            if(up_inside != wp_inside) { return {sp + wp_inside, k + 1}; }
+        }
+        auto u_inside{lower <= 4 * s};
+        auto w_inside{4 * s + 4 <= upper};
+        if(u_inside != w_inside) { return {s + w_inside, k}; }
+        // 两者都在区间内时选择较近者，距离相同时选择偶数
+        bits_type mid{4 * s + 2};
+        auto round_up{vb > mid || (vb == mid && (s & 1) != 0)};
+        return {s + round_up, k};
+    }
+
+    /**
+     * @brief 以大整数精确计算最短十进制表示
+     *
+     * @param significand 不含隐含位的有效数字
+     * @param biased_exponent 偏移后的指数，不为全1
+     * @note Burger和Dybvig的自由格式算法，区间端点的接受规则和最后一位的舍入与Schubfach算法相同；值不为0。
+     *       用于float128，所需的大整数约为指数范围的位数
+     */
+    template <typename float_type, typename bits_type>
+    constexpr inline ::cppfastbox::detail::float_decimal<float_type> exact_to_decimal(bits_type significand, int biased_exponent) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bigint = ::cppfastbox::detail::float_bigint<(format::bias + 2 * format::precision + 64) / 32>;
+        constexpr int explicit_bits{format::precision - 1};
+        bits_type f;
+        int e;
+        if(biased_exponent != 0)
+        {
+            f = (bits_type{1} << explicit_bits) | significand;
+            e = biased_exponent - format::bias - explicit_bits;
+        }
+        else
+        {
+            f = significand;
+            e = 1 - format::bias - explicit_bits;
+        }
+        auto even{f % 2 == 0};
+        auto closer{significand == 0 && biased_exponent > 1};
+        // value = r / s，上下界与value的距离为m_plus / s和m_minus / s
+        auto positive_exponent{static_cast<::std::size_t>(e >= 0 ? e : 0)};
+        auto negative_exponent{static_cast<::std::size_t>(e >= 0 ? 0 : -e)};
+        bigint r{};
+        bigint s{};
+        bigint m_plus{};
+        bigint m_minus{};
+        bigint high{};
+        r.assign(f);
+        r.shift_left(positive_exponent + 1 + closer);
+        s.assign_power2(negative_exponent + 1 + closer);
+        m_plus.assign_power2(positive_exponent + closer);
+        m_minus.assign_power2(positive_exponent);
+        // 估计值k不大于使上界小于10^k的最小整数，再逐次修正
+        auto k{::cppfastbox::detail::floor_log10_pow2(e + static_cast<int>(::cppfastbox::detail::charconv_bit_width(f)) - 1)};
+        if(k >= 0) { s.multiply_power10(static_cast<::std::size_t>(k)); }
+        else
+        {
+            r.multiply_power10(static_cast<::std::size_t>(-k));
+            m_plus.multiply_power10(static_cast<::std::size_t>(-k));
+            m_minus.multiply_power10(static_cast<::std::size_t>(-k));
+        }
+        while(true)
+        {
+            high.assign(r);
+            high.add(m_plus);
+            auto compare{high.compare(s)};
+            if(compare < 0 || (compare == 0 && !even)) { break; }
+            s.multiply(10);
+            k++;
+        }
+        // 逐位生成，直到剩余部分落入区间
+        typename ::cppfastbox::detail::float_decimal<float_type>::significand_type digits{};
+        while(true)
+        {
+            r.multiply(10);
+            m_plus.multiply(10);
+            m_minus.multiply(10);
+            ::std::uint32_t digit{};
+            while(r.compare(s) >= 0)
+            {
+                r.subtract(s);
+                digit++;
+            }
+            k--;
+            auto low_compare{r.compare(m_minus)};
+            auto low{low_compare < 0 || (low_compare == 0 && even)};
+            high.assign(r);
+            high.add(m_plus);
+            auto high_compare{high.compare(s)};
+            auto upper{high_compare > 0 || (high_compare == 0 && even)};
+            if(!low && !upper)
+            {
+                digits = digits * 10 + digit;
+                continue;
+            }
+            if(low && upper)
+            {
+                // 两者都在区间内时选择较近者，距离相同时选择偶数
+                high.assign(r);
+                high.add(r);
+                auto mid_compare{high.compare(s)};
+                digit += mid_compare > 0 || (mid_compare == 0 && digit % 2 != 0);
+            }
+            else { digit += upper; }
+            // 最后一位可能进位，整数运算自动处理
+            return {digits * 10 + digit, k};
+        }
+    }
+
+    /**
+     * @brief 从end向前写入整数significand * 2^exponent的全部数字
+     *
+     * @note 值不超过256位，每次除以10^9
+     */
+    template <typename char_type, typename bits_type>
+    constexpr inline void write_binary_integer_backward(char_type* end, bits_type significand, int exponent) noexcept
+    {
+        ::cppfastbox::detail::float_bigint<8> value{};
+        value.assign(significand);
+        value.shift_left(static_cast<::std::size_t>(exponent));
+        while(value.size > 1 || value.data[0] >= 1'000'000'000)
+        {
+            ::cppfastbox::detail::write_fixed_digits_backward<9>(end, value.divide(1'000'000'000));
+            end -= 9;
+        }
+        ::cppfastbox::detail::write_digits_backward<::std::uint32_t>(end, value.data[0]);
+    }
+
+    /**
+     * @brief 写入十进制表示
+     *
+     * @param binary_significand 包含隐含位的有效数字
+     * @param binary_exponent 值为binary_significand * 2^binary_exponent
+     * @return 输出的结尾，不足以容纳时返回nullptr且不写入
+     * @note 与std::to_chars相同，定点表示不长于科学计数法时使用定点表示，科学计数法的指数至少有两位。
+     *       定点表示的最短有效数字之后需要补0且值不小于2^precision时，与printf相同写入精确的整数，位数不变
+     */
+    template <typename char_type, typename decimal_type, typename bits_type>
+    constexpr inline char_type* write_float_decimal(char_type* first,
+                                                    ::std::size_t capacity,
+                                                    bool negative,
+                                                    decimal_type significand,
+                                                    int exponent,
+                                                    bits_type binary_significand,
+                                                    int binary_exponent) noexcept
+    {
+        auto count{static_cast<int>(::cppfastbox::detail::digit_count(significand))};
+        // 值为0.significand * 10^point
+        auto point{count + exponent};
+        auto scientific_exponent{point - 1};
+        auto magnitude{static_cast<::std::uint32_t>(scientific_exponent < 0 ? -scientific_exponent : scientific_exponent)};
+        auto exponent_digits{magnitude < 100 ? 2 : static_cast<int>(::cppfastbox::detail::digit_count(magnitude))};
+        auto scientific_length{count + (count > 1) + 2 + exponent_digits};
+        auto fixed_length{exponent >= 0 ? count + exponent : (point > 0 ? count + 1 : count + 2 - point)};
+        auto fixed{fixed_length <= scientific_length};
+        if(static_cast<::std::size_t>(negative + (fixed ? fixed_length : scientific_length)) > capacity) { return nullptr; }
+        if(negative) { *first++ = static_cast<char_type>('-'); }
+        if(fixed)
+        {
+            if(exponent > 0 && binary_exponent > 0)
+            {
+                ::cppfastbox::detail::write_binary_integer_backward(first + fixed_length, binary_significand, binary_exponent);
+            }
+            else if(exponent >= 0)
+            {
+                // 值小于2^precision时最短表示即为精确值
+                ::cppfastbox::detail::write_unsigned_backward(first + count, significand);
+                for(auto i{count}; i < fixed_length; i++) { first[i] = static_cast<char_type>('0'); }
+            }
+            else if(point > 0)
+            {
+                // 先在第二个字符之后写入全部数字，再将整数部分前移并插入小数点
+                ::cppfastbox::detail::write_unsigned_backward(first + fixed_length, significand);
+                for(auto i{0}; i < point; i++) { first[i] = first[i + 1]; }
+                first[point] = static_cast<char_type>('.');
+            }
+            else
+            {
+                first[0] = static_cast<char_type>('0');
+                first[1] = static_cast<char_type>('.');
+                for(auto i{2}; i < 2 - point; i++) { first[i] = static_cast<char_type>('0'); }
+                ::cppfastbox::detail::write_unsigned_backward(first + fixed_length, significand);
+            }
+            return first + fixed_length;
+        }
+        ::cppfastbox::detail::write_unsigned_backward(first + count + 1, significand);
+        first[0] = first[1];
+        auto* end{first + 1};
+        if(count > 1)
+        {
+            first[1] = static_cast<char_type>('.');
+            end = first + count + 1;
+        }
+        end[0] = static_cast<char_type>('e');
+        end[1] = static_cast<char_type>(scientific_exponent < 0 ? '-' : '+');
+        end += 2 + exponent_digits;
+        ::cppfastbox::detail::write_digits_backward<::std::uint32_t>(end, magnitude);
+        if(magnitude < 10) { end[-2] = static_cast<char_type>('0'); }
+        return end;
+    }
+
+    /**
+     * @brief 将浮点数转换为最短的十进制文本
+     *
+     * @return 输出的结尾，不足以容纳时返回nullptr且不写入
+     */
+    template <typename char_type, typename float_type>
+    constexpr inline char_type* float_to_chars(char_type* first, ::std::size_t capacity, float_type value) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bits_type = typename format::bits_type;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr int max_biased_exponent{(1 << format::exponent_bits) - 1};
+        auto bits{::std::bit_cast<bits_type>(value)};
+        auto negative{(bits >> (sizeof(bits_type) * 8 - 1)) != 0};
+        auto biased_exponent{static_cast<int>(bits >> explicit_bits) & max_biased_exponent};
+        auto significand{static_cast<bits_type>(bits & ((bits_type{1} << explicit_bits) - 1))};
+        if(biased_exponent == max_biased_exponent || (biased_exponent == 0 && significand == 0))
+        {
+            // 与std::to_chars相同，特殊值为inf、nan和0
+            const char* text{biased_exponent == 0 ? "0" : (significand == 0 ? "inf" : "nan")};
+            auto length{biased_exponent == 0 ? 1zu : 3zu};
+            if(negative + length > capacity) { return nullptr; }
+            if(negative) { *first++ = static_cast<char_type>('-'); }
+            for(auto i{0zu}; i < length; i++) { first[i] = static_cast<char_type>(text[i]); }
+            return first + length;
+        }
+        ::cppfastbox::detail::float_decimal<float_type> decimal;
+        if constexpr(sizeof(float_type) == 16) { decimal = ::cppfastbox::detail::exact_to_decimal<float_type>(significand, biased_exponent); }
+        else { decimal = ::cppfastbox::detail::schubfach_to_decimal<float_type>(significand, biased_exponent); }
+        while(decimal.significand % 10 == 0)
+        {
+            decimal.significand /= 10;
+            decimal.exponent++;
+        }
+        auto binary_significand{biased_exponent == 0 ? significand : static_cast<bits_type>(significand | (bits_type{1} << explicit_bits))};
+        auto binary_exponent{(biased_exponent == 0 ? 1 : biased_exponent) - format::bias - explicit_bits};
+        return ::cppfastbox::detail::write_float_decimal(first,
+                                                         capacity,
+                                                         negative,
+                                                         decimal.significand,
+                                                         decimal.exponent,
+                                                         binary_significand,
+                                                         binary_exponent);
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 将浮点数转换为最短的十进制文本
+     *
+     * @param dest 输出，至少需要容纳to_chars_max_length<type>个字符
+     * @param value 要转换的浮点数
+     * @return 输出的结尾，不写入结束符
+     * @note 与std::to_chars相同，输出可以还原value的最短表示，位数相同时选择最接近的；在定点表示和科学计数法中选择较短者。
+     *       float和double使用Schubfach算法，float128使用大整数精确计算
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::charconv_floating_point type>
+    constexpr inline char_type* to_chars(char_type* dest, type value) noexcept
+    {
+        return ::cppfastbox::detail::float_to_chars(dest, ::cppfastbox::to_chars_max_length<type>, value);
+    }
+
+    /**
+     * @brief 将浮点数转换为最短的十进制文本
+     *
+     * @param first 输出的起始
+     * @param last 输出的结尾
+     * @param value 要转换的浮点数
+     * @return 输出的结尾，不写入结束符；[first, last)不足以容纳时返回nullptr且不写入
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::charconv_floating_point type>
+    constexpr inline char_type* to_chars(char_type* first, char_type* last, type value) noexcept
+    {
+        return ::cppfastbox::detail::float_to_chars(first, static_cast<::std::size_t>(last - first), value);
+    }
+}  // namespace cppfastbox
+
+/**
+ * @brief 文本转换为浮点数的支持
+ *
+ */
+namespace cppfastbox::detail
+{
+    // 浮点运算是否按类型本身的精度进行，x87等以更高精度计算时两次舍入会使Clinger算法得到错误的结果
+#if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+    constexpr inline auto float_exact_evaluation{true};
+#else
+    constexpr inline auto float_exact_evaluation{false};
+#endif
+
+    // 可以精确表示的10的最大幂，即5^n < 2^precision的最大n
+    template <typename float_type>
+    constexpr inline int max_exact_power10{sizeof(float_type) == 4 ? 10 : (sizeof(float_type) == 8 ? 22 : 48)};
+
+    // 可以精确表示的10的幂，下标为指数
+    template <typename float_type>
+    struct float_power10_table
+    {
+        float_type data[::cppfastbox::detail::max_exact_power10<float_type> + 1];
+    };
+
+    template <typename float_type>
+    consteval inline ::cppfastbox::detail::float_power10_table<float_type> get_float_power10_table() noexcept
+    {
+        ::cppfastbox::detail::float_power10_table<float_type> table{};
+        float_type power{1};
+        for(auto& i : table.data)
+        {
+            i = power;
+            power *= 10;
+        }
+        return table;
+    }
+
+    template <typename float_type>
+    constexpr inline auto float_power10{::cppfastbox::detail::get_float_power10_table<float_type>()};
+
+    /**
+     * @brief Eisel-Lemire算法的参数
+     *
+     * @note 与fast_float相同
+     */
+    template <typename float_type>
+    struct eisel_lemire_format
+    {
+        // 十进制指数小于smallest_power10时结果总是为0，大于largest_power10时总是为无穷
+        constexpr static int smallest_power10{sizeof(float_type) == 4 ? -64 : -342};
+        constexpr static int largest_power10{sizeof(float_type) == 4 ? 38 : 308};
+        // 乘积可能恰好位于两个浮点数中间的十进制指数范围
+        constexpr static int min_round_to_even{sizeof(float_type) == 4 ? -17 : -4};
+        constexpr static int max_round_to_even{sizeof(float_type) == 4 ? 10 : 23};
+    };
+
+    template <typename float_type>
+    constexpr inline auto eisel_lemire_table{
+        ::cppfastbox::detail::get_power5_table<::cppfastbox::detail::eisel_lemire_format<float_type>::smallest_power10,
+                                               ::cppfastbox::detail::eisel_lemire_format<float_type>::largest_power10,
+                                               true>()};
+
+    // Eisel-Lemire算法的结果，mantissa不含隐含位，power2为偏移后的指数
+    struct float_adjusted_mantissa
+    {
+        ::std::uint64_t mantissa;
+        int power2;
+
+        constexpr inline bool operator== (const float_adjusted_mantissa&) const noexcept = default;
+    };
+
+    /**
+     * @brief 以Eisel-Lemire算法计算w * 10^q舍入后的浮点数
+     *
+     * @note 与fast_float的compute_float相同，w不超过19位时128位乘积总是足以确定结果
+     */
+    template <typename float_type>
+    constexpr inline ::cppfastbox::detail::float_adjusted_mantissa eisel_lemire(::std::int64_t q, ::std::uint64_t w) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using parameter = ::cppfastbox::detail::eisel_lemire_format<float_type>;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr int infinite_power{(1 << format::exponent_bits) - 1};
+        if(w == 0 || q < parameter::smallest_power10) { return {0, 0}; }
+        if(q > parameter::largest_power10) { return {0, infinite_power}; }
+        auto leading_zeros{::std::countl_zero(w)};
+        w <<= leading_zeros;
+        auto& power{::cppfastbox::detail::eisel_lemire_table<float_type>.data[q - parameter::smallest_power10]};
+        // 高64位的低位全为1时乘积可能进位，再乘以低64位修正
+        constexpr auto precision_mask{static_cast<::std::uint64_t>(-1) >> (explicit_bits + 3)};
+        auto product{::cppfastbox::detail::multiply_64(w, power.high)};
+        if((product.high & precision_mask) == precision_mask)
+        {
+            auto second{::cppfastbox::detail::multiply_64(w, power.low)};
+            product.low += second.high;
+            if(second.high > product.low) { product.high++; }
+        }
+        auto upper_bit{static_cast<int>(product.high >> 63)};
+        auto shift{upper_bit + 64 - explicit_bits - 3};
+        auto mantissa{product.high >> shift};
+        // floor(log2(10^q)) + 63
+        auto power2{static_cast<int>(((152170 + 65536) * q) >> 16) + 63 + upper_bit - leading_zeros + format::bias};
+        if(power2 <= 0)
+        {
+            // 非规格化数
+            if(-power2 + 1 >= 64) { return {0, 0}; }
+            mantissa >>= -power2 + 1;
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+            // 舍入后可能成为最小的规格化数
+            return {mantissa, mantissa < (::std::uint64_t{1} << explicit_bits) ? 0 : 1};
+        }
+        // 恰好位于中间时向偶数舍入
+        if(product.low <= 1 && q >= parameter::min_round_to_even && q <= parameter::max_round_to_even && (mantissa & 3) == 1 &&
+           (mantissa << shift) == product.high)
+        {
+            mantissa &= ~::std::uint64_t{1};
+        }
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        if(mantissa >= (::std::uint64_t{2} << explicit_bits))
+        {
+            mantissa = ::std::uint64_t{1} << explicit_bits;
+            power2++;
+        }
+        mantissa &= ~(::std::uint64_t{1} << explicit_bits);
+        if(power2 >= infinite_power) { return {0, infinite_power}; }
+        return {mantissa, power2};
+    }
+
+    /**
+     * @brief 将mantissa * 2^exponent舍入为浮点数的位表示
+     *
+     * @param sticky 被舍弃的部分是否不为0
+     * @return 溢出时为无穷，下溢时为0
+     * @note 就近舍入，恰好位于中间时向偶数舍入；mantissa不为0
+     */
+    template <typename float_type, typename mantissa_type>
+    constexpr inline auto round_to_float(mantissa_type mantissa, ::std::int64_t exponent, bool sticky) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bits_type = typename format::bits_type;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr auto infinity{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << explicit_bits)};
+        auto width{static_cast<::std::int64_t>(::cppfastbox::detail::charconv_bit_width(mantissa))};
+        // 最高位的二进制指数
+        auto top{width - 1 + exponent};
+        if(top > format::max_exponent) { return infinity; }
+        // 非规格化数保留的位数较少
+        auto keep{top >= format::min_exponent ? format::precision : format::precision - (format::min_exponent - top)};
+        auto shift{width - keep};
+        mantissa_type result{};
+        auto round{false};
+        if(shift <= 0) { result = mantissa << -shift; }
+        else if(shift > width) { sticky = true; }
+        else if(shift == width)
+        {
+            round = true;
+            sticky = sticky || mantissa != (mantissa_type{1} << (width - 1));
+        }
+        else
+        {
+            result = mantissa >> shift;
+            round = (mantissa >> (shift - 1) & 1) != 0;
+            sticky = sticky || (mantissa & ((mantissa_type{1} << (shift - 1)) - 1)) != 0;
+        }
+        if(round && (sticky || (result & 1) != 0)) { result++; }
+        // 非规格化数进位后恰好成为最小的规格化数
+        if(top < format::min_exponent) { return static_cast<bits_type>(result); }
+        if((result >> format::precision) != 0)
+        {
+            result >>= 1;
+            if(++top > format::max_exponent) { return infinity; }
+        }
+        return static_cast<bits_type>(static_cast<bits_type>(top + format::bias) << explicit_bits |
+                                      (static_cast<bits_type>(result) & ((bits_type{1} << explicit_bits) - 1)));
+    }
+
+    /**
+     * @brief 以大整数精确计算十进制文本对应的浮点数
+     *
+     * @param integer_first 整数部分去除前导0后的起始
+     * @param integer_last 整数部分的结尾，有小数部分时为小数点的位置
+     * @param fraction_first 小数部分的起始
+     * @param fraction_last 小数部分的结尾
+     * @param exponent 指数部分的值
+     * @return 位表示，溢出时为无穷，下溢时为0
+     * @note 最多保留决定舍入结果所需的有效数字，之后的数字只影响是否恰好位于中间。先以十进制指数排除溢出和下溢，
+     *       指数不为负时取整数的最高precision + 2位，否则以恢复余数除法计算商的precision + 3位
+     */
+    template <typename float_type, typename char_type>
+    constexpr inline auto exact_from_decimal(const char_type* integer_first,
+                                             const char_type* integer_last,
+                                             const char_type* fraction_first,
+                                             const char_type* fraction_last,
+                                             ::std::int64_t exponent) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bits_type = typename format::bits_type;
+        using mantissa_type = ::std::conditional_t<sizeof(float_type) == 16, bits_type, ::std::uint64_t>;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr auto infinity{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << explicit_bits)};
+        // 小于最小非规格化数的一半和不小于最大值的十进制指数
+        constexpr auto min_power10{::cppfastbox::detail::floor_log10_pow2(format::min_exponent - format::precision)};
+        constexpr auto max_power10{::cppfastbox::detail::floor_log10_pow2(format::max_exponent + 1)};
+        constexpr auto max_count{static_cast<::std::size_t>(format::precision - format::min_exponent -
+                                                            ::cppfastbox::detail::floor_log10_pow2(-format::min_exponent) + 2)};
+        constexpr auto capacity{static_cast<::std::size_t>((static_cast<::std::int64_t>(max_count) + 2 - min_power10) * 3322 / 1000 +
+                                                           2 * format::precision + 64) /
+                                    32 +
+                                1};
+        using bigint = ::cppfastbox::detail::float_bigint<capacity>;
+        bigint digits{};
+        auto scale{exponent - (fraction_last - fraction_first)};
+        auto count{0zu};
+        auto sticky{false};
+        // 每9位数字合并后追加
+        ::std::uint32_t chunk{};
+        auto chunk_digits{0zu};
+        auto* last{fraction_first != fraction_last ? fraction_last : integer_last};
+        for(auto* i{integer_first}; i != last; i++)
+        {
+            if(i == integer_last) { continue; }
+            auto digit{::cppfastbox::detail::digit_value(*i)};
+            if(count == 0 && digit == 0) { continue; }
+            if(count == max_count)
+            {
+                sticky = sticky || digit != 0;
+                scale++;
+                continue;
+            }
+            chunk = chunk * 10 + digit;
+            count++;
+            if(++chunk_digits == 9)
+            {
+                digits.multiply(1'000'000'000);
+                digits.add(chunk);
+                chunk = 0;
+                chunk_digits = 0;
+            }
+        }
+        digits.multiply_power10(chunk_digits);
+        digits.add(chunk);
+        auto decimal_exponent{scale + static_cast<::std::int64_t>(count) - 1};
+        if(decimal_exponent > max_power10) { return infinity; }
+        if(decimal_exponent < min_power10) { return bits_type{}; }
+        if(scale >= 0)
+        {
+            digits.multiply_power10(static_cast<::std::size_t>(scale));
+            constexpr auto kept{static_cast<::std::size_t>(format::precision + 2)};
+            auto width{digits.bit_width()};
+            auto shift{width > kept ? width - kept : 0zu};
+            auto mantissa{static_cast<mantissa_type>(digits.bits64(static_cast<::std::ptrdiff_t>(shift)))};
+            if constexpr(sizeof(mantissa_type) > sizeof(::std::uint64_t))
+            {
+                mantissa |= static_cast<mantissa_type>(digits.bits64(static_cast<::std::ptrdiff_t>(shift) + 64)) << 64;
+            }
+            sticky = sticky || digits.any_bits_below(shift);
+            return ::cppfastbox::detail::round_to_float<float_type>(mantissa, static_cast<::std::int64_t>(shift), sticky);
+        }
+        // 将除数与被除数对齐到相同的位数，每次得到商的一位
+        bigint divisor{};
+        divisor.assign(1u);
+        divisor.multiply_power10(static_cast<::std::size_t>(-scale));
+        auto shift{static_cast<::std::int64_t>(digits.bit_width()) - static_cast<::std::int64_t>(divisor.bit_width())};
+        if(shift >= 0) { divisor.shift_left(static_cast<::std::size_t>(shift)); }
+        else { digits.shift_left(static_cast<::std::size_t>(-shift)); }
+        constexpr int quotient_bits{format::precision + 3};
+        mantissa_type quotient{};
+        for(auto i{0}; i < quotient_bits; i++)
+        {
+            quotient <<= 1;
+            if(digits.compare(divisor) >= 0)
+            {
+                digits.subtract(divisor);
+                quotient |= 1;
+            }
+            digits.shift_left(1);
+        }
+        sticky = sticky || digits.size != 0;
+        return ::cppfastbox::detail::round_to_float<float_type>(quotient, shift - quotient_bits + 1, sticky);
+    }
+
+    // 跳过连续的数字，其中有非0数字时置nonzero
+    template <typename char_type>
+    constexpr inline const char_type* skip_digits(const char_type* first, const char_type* last, bool& nonzero) noexcept
+    {
+        for(; first != last; first++)
+        {
+            auto digit{::cppfastbox::detail::digit_value(*first)};
+            if(digit >= 10) { break; }
+            nonzero = nonzero || digit != 0;
+        }
+        return first;
+    }
+
+    // 字符的值，ASCII字母转换为小写
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::uint32_t ascii_lowercase(char_type ch) noexcept
+    {
+        return static_cast<::std::uint32_t>(static_cast<::std::make_unsigned_t<char_type>>(ch)) | 0x20;
+    }
+
+    // 不区分大小写地比较[first, last)的开头与小写的text
+    template <typename char_type>
+    constexpr inline bool match_lowercase(const char_type* first, const char_type* last, const char* text, ::std::size_t length) noexcept
+    {
+        if(static_cast<::std::size_t>(last - first) < length) { return false; }
+        for(auto i{0zu}; i < length; i++)
+        {
+            if(::cppfastbox::detail::ascii_lowercase(first[i]) != static_cast<::std::uint32_t>(text[i])) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 解析inf、infinity、nan和nan(...)
+     *
+     * @param ptr 负号之后的位置
+     * @note 不区分大小写，nan的括号中可以有字母、数字和下划线，括号不完整时只解析nan
+     */
+    template <typename float_type, typename char_type>
+    constexpr inline ::cppfastbox::from_chars_result<char_type>
+        parse_float_special(const char_type* first, const char_type* ptr, const char_type* last, bool negative, float_type& value) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bits_type = typename format::bits_type;
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr auto infinity{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << explicit_bits)};
+        bits_type bits;
+        if(::cppfastbox::detail::match_lowercase(ptr, last, "inf", 3))
+        {
+            ptr += 3;
+            if(::cppfastbox::detail::match_lowercase(ptr, last, "inity", 5)) { ptr += 5; }
+            bits = infinity;
+        }
+        else if(::cppfastbox::detail::match_lowercase(ptr, last, "nan", 3))
+        {
+            ptr += 3;
+            if(ptr != last && *ptr == static_cast<char_type>('('))
+            {
+                auto* i{ptr + 1};
+                while(i != last && (::cppfastbox::detail::digit_value(*i) < 10 || ::cppfastbox::detail::ascii_lowercase(*i) - 'a' < 26 ||
+                                    *i == static_cast<char_type>('_')))
+                {
+                    i++;
+                }
+                if(i != last && *i == static_cast<char_type>(')')) { ptr = i + 1; }
+            }
+            bits = infinity | static_cast<bits_type>(bits_type{1} << (explicit_bits - 1));
+        }
+        else { return {first, ::cppfastbox::from_chars_error::invalid}; }
+        auto sign{static_cast<bits_type>(bits_type{negative} << (sizeof(bits_type) * 8 - 1))};
+        value = ::std::bit_cast<float_type>(static_cast<bits_type>(bits | sign));
+        return {ptr, ::cppfastbox::from_chars_error::ok};
+    }
+
+    /**
+     * @brief 将十进制文本转换为浮点数
+     *
+     * @note 先解析前19位有效数字（float128为38位），依次尝试Clinger快速路径、Eisel-Lemire算法和大整数精确计算。
+     *       有效数字被截断时，截断前后的值在Eisel-Lemire算法下得到相同的结果即为正确结果
+     */
+    template <typename float_type, typename char_type>
+    constexpr inline ::cppfastbox::from_chars_result<char_type>
+        float_from_chars(const char_type* first, const char_type* last, float_type& value) noexcept
+    {
+        using format = ::cppfastbox::detail::float_format<float_type>;
+        using bits_type = typename format::bits_type;
+        using word_type = ::std::conditional_t<sizeof(float_type) == 16, bits_type, ::std::uint64_t>;
+        constexpr auto fast_digits{::cppfastbox::detail::max_digits<word_type> - 1};
+        constexpr int explicit_bits{format::precision - 1};
+        constexpr auto infinity{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << explicit_bits)};
+        auto* ptr{first};
+        auto negative{ptr != last && *ptr == static_cast<char_type>('-')};
+        ptr += negative;
+        if(ptr != last && (::cppfastbox::detail::ascii_lowercase(*ptr) == 'i' || ::cppfastbox::detail::ascii_lowercase(*ptr) == 'n'))
+        {
+            return ::cppfastbox::detail::parse_float_special(first, ptr, last, negative, value);
+        }
+        auto* integer_first{ptr};
+        while(ptr != last && *ptr == static_cast<char_type>('0')) { ptr++; }
+        auto* significant_first{ptr};
+        word_type significand{};
+        ptr = ::cppfastbox::detail::parse_digits(ptr, last, significand, fast_digits);
+        auto remaining{fast_digits - static_cast<::std::size_t>(ptr - significant_first)};
+        // 无法保存的数字只改变指数，其中有非0数字时结果被截断
+        auto truncated{false};
+        auto* integer_last{::cppfastbox::detail::skip_digits(ptr, last, truncated)};
+        ::std::int64_t exponent{integer_last - ptr};
+        ptr = integer_last;
+        auto* fraction_first{ptr};
+        auto* fraction_last{ptr};
+        if(ptr != last && *ptr == static_cast<char_type>('.'))
+        {
+            fraction_first = ++ptr;
+            // 尚无有效数字时前导0只减小指数
+            if(significand == 0)
+            {
+                while(ptr != last && *ptr == static_cast<char_type>('0')) { ptr++; }
+                exponent -= ptr - fraction_first;
+            }
+            auto* fraction_significant{ptr};
+            ptr = ::cppfastbox::detail::parse_digits(ptr, last, significand, remaining);
+            exponent -= ptr - fraction_significant;
+            fraction_last = ::cppfastbox::detail::skip_digits(ptr, last, truncated);
+            ptr = fraction_last;
+        }
+        if(integer_last == integer_first && fraction_last == fraction_first) { return {first, ::cppfastbox::from_chars_error::invalid}; }
+        // 没有数字的指数部分不被解析
+        ::std::int64_t explicit_exponent{};
+        if(ptr != last && ::cppfastbox::detail::ascii_lowercase(*ptr) == 'e')
+        {
+            auto* exponent_ptr{ptr + 1};
+            auto exponent_negative{false};
+            if(exponent_ptr != last && (*exponent_ptr == static_cast<char_type>('-') || *exponent_ptr == static_cast<char_type>('+')))
+            {
+                exponent_negative = *exponent_ptr == static_cast<char_type>('-');
+                exponent_ptr++;
+            }
+            if(exponent_ptr != last && ::cppfastbox::detail::digit_value(*exponent_ptr) < 10)
+            {
+                // 过大的指数只需保证结果溢出或下溢
+                for(; exponent_ptr != last && ::cppfastbox::detail::digit_value(*exponent_ptr) < 10; exponent_ptr++)
+                {
+                    if(explicit_exponent < 0x1000'0000)
+                    {
+                        explicit_exponent = explicit_exponent * 10 + ::cppfastbox::detail::digit_value(*exponent_ptr);
+                    }
+                }
+                if(exponent_negative) { explicit_exponent = -explicit_exponent; }
+                ptr = exponent_ptr;
+            }
+        }
+        exponent += explicit_exponent;
+        bits_type bits{};
+        if(significand != 0)
+        {
+            // 有效数字和10的幂都可以精确表示时只需一次舍入
+            constexpr auto max_exact{::cppfastbox::detail::max_exact_power10<float_type>};
+            if((sizeof(float_type) == 16 || ::cppfastbox::detail::float_exact_evaluation) && !truncated && exponent >= -max_exact &&
+               exponent <= max_exact && significand <= (word_type{1} << format::precision))
+            {
+                auto result{static_cast<float_type>(significand)};
+                if(exponent < 0) { result /= ::cppfastbox::detail::float_power10<float_type>.data[-exponent]; }
+                else { result *= ::cppfastbox::detail::float_power10<float_type>.data[exponent]; }
+                value = negative ? -result : result;
+                return {ptr, ::cppfastbox::from_chars_error::ok};
+            }
+            auto exact{true};
+            if constexpr(sizeof(float_type) != 16)
+            {
+                auto adjusted{::cppfastbox::detail::eisel_lemire<float_type>(exponent, significand)};
+                if(!truncated || adjusted == ::cppfastbox::detail::eisel_lemire<float_type>(exponent, significand + 1))
+                {
+                    bits = static_cast<bits_type>(adjusted.mantissa | (static_cast<::std::uint64_t>(adjusted.power2) << explicit_bits));
+                    exact = false;
+                }
+            }
+            if(exact)
+            {
+                bits = ::cppfastbox::detail::exact_from_decimal<float_type>(significant_first,
+                                                                            integer_last,
+                                                                            fraction_first,
+                                                                            fraction_last,
+                                                                            explicit_exponent);
+            }
+            if(bits == 0 || bits == infinity) { return {ptr, ::cppfastbox::from_chars_error::overflow}; }
+        }
+        auto sign{static_cast<bits_type>(bits_type{negative} << (sizeof(bits_type) * 8 - 1))};
+        value = ::std::bit_cast<float_type>(static_cast<bits_type>(bits | sign));
+        return {ptr, ::cppfastbox::from_chars_error::ok};
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 将十进制文本转换为浮点数
+     *
+     * @param first 文本的起始
+     * @param last 文本的结尾
+     * @param value 转换成功时写入结果，失败时不修改
+     * @return 解析结束的位置和错误
+     * @note 与std::from_chars的general格式相同，可以以'-'开头，不区分大小写地接受inf、infinity、nan和nan(...)；
+     *       结果就近舍入，非0的值舍入为0或无穷时视为超出范围
+     */
+    template <::cppfastbox::character char_type, ::cppfastbox::charconv_floating_point type>
+    constexpr inline ::cppfastbox::from_chars_result<char_type> from_chars(const char_type* first, const char_type* last, type& value) noexcept
+    {
+        return ::cppfastbox::detail::float_from_chars(first, last, value);
+    }
+}  // namespace cppfastbox
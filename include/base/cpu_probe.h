@@ -0,0 +1,165 @@
+/**
+ * @file cpu_probe.h
+ * @brief 探测cpu支持的指令集
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <cstdint>
+#include "platform.h"
+#if defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)
+    #include <cpuid.h>
+#endif
+#if defined(CPPFASTBOX_LINUX) && (defined(CPPFASTBOX_ARM) || defined(CPPFASTBOX_ARM64) || defined(CPPFASTBOX_LA) || defined(CPPFASTBOX_LA64))
+    #include <sys/auxv.h>
+    #define CPPFASTBOX_HWCAP_SUPPORT
+#endif
+
+namespace cppfastbox::cpu_flags::runtime::detail
+{
+    // 指令集掩码，第i位表示是否支持枚举值为i的指令集
+    using flag_mask = ::std::uint64_t;
+    static_assert(::cppfastbox::cpu_flag_num <= sizeof(::cppfastbox::cpu_flags::runtime::detail::flag_mask) * 8);
+
+    /**
+     * @brief 获取由若干指令集组成的掩码
+     *
+     * @tparam flags cpu指令集枚举
+     */
+    template <::cppfastbox::cpu_flag... flags>
+    constexpr inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask make_flag_mask{
+        (::cppfastbox::cpu_flags::runtime::detail::flag_mask{} | ... |
+         (::cppfastbox::cpu_flags::runtime::detail::flag_mask{1} << ::std::to_underlying(flags)))};
+
+    /**
+     * @brief 获取表示指令集flag的掩码
+     *
+     * @param support 是否支持，为false时返回0
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline auto flag_bit(::cppfastbox::cpu_flag flag, bool support) noexcept
+    {
+        return ::cppfastbox::cpu_flags::runtime::detail::flag_mask{support} << ::std::to_underlying(flag);
+    }
+
+    /**
+     * @brief 获取编译期启用的指令集掩码
+     *
+     * @note 作为无法在运行时探测的平台的结果
+     */
+    consteval inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask get_compile_time_flag_mask() noexcept
+    {
+        using enum ::cppfastbox::cpu_flag;
+        ::cppfastbox::cpu_flags::runtime::detail::flag_mask mask{};
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse, ::cppfastbox::cpu_flags::x86::sse_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse2, ::cppfastbox::cpu_flags::x86::sse2_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse3, ::cppfastbox::cpu_flags::x86::sse3_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(ssse3, ::cppfastbox::cpu_flags::x86::ssse3_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse4_1, ::cppfastbox::cpu_flags::x86::sse4_1_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse4_2, ::cppfastbox::cpu_flags::x86::sse4_2_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx, ::cppfastbox::cpu_flags::x86::avx_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx2, ::cppfastbox::cpu_flags::x86::avx2_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512f, ::cppfastbox::cpu_flags::x86::avx512f_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512bw, ::cppfastbox::cpu_flags::x86::avx512bw_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512vl, ::cppfastbox::cpu_flags::x86::avx512vl_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512dq, ::cppfastbox::cpu_flags::x86::avx512dq_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512vbmi, ::cppfastbox::cpu_flags::x86::avx512vbmi_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(neon, ::cppfastbox::cpu_flags::arm::neon_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sve, ::cppfastbox::cpu_flags::arm::sve_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sve2, ::cppfastbox::cpu_flags::arm::sve2_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(lsx, ::cppfastbox::cpu_flags::la::lsx_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(lasx, ::cppfastbox::cpu_flags::la::lasx_support);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(wasm128, ::cppfastbox::cpu_flags::wasm::simd128_support);
+        return mask;
+    }
+
+    // 编译期启用的指令集掩码
+    constexpr inline auto compile_time_flag_mask{::cppfastbox::cpu_flags::runtime::detail::get_compile_time_flag_mask()};
+
+#if defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)
+    /**
+     * @brief 通过cpuid和xgetbv探测x86指令集
+     *
+     * @note 可能在ifunc解析器中调用，此时重定位尚未完成，因此不能调用外部函数；
+     * 操作系统未保存对应的寄存器状态时，即使cpu支持也视为不支持
+     */
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask probe_x86_flag_mask() noexcept
+    {
+        using enum ::cppfastbox::cpu_flag;
+        ::cppfastbox::cpu_flags::runtime::detail::flag_mask mask{};
+        auto max_leaf{__get_cpuid_max(0, nullptr)};
+        if(max_leaf < 1) { return mask; }
+        unsigned int eax{}, ebx{}, ecx{}, edx{};
+        __cpuid(1, eax, ebx, ecx, edx);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse, (edx & bit_SSE) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse2, (edx & bit_SSE2) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse3, (ecx & bit_SSE3) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(ssse3, (ecx & bit_SSSE3) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse4_1, (ecx & bit_SSE4_1) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sse4_2, (ecx & bit_SSE4_2) != 0);
+        // 操作系统未启用xsave时无法使用ymm和zmm寄存器
+        if((ecx & bit_OSXSAVE) == 0) { return mask; }
+        unsigned int xcr0{}, xcr0_high{};
+        __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0_high) : "c"(0));
+        // xcr0的第1、2位表示操作系统保存xmm和ymm，第5、6、7位表示保存opmask和zmm
+        auto ymm_support{(xcr0 & 0x06) == 0x06};
+        auto zmm_support{(xcr0 & 0xe6) == 0xe6};
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx, ymm_support && (ecx & bit_AVX) != 0);
+        if(max_leaf < 7) { return mask; }
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx2, ymm_support && (ebx & bit_AVX2) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512f, zmm_support && (ebx & bit_AVX512F) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512bw, zmm_support && (ebx & bit_AVX512BW) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512vl, zmm_support && (ebx & bit_AVX512VL) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512dq, zmm_support && (ebx & bit_AVX512DQ) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(avx512vbmi, zmm_support && (ecx & bit_AVX512VBMI) != 0);
+        return mask;
+    }
+#endif
+
+#ifdef CPPFASTBOX_HWCAP_SUPPORT
+    /**
+     * @brief 通过getauxval(AT_HWCAP)探测arm和loongarch指令集
+     *
+     * @note 位定义取自linux内核的uapi/asm/hwcap.h
+     */
+    inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask probe_hwcap_flag_mask() noexcept
+    {
+        using enum ::cppfastbox::cpu_flag;
+        ::cppfastbox::cpu_flags::runtime::detail::flag_mask mask{};
+        auto hwcap{::getauxval(AT_HWCAP)};
+    #if defined(CPPFASTBOX_ARM64)
+        auto hwcap2{::getauxval(AT_HWCAP2)};
+        // HWCAP_ASIMD、HWCAP_SVE和HWCAP2_SVE2
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(neon, (hwcap & (1ul << 1)) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sve, (hwcap & (1ul << 22)) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(sve2, (hwcap2 & (1ul << 1)) != 0);
+    #elif defined(CPPFASTBOX_ARM)
+        // HWCAP_NEON
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(neon, (hwcap & (1ul << 12)) != 0);
+    #else
+        // HWCAP_LOONGARCH_LSX和HWCAP_LOONGARCH_LASX
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(lsx, (hwcap & (1ul << 4)) != 0);
+        mask |= ::cppfastbox::cpu_flags::runtime::detail::flag_bit(lasx, (hwcap & (1ul << 5)) != 0);
+    #endif
+        return mask;
+    }
+#endif
+
+    /**
+     * @brief 探测当前cpu支持的指令集
+     *
+     * @note x86上不调用外部函数；其他平台在编译期启用的指令集的基础上补充运行时探测的结果
+     */
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask probe_flag_mask() noexcept
+    {
+#if defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)
+        return ::cppfastbox::cpu_flags::runtime::detail::probe_x86_flag_mask();
+#elif defined(CPPFASTBOX_HWCAP_SUPPORT)
+        return ::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask |
+               ::cppfastbox::cpu_flags::runtime::detail::probe_hwcap_flag_mask();
+#else
+        return ::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask;
+#endif
+    }
+}  // namespace cppfastbox::cpu_flags::runtime::detail
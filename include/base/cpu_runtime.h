@@ -0,0 +1,196 @@
+/**
+ * @file cpu_runtime.h
+ * @brief 运行时查询cpu指令集和缓存信息
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "cpu_probe.h"
+#if defined(CPPFASTBOX_LINUX) || defined(CPPFASTBOX_MACOS) || defined(CPPFASTBOX_IOS) || defined(CPPFASTBOX_ANDROID)
+    #include <unistd.h>
+#endif
+
+namespace cppfastbox::cpu_flags::runtime
+{
+    // 以::cppfastbox::cpu_flag为位序号的指令集集合
+    using flag_set = ::cppfastbox::cpu_flags::runtime::detail::flag_mask;
+
+    // 运行时探测到的cpu信息，无法获取的缓存大小为0
+    struct cpu_info
+    {
+        // 支持的指令集
+        ::cppfastbox::cpu_flags::runtime::flag_set flags{};
+        // 缓存行大小
+        ::std::size_t cache_line_size{};
+        // L1数据缓存大小
+        ::std::size_t l1_cache_size{};
+        // L2缓存大小
+        ::std::size_t l2_cache_size{};
+        // L3缓存大小
+        ::std::size_t l3_cache_size{};
+    };
+}  // namespace cppfastbox::cpu_flags::runtime
+
+namespace cppfastbox::cpu_flags::runtime::detail
+{
+#if defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)
+    /**
+     * @brief 遍历确定性缓存参数叶(Intel为4，AMD为0x8000001d)获取各级缓存大小
+     *
+     * @return 是否获取到缓存大小
+     */
+    inline bool probe_x86_deterministic_cache(::cppfastbox::cpu_flags::runtime::cpu_info& info, unsigned int leaf) noexcept
+    {
+        auto found{false};
+        for(auto subleaf{0u}; subleaf < 16; subleaf++)
+        {
+            unsigned int eax{}, ebx{}, ecx{}, edx{};
+            __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+            // 缓存类型：0表示没有更多缓存，1为数据缓存，2为指令缓存，3为统一缓存
+            auto type{eax & 0x1f};
+            if(type == 0) { break; }
+            if(type == 2) { continue; }
+            auto level{(eax >> 5) & 0x7};
+            auto line_size{(ebx & 0xfff) + 1};
+            auto size{static_cast<::std::size_t>(line_size) * (((ebx >> 12) & 0x3ff) + 1) * ((ebx >> 22) + 1) * (ecx + 1)};
+            switch(level)
+            {
+                case 1:
+                    info.l1_cache_size = size;
+                    info.cache_line_size = line_size;
+                    break;
+                case 2: info.l2_cache_size = size; break;
+                case 3: info.l3_cache_size = size; break;
+                default: break;
+            }
+            found = true;
+        }
+        return found;
+    }
+
+    /**
+     * @brief 通过cpuid探测x86缓存大小
+     *
+     */
+    inline void probe_x86_cache(::cppfastbox::cpu_flags::runtime::cpu_info& info) noexcept
+    {
+        unsigned int max_leaf{}, eax{}, ebx{}, ecx{}, edx{};
+        __cpuid(0, max_leaf, ebx, ecx, edx);
+        if(max_leaf < 1) { return; }
+        // 厂商字符串的前4字节，分别为"Genu"、"Auth"和"Hygo"
+        auto intel{ebx == 0x756e6547};
+        auto amd{ebx == 0x68747541 || ebx == 0x6f677948};
+        // edx的第19位表示支持clflush，其缓存行大小以8字节为单位
+        __cpuid(1, eax, ebx, ecx, edx);
+        if((edx & (1u << 19)) != 0) { info.cache_line_size = ((ebx >> 8) & 0xff) * 8; }
+        if(intel && max_leaf >= 4 && ::cppfastbox::cpu_flags::runtime::detail::probe_x86_deterministic_cache(info, 4)) { return; }
+        if(!amd) { return; }
+        auto max_extended_leaf{__get_cpuid_max(0x80000000, nullptr)};
+        if(max_extended_leaf >= 0x8000001d && ::cppfastbox::cpu_flags::runtime::detail::probe_x86_deterministic_cache(info, 0x8000001d))
+        {
+            return;
+        }
+        // 旧的AMD处理器只提供以KiB为单位的缓存大小
+        if(max_extended_leaf >= 0x80000005)
+        {
+            __cpuid(0x80000005, eax, ebx, ecx, edx);
+            info.l1_cache_size = static_cast<::std::size_t>(ecx >> 24) * 1024;
+            info.cache_line_size = ecx & 0xff;
+        }
+        if(max_extended_leaf >= 0x80000006)
+        {
+            __cpuid(0x80000006, eax, ebx, ecx, edx);
+            info.l2_cache_size = static_cast<::std::size_t>(ecx >> 16) * 1024;
+            info.l3_cache_size = static_cast<::std::size_t>(edx >> 18) * 512 * 1024;
+        }
+    }
+#endif
+
+    /**
+     * @brief 通过sysconf补充未获取到的缓存信息
+     *
+     * @note _SC_LEVEL1_DCACHE_SIZE等为glibc扩展
+     */
+    inline void probe_sysconf_cache([[maybe_unused]] ::cppfastbox::cpu_flags::runtime::cpu_info& info) noexcept
+    {
+#ifdef _SC_LEVEL1_DCACHE_LINESIZE
+        auto query{[](int name) noexcept -> ::std::size_t
+                   {
+                       auto result{::sysconf(name)};
+                       return result > 0 ? static_cast<::std::size_t>(result) : 0;
+                   }};
+        if(info.cache_line_size == 0) { info.cache_line_size = query(_SC_LEVEL1_DCACHE_LINESIZE); }
+        if(info.l1_cache_size == 0) { info.l1_cache_size = query(_SC_LEVEL1_DCACHE_SIZE); }
+        if(info.l2_cache_size == 0) { info.l2_cache_size = query(_SC_LEVEL2_CACHE_SIZE); }
+        if(info.l3_cache_size == 0) { info.l3_cache_size = query(_SC_LEVEL3_CACHE_SIZE); }
+#endif
+    }
+
+    /**
+     * @brief 探测当前cpu的信息
+     *
+     */
+    inline ::cppfastbox::cpu_flags::runtime::cpu_info probe() noexcept
+    {
+        ::cppfastbox::cpu_flags::runtime::cpu_info info{};
+        info.flags = ::cppfastbox::cpu_flags::runtime::detail::probe_flag_mask();
+#if defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)
+        ::cppfastbox::cpu_flags::runtime::detail::probe_x86_cache(info);
+#elifdef CPPFASTBOX_ARM64
+        // ctr_el0的DminLine为最小数据缓存行包含的4字节字数的对数
+        ::std::uint64_t ctr{};
+        __asm__("mrs %0, ctr_el0" : "=r"(ctr));
+        info.cache_line_size = 4zu << ((ctr >> 16) & 0xf);
+#endif
+        ::cppfastbox::cpu_flags::runtime::detail::probe_sysconf_cache(info);
+        // 无法获取时使用编译期假定的缓存行大小
+        if(info.cache_line_size == 0) { info.cache_line_size = 64; }
+        return info;
+    }
+}  // namespace cppfastbox::cpu_flags::runtime::detail
+
+namespace cppfastbox::cpu_flags::runtime
+{
+    /**
+     * @brief 获取当前cpu的信息
+     *
+     * @note 首次调用时探测并缓存，之后的调用直接返回缓存的结果；静态初始化期间的调用也是安全的
+     */
+    inline const ::cppfastbox::cpu_flags::runtime::cpu_info& info() noexcept
+    {
+        static const ::cppfastbox::cpu_flags::runtime::cpu_info info{::cppfastbox::cpu_flags::runtime::detail::probe()};
+        return info;
+    }
+
+    namespace detail
+    {
+        // 确保在程序启动时完成探测
+        [[maybe_unused]] inline const auto& startup_info{::cppfastbox::cpu_flags::runtime::info()};
+    }  // namespace detail
+
+    // 获取当前cpu支持的指令集
+    inline ::cppfastbox::cpu_flags::runtime::flag_set flags() noexcept { return ::cppfastbox::cpu_flags::runtime::info().flags; }
+
+    /**
+     * @brief 判断当前cpu是否支持指令集flag
+     *
+     * @param flag cpu指令集枚举
+     */
+    inline bool support(::cppfastbox::cpu_flag flag) noexcept
+    {
+        return (::cppfastbox::cpu_flags::runtime::flags() & (::cppfastbox::cpu_flags::runtime::flag_set{1} << ::std::to_underlying(flag))) != 0;
+    }
+
+    // 获取当前cpu的缓存行大小
+    inline ::std::size_t cache_line_size() noexcept { return ::cppfastbox::cpu_flags::runtime::info().cache_line_size; }
+
+    // 获取当前cpu的L1数据缓存大小，无法获取时为0
+    inline ::std::size_t l1_cache_size() noexcept { return ::cppfastbox::cpu_flags::runtime::info().l1_cache_size; }
+
+    // 获取当前cpu的L2缓存大小，无法获取时为0
+    inline ::std::size_t l2_cache_size() noexcept { return ::cppfastbox::cpu_flags::runtime::info().l2_cache_size; }
+
+    // 获取当前cpu的L3缓存大小，无法获取时为0
+    inline ::std::size_t l3_cache_size() noexcept { return ::cppfastbox::cpu_flags::runtime::info().l3_cache_size; }
+}  // namespace cppfastbox::cpu_flags::runtime
@@ -0,0 +1,312 @@
+/**
+ * @file dispatch.h
+ * @brief 按cpu指令集在运行时分派函数
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ * @note 需要先于内核的实现包含，见CPPFASTBOX_RUNTIME_DISPATCH
+ */
+#pragma once
+#include <concepts>
+#include <type_traits>
+#include "cpu_probe.h"
+
+/**
+ * @brief 是否支持运行时分派
+ *
+ * @note 内核通过flatten内联到以对应指令集编译的函数中，而未开启优化时flatten不生效，因此只使用编译期可用的实现
+ */
+#if (defined(CPPFASTBOX_X86) || defined(CPPFASTBOX_X64)) && defined(__OPTIMIZE__)
+    #define CPPFASTBOX_RUNTIME_DISPATCH
+    // gcc只在启用指令集后才声明对应的内建函数，因此必须在包含内核的实现之前声明分派用到的内建函数
+    #if defined(CPPFASTBOX_GCC)
+        #pragma GCC push_options
+        #pragma GCC target("avx2,avx512f,avx512bw,avx512vl,avx512dq,avx512vbmi")
+        #pragma GCC pop_options
+    #endif
+#endif
+
+namespace cppfastbox::detail
+{
+    // 编译分派目标使用的指令集级别
+    enum class dispatch_target : ::std::size_t
+    {
+        baseline,  //< 编译期启用的指令集
+        sse4_2,
+        avx,
+        avx2,
+        avx512,  //< avx512f、avx512bw、avx512vl和avx512dq
+        avx512vbmi,
+        dispatch_target_num  //< 指令集级别数
+    };
+
+    /**
+     * @brief 获取指令集级别需要的全部指令集
+     *
+     * @note 每一级别都包含之前级别的指令集
+     */
+    consteval inline ::cppfastbox::cpu_flags::runtime::detail::flag_mask
+        get_dispatch_target_mask(::cppfastbox::detail::dispatch_target target) noexcept
+    {
+        using enum ::cppfastbox::cpu_flag;
+        switch(target)
+        {
+            case ::cppfastbox::detail::dispatch_target::baseline: return 0;
+            case ::cppfastbox::detail::dispatch_target::sse4_2:
+                return ::cppfastbox::cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2>;
+            case ::cppfastbox::detail::dispatch_target::avx:
+                return ::cppfastbox::cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx>;
+            case ::cppfastbox::detail::dispatch_target::avx2:
+                return ::cppfastbox::cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx, avx2>;
+            case ::cppfastbox::detail::dispatch_target::avx512:
+                return ::cppfastbox::cpu_flags::runtime::detail::
+                    make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx, avx2, avx512f, avx512bw, avx512vl, avx512dq>;
+            case ::cppfastbox::detail::dispatch_target::avx512vbmi:
+                return ::cppfastbox::cpu_flags::runtime::detail::
+                    make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx, avx2, avx512f, avx512bw, avx512vl, avx512dq, avx512vbmi>;
+            default: ::std::unreachable();
+        }
+    }
+
+    /**
+     * @brief 获取能够使用flags中全部指令集的最低指令集级别，即包含的指令集是flags超集的最低级别
+     *
+     * @note 级别的粒度较粗，结果会向上取整：例如只需要ssse3的kernel以sse4.2级别编译，只需要avx512bw的kernel以avx512级别编译，
+     * 运行时也需要支持该级别的全部指令集；非x86平台总是使用编译期启用的指令集
+     */
+    consteval inline ::cppfastbox::detail::dispatch_target
+        get_dispatch_target(::cppfastbox::cpu_flags::runtime::detail::flag_mask flags) noexcept
+    {
+        if constexpr(::cppfastbox::cpu_family::native == ::cppfastbox::cpu_family::x86)
+        {
+            constexpr auto num{::std::to_underlying(::cppfastbox::detail::dispatch_target::dispatch_target_num)};
+            for(auto i{0zu}; i < num; i++)
+            {
+                auto target{static_cast<::cppfastbox::detail::dispatch_target>(i)};
+                if((flags & ~::cppfastbox::detail::get_dispatch_target_mask(target)) == 0) { return target; }
+            }
+            // flags包含非x86指令集，任何级别都无法满足，运行时检查总会失败
+            return static_cast<::cppfastbox::detail::dispatch_target>(num - 1);
+        }
+        return ::cppfastbox::detail::dispatch_target::baseline;
+    }
+
+    /**
+     * @brief 以指定的指令集级别编译kernel
+     *
+     * @note flatten使kernel及其调用的函数全部内联到对应指令集的函数中，因此不同指令集的代码不会混用；
+     * 函数均为隐藏符号，在ifunc解析器中也可以安全地取地址
+     */
+    template <auto kernel, ::cppfastbox::detail::dispatch_target target, typename = decltype(kernel)>
+    struct dispatch_variant;
+
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::baseline, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten]] static ret call(args... a) noexcept { return kernel(a...); }
+    };
+
+#ifdef CPPFASTBOX_RUNTIME_DISPATCH
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::sse4_2, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten, target("sse4.2")]] static ret call(args... a) noexcept { return kernel(a...); }
+    };
+
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::avx, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten, target("avx")]] static ret call(args... a) noexcept { return kernel(a...); }
+    };
+
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::avx2, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten, target("avx2")]] static ret call(args... a) noexcept { return kernel(a...); }
+    };
+
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::avx512, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten, target("avx2,avx512f,avx512bw,avx512vl,avx512dq")]] static ret call(args... a) noexcept
+        {
+            return kernel(a...);
+        }
+    };
+
+    template <auto kernel, typename ret, typename... args>
+    struct dispatch_variant<kernel, ::cppfastbox::detail::dispatch_target::avx512vbmi, ret (*)(args...) noexcept>
+    {
+        [[using gnu: visibility("hidden"), flatten, target("avx2,avx512f,avx512bw,avx512vl,avx512dq,avx512vbmi")]] static ret
+            call(args... a) noexcept
+        {
+            return kernel(a...);
+        }
+    };
+#endif
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 分派的一个分支：cpu支持flags时使用kernel
+     *
+     * @tparam kernel 函数指针，必须为noexcept
+     * @tparam flags kernel需要的cpu指令集，kernel以能够使用这些指令集的最低级别编译
+     * @note 实际需要的指令集为flags与该级别包含的指令集的并集，见get_dispatch_target
+     */
+    template <auto kernel, ::cppfastbox::cpu_flag... flags>
+    struct dispatch_case
+    {
+    private:
+        constexpr static auto flag_mask{::cppfastbox::cpu_flags::runtime::detail::make_flag_mask<flags...>};
+
+    public:
+        // 编译kernel使用的指令集级别，flags均已在编译期启用时直接使用编译期启用的指令集
+        constexpr static auto target{(flag_mask & ~::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask) == 0
+                                         ? ::cppfastbox::detail::dispatch_target::baseline
+                                         : ::cppfastbox::detail::get_dispatch_target(flag_mask)};
+        // 运行时需要支持的指令集
+        constexpr static auto required_mask{flag_mask | ::cppfastbox::detail::get_dispatch_target_mask(target)};
+        // 编译期已启用全部需要的指令集
+        constexpr static bool compile_time_support{(required_mask & ~::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask) == 0};
+        // 能否被选择，不支持运行时分派时只能选择以编译期启用的指令集编译的分支
+        constexpr static bool enabled{
+#ifdef CPPFASTBOX_RUNTIME_DISPATCH
+            true
+#else
+            target == ::cppfastbox::detail::dispatch_target::baseline
+#endif
+        };
+
+        // 获取以对应指令集编译的kernel
+        consteval static auto function() noexcept
+        {
+            return &::cppfastbox::detail::dispatch_variant<kernel, enabled ? target : ::cppfastbox::detail::dispatch_target::baseline>::call;
+        }
+    };
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    template <typename function_type, typename... cases>
+    struct dispatch_impl;
+
+    template <typename ret, typename... args, typename... cases>
+    struct dispatch_impl<ret (*)(args...) noexcept, cases...>
+    {
+        using function_type = ret (*)(args...) noexcept;
+
+    private:
+        // 最后一个分支作为兜底
+        using fallback = decltype((::std::type_identity<cases>{}, ...))::type;
+        static_assert(fallback::compile_time_support, "The last case must not require cpu flags that are not enabled at compile time");
+
+        // 第一个编译期即可确定可用的分支，之后的分支不会被选择
+        consteval static ::std::size_t get_static_index() noexcept
+        {
+            bool support[]{cases::compile_time_support...};
+            auto i{0zu};
+            while(!support[i]) { i++; }
+            return i;
+        }
+
+        constexpr static auto static_index{get_static_index()};
+
+        // 是否需要在运行时选择
+        consteval static bool get_need_runtime() noexcept
+        {
+            bool enabled[]{cases::enabled...};
+            for(auto i{0zu}; i < static_index; i++)
+            {
+                if(enabled[i]) { return true; }
+            }
+            return false;
+        }
+
+        template <typename current>
+        [[gnu::always_inline]] static bool try_select(::cppfastbox::cpu_flags::runtime::detail::flag_mask flags, function_type& result) noexcept
+        {
+            if constexpr(current::enabled)
+            {
+                if((flags & current::required_mask) == current::required_mask)
+                {
+                    result = current::function();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static ret first_call(args... a) noexcept
+        {
+            auto func{resolve(::cppfastbox::cpu_flags::runtime::detail::probe_flag_mask())};
+            __atomic_store_n(&current, func, __ATOMIC_RELAXED);
+            return func(a...);
+        }
+
+        inline static function_type current{&first_call};
+
+    public:
+        // 是否需要在运行时选择，否则直接调用编译期确定的实现
+        constexpr static bool need_runtime{get_need_runtime()};
+
+        /**
+         * @brief 选择支持flags时可用的第一个实现
+         *
+         * @param flags 支持的cpu指令集掩码，编译期启用的指令集总是视为支持
+         * @note 不调用外部函数，可以在ifunc解析器中使用
+         */
+        [[gnu::always_inline]] static function_type resolve(::cppfastbox::cpu_flags::runtime::detail::flag_mask flags) noexcept
+        {
+            // 编译期启用的指令集总是受支持的
+            flags |= ::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask;
+            function_type result{fallback::function()};
+            (try_select<cases>(flags, result) || ...);
+            return result;
+        }
+
+        /**
+         * @brief 获取当前cpu使用的实现
+         *
+         * @note 首次调用时选择实现并缓存，之后等同于读取一个函数指针，可在循环外获取以避免重复读取
+         */
+        static function_type get() noexcept
+        {
+            if constexpr(need_runtime)
+            {
+                auto func{__atomic_load_n(&current, __ATOMIC_RELAXED)};
+                if(func != &first_call) [[likely]] { return func; }
+                func = resolve(::cppfastbox::cpu_flags::runtime::detail::probe_flag_mask());
+                __atomic_store_n(&current, func, __ATOMIC_RELAXED);
+                return func;
+            }
+            else { return resolve(::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask); }
+        }
+
+        // 调用当前cpu使用的实现
+        static ret call(args... a) noexcept
+        {
+            if constexpr(need_runtime) { return __atomic_load_n(&current, __ATOMIC_RELAXED)(a...); }
+            else { return resolve(::cppfastbox::cpu_flags::runtime::detail::compile_time_flag_mask)(a...); }
+        }
+    };
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 按cpu支持的指令集选择实现
+     *
+     * @tparam cases 若干::cppfastbox::dispatch_case，按优先级从高到低排列，选择第一个cpu支持的分支；
+     * 最后一个分支作为兜底，不能需要编译期未启用的指令集
+     * @note 所有分支的函数类型必须相同；首次调用时选择实现并缓存到函数指针中，之后的调用等同于一次间接调用；
+     * 支持ifunc时可以在解析器中调用resolve
+     */
+    template <typename... cases>
+        requires (sizeof...(cases) != 0 &&
+                  (::std::same_as<decltype(cases::function()), decltype((cases::function(), ...))> && ...))
+    struct dispatch : ::cppfastbox::detail::dispatch_impl<decltype((cases::function(), ...)), cases...>
+    {
+    };
+}  // namespace cppfastbox
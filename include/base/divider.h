@@ -0,0 +1,404 @@
+/**
+ * @file divider.h
+ * @brief 运行时不变的除数
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include "utility.h"
+
+/**
+ * @brief 以乘法的高半部分代替除法
+ *
+ * @note 见Granlund and Montgomery, Division by Invariant Integers using Multiplication
+ */
+namespace cppfastbox::detail
+{
+    // 向量的元素类型
+    template <typename vector>
+    using divider_element_t = ::std::remove_cvref_t<decltype(::std::declval<vector>()[0])>;
+
+    /**
+     * @brief 可以由divider<type>逐元素相除的向量
+     *
+     * @note 仅接受向量扩展的内建向量，元素与type的宽度和符号相同
+     */
+    template <typename vector, typename type>
+    concept divider_vector = !::std::is_class_v<vector> && requires(vector v) {
+        { v + v } -> ::std::same_as<vector>;
+        v[0];
+    } && ::cppfastbox::simd_integral<::cppfastbox::detail::divider_element_t<vector>> &&
+                             sizeof(::cppfastbox::detail::divider_element_t<vector>) == sizeof(type) &&
+                             ::cppfastbox::simd_signed_integral<::cppfastbox::detail::divider_element_t<vector>> ==
+                                 ::cppfastbox::signed_integral<type>;
+
+    // 无符号整数的有效位数
+    template <::cppfastbox::fixed_size_unsigned_integral type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline int divider_bit_width(type value) noexcept
+    {
+        if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { return 128 - ::cppfastbox::countl_zero(::cppfastbox::uint128_t{value}); }
+        else { return static_cast<int>(::std::bit_width(value)); }
+    }
+
+    /**
+     * @brief 计算floor(high * 2^bits / divisor)，bits为type的位数
+     *
+     * @param high 必须小于divisor
+     */
+    template <::cppfastbox::fixed_size_unsigned_integral type>
+    constexpr inline type divider_divide_wide(type high, type divisor) noexcept
+    {
+        constexpr auto bits{sizeof(type) * 8};
+        if constexpr(sizeof(type) < sizeof(::std::uint64_t)) { return static_cast<type>((::std::uint64_t{high} << bits) / divisor); }
+        else if constexpr(sizeof(type) == sizeof(::std::uint64_t))
+        {
+            ::std::uint64_t remainder{};
+            return ::cppfastbox::detail::uint128_divide_64(high, 0, divisor, remainder);
+        }
+        else
+        {
+            // 仅在构造时使用，逐位试商即可
+            type quotient{};
+            auto remainder{high};
+            for(auto i{0zu}; i < bits; i++)
+            {
+                auto carry{remainder >> (bits - 1) != 0};
+                remainder <<= 1;
+                quotient <<= 1;
+                if(carry || remainder >= divisor)
+                {
+                    remainder -= divisor;
+                    quotient |= 1;
+                }
+            }
+            return quotient;
+        }
+    }
+
+    /**
+     * @brief 乘积的高半部分
+     *
+     */
+    template <::cppfastbox::fixed_size_integral type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline type divider_multiply_high(type a, type b) noexcept
+    {
+        constexpr auto bits{sizeof(type) * 8};
+        if constexpr(sizeof(type) < sizeof(::std::uint64_t) || (sizeof(type) == sizeof(::std::uint64_t) && ::cppfastbox::int128_support))
+        {
+            using wide_type = ::cppfastbox::fixed_size_integer_t<::cppfastbox::signed_integral<type>, sizeof(type) * 2>;
+            return static_cast<type>(static_cast<wide_type>(a) * b >> bits);
+        }
+        else
+        {
+            using unsigned_type = ::cppfastbox::fixed_size_integer_t<false, sizeof(type)>;
+            auto ua{static_cast<unsigned_type>(a)};
+            auto ub{static_cast<unsigned_type>(b)};
+            unsigned_type high{};
+            if constexpr(sizeof(type) == sizeof(::std::uint64_t)) { high = ::cppfastbox::wide_multiply(ua, ub).hi; }
+            else
+            {
+                auto a0{static_cast<::std::uint64_t>(ua)};
+                auto a1{static_cast<::std::uint64_t>(ua >> 64)};
+                auto b0{static_cast<::std::uint64_t>(ub)};
+                auto b1{static_cast<::std::uint64_t>(ub >> 64)};
+                auto p01{static_cast<unsigned_type>(a0) * b1};
+                // 不会溢出：(2^64 - 1)^2 + 2 * (2^64 - 1) = 2^128 - 1
+                auto middle{(static_cast<unsigned_type>(a0) * b0 >> 64) + static_cast<::std::uint64_t>(p01) +
+                            static_cast<unsigned_type>(a1) * b0};
+                high = static_cast<unsigned_type>(a1) * b1 + (p01 >> 64) + (middle >> 64);
+            }
+            // 负数的补码比无符号数小2^bits，乘积的高半部分相应地减去另一个乘数
+            if constexpr(::cppfastbox::signed_integral<type>) { high -= (a < 0 ? ub : unsigned_type{}) + (b < 0 ? ua : unsigned_type{}); }
+            return static_cast<type>(high);
+        }
+    }
+
+    /**
+     * @brief 乘法高位指令支持的最大向量大小
+     *
+     * @tparam element_size 元素大小
+     * @return 不支持时为0，此时由编译器扩展元素后相乘
+     */
+    template <::std::size_t element_size>
+    consteval inline ::std::size_t divider_multiply_high_max_size() noexcept
+    {
+        if constexpr(element_size == 1) { return 0zu; }
+#ifdef __AVX512BW__
+        return 64zu;
+#elifdef __AVX512F__
+        return element_size == 2 ? 32zu : 64zu;
+#elifdef __AVX2__
+        return 32zu;
+#elifdef __SSE2__
+        return 16zu;
+#else
+        return 0zu;
+#endif
+    }
+
+    /**
+     * @brief x86上64位通道中低32位的无符号乘法
+     *
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto divider_multiply_even(auto a, auto b) noexcept
+    {
+        using vector = decltype(a);
+        using vi32 [[__gnu__::__vector_size__(vector_size)]] = int;
+        using vi64 [[__gnu__::__vector_size__(vector_size)]] = long long;
+        auto va{::std::bit_cast<vi32>(a)};
+        auto vb{::std::bit_cast<vi32>(b)};
+        if constexpr(vector_size == 64) { return ::std::bit_cast<vector>(__builtin_ia32_pmuludq512_mask(va, vb, vi64{}, 0xff)); }  //< avx512f
+        else if constexpr(vector_size == 32) { return ::std::bit_cast<vector>(__builtin_ia32_pmuludq256(va, vb)); }                //< avx2
+        else { return ::std::bit_cast<vector>(__builtin_ia32_pmuludq128(va, vb)); }                                                //< sse2
+    }
+
+    /**
+     * @brief 逐元素计算乘积的高半部分
+     *
+     * @note x86上16位元素使用pmulhw，32位和64位元素由pmuludq合成；超过指令支持大小的向量拆分为两半
+     */
+    template <typename vector>
+    CPPFASTBOX_ALWAYS_INLINE inline vector divider_multiply_high(vector a, ::cppfastbox::detail::divider_element_t<vector> b) noexcept
+    {
+        using element = ::cppfastbox::detail::divider_element_t<vector>;
+        using unsigned_element = ::std::make_unsigned_t<element>;
+        constexpr auto vector_size{sizeof(vector)};
+        constexpr auto element_size{sizeof(element)};
+        constexpr auto max_size{::cppfastbox::detail::divider_multiply_high_max_size<element_size>()};
+        constexpr auto is_signed{::cppfastbox::simd_signed_integral<element>};
+        if constexpr(max_size != 0 && vector_size > max_size)
+        {
+            using half [[__gnu__::__vector_size__(vector_size / 2)]] = element;
+            half low;
+            half high;
+            __builtin_memcpy(&low, &a, vector_size / 2);
+            __builtin_memcpy(&high, reinterpret_cast<const char*>(&a) + vector_size / 2, vector_size / 2);
+            low = ::cppfastbox::detail::divider_multiply_high(low, b);
+            high = ::cppfastbox::detail::divider_multiply_high(high, b);
+            __builtin_memcpy(&a, &low, vector_size / 2);
+            __builtin_memcpy(reinterpret_cast<char*>(&a) + vector_size / 2, &high, vector_size / 2);
+            return a;
+        }
+        else if constexpr(max_size != 0 && vector_size >= 16 && element_size == 2)
+        {
+            using vi16 [[__gnu__::__vector_size__(vector_size)]] = short;
+            auto va{::std::bit_cast<vi16>(a)};
+            vi16 vb{vi16{} + static_cast<short>(b)};
+            if constexpr(vector_size == 64)
+            {
+                if constexpr(is_signed) { return ::std::bit_cast<vector>(__builtin_ia32_pmulhw512_mask(va, vb, vi16{}, -1)); }  //< avx512bw
+                else { return ::std::bit_cast<vector>(__builtin_ia32_pmulhuw512_mask(va, vb, vi16{}, -1)); }                    //< avx512bw
+            }
+            else if constexpr(vector_size == 32)
+            {
+                if constexpr(is_signed) { return ::std::bit_cast<vector>(__builtin_ia32_pmulhw256(va, vb)); }  //< avx2
+                else { return ::std::bit_cast<vector>(__builtin_ia32_pmulhuw256(va, vb)); }                    //< avx2
+            }
+            else
+            {
+                if constexpr(is_signed) { return ::std::bit_cast<vector>(__builtin_ia32_pmulhw128(va, vb)); }  //< sse2
+                else { return ::std::bit_cast<vector>(__builtin_ia32_pmulhuw128(va, vb)); }                    //< sse2
+            }
+        }
+        else if constexpr(max_size != 0 && vector_size >= 16 && element_size >= 4)
+        {
+            using vu64 [[__gnu__::__vector_size__(vector_size)]] = ::std::uint64_t;
+            using unsigned_vector [[__gnu__::__vector_size__(vector_size)]] = unsigned_element;
+            constexpr auto mask{0xffff'ffffull};
+            auto va{::std::bit_cast<vu64>(a)};
+            auto ub{static_cast<unsigned_element>(b)};
+            unsigned_vector high;
+            if constexpr(element_size == 4)
+            {
+                vu64 vb{vu64{} + (::std::uint64_t{ub} << 32 | ub)};
+                // 偶数元素的乘积的高32位在通道的低半部分，奇数元素的在高半部分
+                auto even{::cppfastbox::detail::divider_multiply_even<vector_size>(va, vb)};
+                auto odd{::cppfastbox::detail::divider_multiply_even<vector_size>(va >> 32, vb)};
+                high = ::std::bit_cast<unsigned_vector>(even >> 32 | (odd & ~mask));
+            }
+            else
+            {
+                vu64 b0{vu64{} + (ub & mask)};
+                vu64 b1{vu64{} + (ub >> 32)};
+                vu64 a1{va >> 32};
+                auto p01{::cppfastbox::detail::divider_multiply_even<vector_size>(va, b1)};
+                auto middle{(::cppfastbox::detail::divider_multiply_even<vector_size>(va, b0) >> 32) + (p01 & mask) +
+                            ::cppfastbox::detail::divider_multiply_even<vector_size>(a1, b0)};
+                high = ::cppfastbox::detail::divider_multiply_even<vector_size>(a1, b1) + (p01 >> 32) + (middle >> 32);
+            }
+            if constexpr(is_signed)
+            {
+                // 与标量相同，修正负数的补码
+                constexpr auto bits{static_cast<int>(element_size * 8)};
+                high -= ::std::bit_cast<unsigned_vector>(a >> (bits - 1)) & ub;
+                if(b < 0) { high -= ::std::bit_cast<unsigned_vector>(a); }
+            }
+            return ::std::bit_cast<vector>(high);
+        }
+        else if constexpr(element_size < sizeof(::std::uint64_t))
+        {
+            // 由编译器选择扩展乘法指令，如neon的smull和umull
+            using wide_element = ::cppfastbox::fixed_size_integer_t<is_signed, element_size * 2>;
+            using wide_vector [[__gnu__::__vector_size__(vector_size * 2)]] = wide_element;
+            auto product{__builtin_convertvector(a, wide_vector) * static_cast<wide_element>(b)};
+            return __builtin_convertvector(product >> static_cast<int>(element_size * 8), vector);
+        }
+        else
+        {
+            // 没有64位乘法高位的向量指令，逐元素使用标量乘法
+            using scalar = ::cppfastbox::fixed_size_integer_t<is_signed, element_size>;
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+            for(auto i{0zu}; i < vector_size / element_size; i++)
+            {
+                a[i] = static_cast<element>(::cppfastbox::detail::divider_multiply_high(static_cast<scalar>(a[i]), static_cast<scalar>(b)));
+            }
+            return a;
+        }
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 运行时不变的除数
+     *
+     * @tparam type 除数和被除数的类型
+     * @note 构造时计算魔数和移位数，之后以乘法的高半部分、加减法和移位完成除法；所有除数使用相同的无分支指令序列，
+     * 因此可以整体作用于向量的所有元素。结果与内建的除法相同，向0取整；除数为0时行为未定义
+     * @code {.cpp}
+     * cppfastbox::divider<std::uint32_t> d{7};
+     * auto q{100u / d};  // 14
+     * auto r{100u % d};  // 2
+     * @endcode
+     */
+    template <::cppfastbox::fixed_size_integral type>
+    struct divider
+    {
+    private:
+        using unsigned_type = ::cppfastbox::fixed_size_integer_t<false, sizeof(type)>;
+        constexpr static auto bits{static_cast<int>(sizeof(type) * 8)};
+        constexpr static auto is_signed{::cppfastbox::signed_integral<type>};
+
+        type value{};       //< 除数
+        type magic{};       //< 魔数，有符号数为m - 2^bits
+        type sign{};        //< 除数的符号，仅用于有符号数，负数为-1，否则为0
+        int pre_shift{};    //< 第一次移位数，仅用于无符号数
+        int post_shift{};   //< 最后的移位数
+
+    public:
+        /**
+         * @brief 预先计算除以divisor所需的魔数和移位数
+         *
+         * @param divisor 除数，不能为0
+         */
+        constexpr inline explicit divider(type divisor) noexcept : value{divisor}
+        {
+            if constexpr(is_signed)
+            {
+                auto absolute{static_cast<unsigned_type>(divisor < 0 ? unsigned_type{} - static_cast<unsigned_type>(divisor) : divisor)};
+                sign = divisor < 0 ? type{-1} : type{};
+                if(absolute == 1) { magic = 1; }
+                else
+                {
+                    // l = ceil(log2(|d|))，m = floor(2^(bits + l - 1) / |d|) + 1
+                    auto log{::cppfastbox::detail::divider_bit_width(static_cast<unsigned_type>(absolute - 1))};
+                    auto high{static_cast<unsigned_type>(unsigned_type{1} << (log - 1))};
+                    auto quotient{::cppfastbox::detail::divider_divide_wide(high, absolute)};
+                    magic = static_cast<type>(static_cast<unsigned_type>(quotient + 1));
+                    post_shift = log - 1;
+                }
+            }
+            else
+            {
+                // l = ceil(log2(d))，m = floor(2^bits * (2^l - d) / d) + 1，不超过bits位
+                auto log{::cppfastbox::detail::divider_bit_width(static_cast<unsigned_type>(divisor - 1))};
+                auto power{log == bits ? unsigned_type{} : static_cast<unsigned_type>(unsigned_type{1} << log)};
+                auto high{static_cast<unsigned_type>(power - divisor)};
+                magic = static_cast<type>(::cppfastbox::detail::divider_divide_wide(high, divisor) + 1);
+                pre_shift = log == 0 ? 0 : 1;
+                post_shift = log == 0 ? 0 : log - 1;
+            }
+        }
+
+        // 除数
+        [[nodiscard]] constexpr inline type divisor() const noexcept { return value; }
+
+        /**
+         * @brief 除以除数，向0取整
+         *
+         */
+        [[nodiscard]] constexpr inline type divide(type dividend) const noexcept
+        {
+            auto high{::cppfastbox::detail::divider_multiply_high(dividend, magic)};
+            if constexpr(is_signed)
+            {
+                // 以无符号数运算，除以±1时的溢出回绕后结果正确
+                auto sum{static_cast<unsigned_type>(static_cast<unsigned_type>(dividend) + static_cast<unsigned_type>(high))};
+                auto quotient{static_cast<type>(sum)};
+                auto result{static_cast<unsigned_type>(static_cast<unsigned_type>(quotient >> post_shift) -
+                                                       static_cast<unsigned_type>(dividend >> (bits - 1)))};
+                return static_cast<type>((result ^ static_cast<unsigned_type>(sign)) - static_cast<unsigned_type>(sign));
+            }
+            else { return static_cast<type>((high + static_cast<type>(static_cast<type>(dividend - high) >> pre_shift)) >> post_shift); }
+        }
+
+        /**
+         * @brief 向量的每个元素除以除数，向0取整
+         *
+         * @tparam vector 向量扩展类型，元素与type的宽度和符号相同
+         */
+        template <::cppfastbox::detail::divider_vector<type> vector>
+        [[nodiscard]] inline vector divide(vector dividend) const noexcept
+        {
+            using element = ::cppfastbox::detail::divider_element_t<vector>;
+            using unsigned_element = ::std::make_unsigned_t<element>;
+            using unsigned_vector [[__gnu__::__vector_size__(sizeof(vector))]] = unsigned_element;
+            auto high{::cppfastbox::detail::divider_multiply_high(dividend, static_cast<element>(magic))};
+            if constexpr(is_signed)
+            {
+                auto quotient{::std::bit_cast<vector>(::std::bit_cast<unsigned_vector>(dividend) + ::std::bit_cast<unsigned_vector>(high))};
+                auto result{::std::bit_cast<unsigned_vector>(quotient >> post_shift) - ::std::bit_cast<unsigned_vector>(dividend >> (bits - 1))};
+                auto vsign{static_cast<unsigned_element>(sign)};
+                return ::std::bit_cast<vector>((result ^ vsign) - vsign);
+            }
+            else { return (high + ((dividend - high) >> pre_shift)) >> post_shift; }
+        }
+
+        [[nodiscard]] friend constexpr inline type operator/ (type dividend, const divider& divisor) noexcept
+        {
+            return divisor.divide(dividend);
+        }
+
+        // 余数的符号与被除数相同
+        [[nodiscard]] friend constexpr inline type operator% (type dividend, const divider& divisor) noexcept
+        {
+            auto quotient{static_cast<unsigned_type>(divisor.divide(dividend))};
+            auto product{static_cast<unsigned_type>(quotient * static_cast<unsigned_type>(divisor.value))};
+            return static_cast<type>(static_cast<unsigned_type>(dividend) - product);
+        }
+
+        template <::cppfastbox::detail::divider_vector<type> vector>
+        [[nodiscard]] friend inline vector operator/ (vector dividend, const divider& divisor) noexcept
+        {
+            return divisor.divide(dividend);
+        }
+
+        template <::cppfastbox::detail::divider_vector<type> vector>
+        [[nodiscard]] friend inline vector operator% (vector dividend, const divider& divisor) noexcept
+        {
+            using unsigned_element = ::std::make_unsigned_t<::cppfastbox::detail::divider_element_t<vector>>;
+            using unsigned_vector [[__gnu__::__vector_size__(sizeof(vector))]] = unsigned_element;
+            auto product{::std::bit_cast<unsigned_vector>(divisor.divide(dividend)) * static_cast<unsigned_element>(divisor.value)};
+            return ::std::bit_cast<vector>(::std::bit_cast<unsigned_vector>(dividend) - product);
+        }
+    };
+}  // namespace cppfastbox
@@ -6,6 +6,8 @@
  *
  */
 #pragma once
+#include <bit>
+#include <compare>
 #include <concepts>
 #include <cstdint>
 #include "platform.h"
@@ -19,7 +21,7 @@ namespace cppfastbox
     // 向量builtin和intrinsic中使用的int32_t
     using simd_int32_t = ::std::conditional_t<::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>(), int, int32_t>;
     // 向量builtin和intrinsic中使用的int64_t
-    using simd_int64_t = ::std::conditional_t<::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>(), char, int64_t>;
+    using simd_int64_t = ::std::conditional_t<::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>(), long long, int64_t>;
     // 向量builtin和intrinsic中使用的uint8_t
     using simd_uint8_t = ::std::make_unsigned_t<::cppfastbox::simd_int8_t>;
     // 向量builtin和intrinsic中使用的uint16_t
@@ -135,35 +137,214 @@ namespace cppfastbox::detail
         }
     }
 
-    struct uint128_little_endian
+    /**
+     * @brief 小端机器上128位整数的存储
+     *
+     * @tparam is_signed 是否有符号
+     */
+    template <bool is_signed>
+    struct int128_little_endian
     {
         ::std::uint64_t lo{};
-        ::std::uint64_t hi{};
+        ::std::conditional_t<is_signed, ::std::int64_t, ::std::uint64_t> hi{};
     };
 
-    struct uint128_big_endian
+    /**
+     * @brief 大端机器上128位整数的存储
+     *
+     * @tparam is_signed 是否有符号
+     */
+    template <bool is_signed>
+    struct int128_big_endian
     {
-        ::std::uint64_t hi{};
+        ::std::conditional_t<is_signed, ::std::int64_t, ::std::uint64_t> hi{};
         ::std::uint64_t lo{};
     };
 
-    using uint128_t_impl = ::std::
-        conditional_t<::cppfastbox::is_little_endian, ::cppfastbox::detail::uint128_little_endian, ::cppfastbox::detail::uint128_big_endian>;
+    // 128位整数的存储，成员顺序与原生的128位整数相同
+    template <bool is_signed>
+    using int128_storage = ::std::conditional_t<::cppfastbox::is_little_endian,
+                                                ::cppfastbox::detail::int128_little_endian<is_signed>,
+                                                ::cppfastbox::detail::int128_big_endian<is_signed>>;
+    // 可移植实现使用的无符号128位整数
+    using uint128_storage = ::cppfastbox::detail::int128_storage<false>;
 
-    struct int128_little_endian
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::cppfastbox::detail::uint128_storage make_uint128(::std::uint64_t hi, ::std::uint64_t lo) noexcept
     {
-        ::std::uint64_t lo{};
-        ::std::int64_t hi{};
-    };
+        ::cppfastbox::detail::uint128_storage result{};
+        result.hi = hi;
+        result.lo = lo;
+        return result;
+    }
+}  // namespace cppfastbox::detail
 
-    struct int128_big_endian
+/**
+ * @brief 128位整数运算的可移植实现
+ *
+ * @note 仅使用64位运算，用于不支持__int128扩展的32位和wasm等平台
+ */
+namespace cppfastbox::detail
+{
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_add(::cppfastbox::detail::uint128_storage a,
+                                                                       ::cppfastbox::detail::uint128_storage b) noexcept
     {
-        ::std::int64_t hi{};
-        ::std::uint64_t lo{};
-    };
+        auto lo{a.lo + b.lo};
+        return ::cppfastbox::detail::make_uint128(a.hi + b.hi + (lo < a.lo), lo);
+    }
+
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_subtract(::cppfastbox::detail::uint128_storage a,
+                                                                            ::cppfastbox::detail::uint128_storage b) noexcept
+    {
+        return ::cppfastbox::detail::make_uint128(a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo);
+    }
 
-    using int128_t_impl = ::std::
-        conditional_t<::cppfastbox::is_little_endian, ::cppfastbox::detail::int128_little_endian, ::cppfastbox::detail::int128_big_endian>;
+    // 64位乘法的完整结果，由4次32位乘法合成
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_multiply_64(::std::uint64_t a, ::std::uint64_t b) noexcept
+    {
+        constexpr auto mask{0xffff'ffffu};
+        auto a0{a & mask};
+        auto a1{a >> 32};
+        auto b0{b & mask};
+        auto b1{b >> 32};
+        auto p00{a0 * b0};
+        auto p01{a0 * b1};
+        auto p10{a1 * b0};
+        auto p11{a1 * b1};
+        // 不会溢出：(2^32 - 1)^2 + 2 * (2^32 - 1) = 2^64 - 1
+        auto middle{(p00 >> 32) + (p01 & mask) + p10};
+        return ::cppfastbox::detail::make_uint128(p11 + (p01 >> 32) + (middle >> 32), middle << 32 | (p00 & mask));
+    }
+
+    // 乘积的低128位
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_multiply(::cppfastbox::detail::uint128_storage a,
+                                                                            ::cppfastbox::detail::uint128_storage b) noexcept
+    {
+        auto result{::cppfastbox::detail::uint128_multiply_64(a.lo, b.lo)};
+        result.hi += a.lo * b.hi + a.hi * b.lo;
+        return result;
+    }
+
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_shift_left(::cppfastbox::detail::uint128_storage value, int shift) noexcept
+    {
+        if(shift >= 64) { return ::cppfastbox::detail::make_uint128(value.lo << (shift - 64), 0); }
+        else if(shift == 0) { return value; }
+        else { return ::cppfastbox::detail::make_uint128(value.hi << shift | value.lo >> (64 - shift), value.lo << shift); }
+    }
+
+    /**
+     * @brief 右移
+     *
+     * @tparam arithmetic 是否为算术右移
+     */
+    template <bool arithmetic>
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_shift_right(::cppfastbox::detail::uint128_storage value, int shift) noexcept
+    {
+        // 算术右移时高位填充的值
+        auto fill{arithmetic ? static_cast<::std::uint64_t>(static_cast<::std::int64_t>(value.hi) >> 63) : 0};
+        if(shift >= 64)
+        {
+            auto hi{arithmetic ? static_cast<::std::uint64_t>(static_cast<::std::int64_t>(value.hi) >> (shift - 64)) : value.hi >> (shift - 64)};
+            return ::cppfastbox::detail::make_uint128(fill, hi);
+        }
+        else if(shift == 0) { return value; }
+        else
+        {
+            auto hi{arithmetic ? static_cast<::std::uint64_t>(static_cast<::std::int64_t>(value.hi) >> shift) : value.hi >> shift};
+            return ::cppfastbox::detail::make_uint128(hi, value.lo >> shift | value.hi << (64 - shift));
+        }
+    }
+
+    /**
+     * @brief 128位除以64位，商不超过64位
+     *
+     * @param hi 被除数的高64位，必须小于divisor
+     * @param lo 被除数的低64位
+     * @param remainder 余数
+     * @return 商
+     * @note 规格化后以两次64位除以32位完成，见Hacker's Delight 9-3的divlu
+     */
+    constexpr inline ::std::uint64_t
+        uint128_divide_64(::std::uint64_t hi, ::std::uint64_t lo, ::std::uint64_t divisor, ::std::uint64_t& remainder) noexcept
+    {
+        constexpr auto base{1ull << 32};
+        constexpr auto mask{base - 1};
+        auto shift{::std::countl_zero(divisor)};
+        divisor <<= shift;
+        auto divisor1{divisor >> 32};
+        auto divisor0{divisor & mask};
+        auto numerator32{shift == 0 ? hi : hi << shift | lo >> (64 - shift)};
+        auto numerator10{lo << shift};
+        auto numerator1{numerator10 >> 32};
+        auto numerator0{numerator10 & mask};
+        // 每次试商最多修正2次
+        auto quotient1{numerator32 / divisor1};
+        auto rest{numerator32 - quotient1 * divisor1};
+        while(quotient1 >= base || quotient1 * divisor0 > (rest << 32 | numerator1))
+        {
+            quotient1--;
+            rest += divisor1;
+            if(rest >= base) { break; }
+        }
+        auto numerator21{(numerator32 << 32 | numerator1) - quotient1 * divisor};
+        auto quotient0{numerator21 / divisor1};
+        rest = numerator21 - quotient0 * divisor1;
+        while(quotient0 >= base || quotient0 * divisor0 > (rest << 32 | numerator0))
+        {
+            quotient0--;
+            rest += divisor1;
+            if(rest >= base) { break; }
+        }
+        remainder = ((numerator21 << 32 | numerator0) - quotient0 * divisor) >> shift;
+        return quotient1 << 32 | quotient0;
+    }
+
+    /**
+     * @brief 无符号128位除法
+     *
+     * @param remainder 余数
+     * @return 商
+     * @note 除数超过64位时商不超过64位，由规格化的除数的高64位估计后至多修正一次，见Hacker's Delight 9-5
+     */
+    constexpr inline ::cppfastbox::detail::uint128_storage uint128_divide(::cppfastbox::detail::uint128_storage dividend,
+                                                                          ::cppfastbox::detail::uint128_storage divisor,
+                                                                          ::cppfastbox::detail::uint128_storage& remainder) noexcept
+    {
+        if(divisor.hi == 0)
+        {
+            ::std::uint64_t rest{};
+            if(dividend.hi == 0)
+            {
+                remainder = ::cppfastbox::detail::make_uint128(0, dividend.lo % divisor.lo);
+                return ::cppfastbox::detail::make_uint128(0, dividend.lo / divisor.lo);
+            }
+            else if(dividend.hi < divisor.lo)
+            {
+                auto quotient{::cppfastbox::detail::uint128_divide_64(dividend.hi, dividend.lo, divisor.lo, rest)};
+                remainder = ::cppfastbox::detail::make_uint128(0, rest);
+                return ::cppfastbox::detail::make_uint128(0, quotient);
+            }
+            else
+            {
+                auto quotient{::cppfastbox::detail::uint128_divide_64(dividend.hi % divisor.lo, dividend.lo, divisor.lo, rest)};
+                remainder = ::cppfastbox::detail::make_uint128(0, rest);
+                return ::cppfastbox::detail::make_uint128(dividend.hi / divisor.lo, quotient);
+            }
+        }
+        auto shift{::std::countl_zero(divisor.hi)};
+        auto normalized{::cppfastbox::detail::uint128_shift_left(divisor, shift).hi};
+        auto half{::cppfastbox::detail::uint128_shift_right<false>(dividend, 1)};
+        ::std::uint64_t rest{};
+        auto quotient{::cppfastbox::detail::uint128_divide_64(half.hi, half.lo, normalized, rest) >> (63 - shift)};
+        if(quotient != 0) { quotient--; }
+        auto product{::cppfastbox::detail::uint128_multiply(::cppfastbox::detail::make_uint128(0, quotient), divisor)};
+        remainder = ::cppfastbox::detail::uint128_subtract(dividend, product);
+        if(remainder.hi > divisor.hi || (remainder.hi == divisor.hi && remainder.lo >= divisor.lo))
+        {
+            quotient++;
+            remainder = ::cppfastbox::detail::uint128_subtract(remainder, divisor);
+        }
+        return ::cppfastbox::detail::make_uint128(0, quotient);
+    }
 }  // namespace cppfastbox::detail
 
 namespace cppfastbox
@@ -201,17 +382,312 @@ namespace cppfastbox
     using to_fixed_size_character_t = ::cppfastbox::fixed_size_character_t<sizeof(type)>;
 
     /**
-     * @brief 通过内建类型合成的__uint128_t
+     * @brief 128位整数
      *
-     * @note 在不支持__int128扩展的机器上为void
+     * @tparam is_signed 是否有符号
+     * @note 内存布局与原生的128位整数相同；支持__int128扩展时由原生类型运算，否则以64位运算实现；
+     * 加、减、乘、取负和左移在溢出时回绕；除以0和移位位数不在[0, 128)内时行为未定义
      */
-    using uint128_t = ::std::conditional_t<::cppfastbox::int128_support, ::cppfastbox::detail::uint128_t_impl, void>;
+    template <bool is_signed>
+    struct basic_int128 : ::cppfastbox::detail::int128_storage<is_signed>
+    {
+    private:
+        using native_type = ::std::conditional_t<is_signed, ::cppfastbox::native_int128_t, ::cppfastbox::native_uint128_t>;
+        using high_type = ::std::conditional_t<is_signed, ::std::int64_t, ::std::uint64_t>;
+
+        CPPFASTBOX_ALWAYS_INLINE constexpr explicit basic_int128(::cppfastbox::detail::uint128_storage value) noexcept
+        {
+            this->hi = static_cast<high_type>(value.hi);
+            this->lo = value.lo;
+        }
+
+        CPPFASTBOX_ALWAYS_INLINE constexpr ::cppfastbox::detail::uint128_storage to_storage() const noexcept
+        {
+            return ::cppfastbox::detail::make_uint128(static_cast<::std::uint64_t>(this->hi), this->lo);
+        }
+
+#ifdef __SIZEOF_INT128__
+        // 原生的无符号128位整数，有符号数的运算也以无符号数完成以保证溢出时回绕
+        CPPFASTBOX_ALWAYS_INLINE constexpr ::cppfastbox::native_uint128_t to_native() const noexcept
+        {
+            return static_cast<::cppfastbox::native_uint128_t>(static_cast<::std::uint64_t>(this->hi)) << 64 | this->lo;
+        }
+
+        CPPFASTBOX_ALWAYS_INLINE constexpr static basic_int128 from_native(::cppfastbox::native_uint128_t value) noexcept
+        {
+            return basic_int128{
+                ::cppfastbox::detail::make_uint128(static_cast<::std::uint64_t>(value >> 64), static_cast<::std::uint64_t>(value))};
+        }
+#endif
+
+        // 有符号数的绝对值
+        CPPFASTBOX_ALWAYS_INLINE constexpr ::cppfastbox::detail::uint128_storage magnitude() const noexcept
+        {
+            if constexpr(is_signed)
+            {
+                if(this->hi < 0) { return (-*this).to_storage(); }
+            }
+            return to_storage();
+        }
+
+        CPPFASTBOX_ALWAYS_INLINE constexpr static ::cppfastbox::detail::uint128_storage
+            divide(::cppfastbox::detail::uint128_storage a,
+                   ::cppfastbox::detail::uint128_storage b,
+                   ::cppfastbox::detail::uint128_storage& remainder) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            auto native_a{basic_int128{a}.to_native()};
+            auto native_b{basic_int128{b}.to_native()};
+            remainder = from_native(native_a % native_b).to_storage();
+            return from_native(native_a / native_b).to_storage();
+#else
+            return ::cppfastbox::detail::uint128_divide(a, b, remainder);
+#endif
+        }
+
+        template <bool>
+        friend struct ::cppfastbox::basic_int128;
+
+    public:
+        constexpr inline basic_int128() noexcept = default;
+
+        /**
+         * @brief 从高64位和低64位构造
+         *
+         */
+        constexpr inline basic_int128(high_type high, ::std::uint64_t low) noexcept
+        {
+            this->hi = high;
+            this->lo = low;
+        }
+
+        /**
+         * @brief 从整数构造，有符号整数进行符号扩展
+         *
+         */
+        template <::cppfastbox::integral type>
+        constexpr inline basic_int128(type value) noexcept
+        {
+            if constexpr(sizeof(type) > sizeof(::std::uint64_t))
+            {
+                this->hi = static_cast<high_type>(value >> 64);
+                this->lo = static_cast<::std::uint64_t>(value);
+            }
+            else
+            {
+                if constexpr(::cppfastbox::signed_integral<type>) { this->hi = value < 0 ? static_cast<high_type>(-1) : high_type{}; }
+                this->lo = static_cast<::std::uint64_t>(value);
+            }
+        }
+
+        /**
+         * @brief 从另一符号的128位整数构造，保持位表示不变
+         *
+         */
+        constexpr inline explicit basic_int128(::cppfastbox::basic_int128<!is_signed> other) noexcept
+        {
+            this->hi = static_cast<high_type>(other.hi);
+            this->lo = other.lo;
+        }
+
+        /**
+         * @brief 转换为整数，截断高位
+         *
+         * @note 转换为bool时判断是否不为0
+         */
+        template <::cppfastbox::integral type>
+        constexpr inline explicit operator type() const noexcept
+        {
+            if constexpr(::std::same_as<type, bool>) { return (this->lo | static_cast<::std::uint64_t>(this->hi)) != 0; }
+            else if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { return static_cast<type>(static_cast<type>(this->hi) << 64 | this->lo); }
+            else { return static_cast<type>(this->lo); }
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator+ (basic_int128 a, basic_int128 b) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return from_native(a.to_native() + b.to_native());
+#else
+            return basic_int128{::cppfastbox::detail::uint128_add(a.to_storage(), b.to_storage())};
+#endif
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator- (basic_int128 a, basic_int128 b) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return from_native(a.to_native() - b.to_native());
+#else
+            return basic_int128{::cppfastbox::detail::uint128_subtract(a.to_storage(), b.to_storage())};
+#endif
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator* (basic_int128 a, basic_int128 b) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return from_native(a.to_native() * b.to_native());
+#else
+            return basic_int128{::cppfastbox::detail::uint128_multiply(a.to_storage(), b.to_storage())};
+#endif
+        }
+
+        // 向0取整
+        [[nodiscard]] friend constexpr inline basic_int128 operator/ (basic_int128 a, basic_int128 b) noexcept
+        {
+            ::cppfastbox::detail::uint128_storage remainder{};
+            basic_int128 quotient{divide(a.magnitude(), b.magnitude(), remainder)};
+            if constexpr(is_signed)
+            {
+                if((a.hi ^ b.hi) < 0) { quotient = -quotient; }
+            }
+            return quotient;
+        }
+
+        // 余数的符号与被除数相同
+        [[nodiscard]] friend constexpr inline basic_int128 operator% (basic_int128 a, basic_int128 b) noexcept
+        {
+            ::cppfastbox::detail::uint128_storage remainder{};
+            divide(a.magnitude(), b.magnitude(), remainder);
+            basic_int128 result{remainder};
+            if constexpr(is_signed)
+            {
+                if(a.hi < 0) { result = -result; }
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator& (basic_int128 a, basic_int128 b) noexcept
+        {
+            return basic_int128{static_cast<high_type>(a.hi & b.hi), a.lo & b.lo};
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator| (basic_int128 a, basic_int128 b) noexcept
+        {
+            return basic_int128{static_cast<high_type>(a.hi | b.hi), a.lo | b.lo};
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator^ (basic_int128 a, basic_int128 b) noexcept
+        {
+            return basic_int128{static_cast<high_type>(a.hi ^ b.hi), a.lo ^ b.lo};
+        }
+
+        [[nodiscard]] friend constexpr inline basic_int128 operator<< (basic_int128 value, int shift) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            return from_native(value.to_native() << shift);
+#else
+            return basic_int128{::cppfastbox::detail::uint128_shift_left(value.to_storage(), shift)};
+#endif
+        }
+
+        // 有符号数为算术右移
+        [[nodiscard]] friend constexpr inline basic_int128 operator>> (basic_int128 value, int shift) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            if constexpr(is_signed)
+            {
+                auto result{static_cast<::cppfastbox::native_int128_t>(value.to_native()) >> shift};
+                return from_native(static_cast<::cppfastbox::native_uint128_t>(result));
+            }
+            else { return from_native(value.to_native() >> shift); }
+#else
+            return basic_int128{::cppfastbox::detail::uint128_shift_right<is_signed>(value.to_storage(), shift)};
+#endif
+        }
+
+        [[nodiscard]] constexpr inline basic_int128 operator+ () const noexcept { return *this; }
+
+        [[nodiscard]] constexpr inline basic_int128 operator- () const noexcept { return basic_int128{} - *this; }
+
+        [[nodiscard]] constexpr inline basic_int128 operator~ () const noexcept
+        {
+            return basic_int128{static_cast<high_type>(~this->hi), ~this->lo};
+        }
+
+        [[nodiscard]] friend constexpr inline bool operator== (basic_int128 a, basic_int128 b) noexcept
+        {
+            return a.hi == b.hi && a.lo == b.lo;
+        }
+
+        [[nodiscard]] friend constexpr inline ::std::strong_ordering operator<=> (basic_int128 a, basic_int128 b) noexcept
+        {
+            if(a.hi != b.hi) { return a.hi <=> b.hi; }
+            else { return a.lo <=> b.lo; }
+        }
+
+        constexpr inline basic_int128& operator+= (basic_int128 other) noexcept { return *this = *this + other; }
+
+        constexpr inline basic_int128& operator-= (basic_int128 other) noexcept { return *this = *this - other; }
+
+        constexpr inline basic_int128& operator*= (basic_int128 other) noexcept { return *this = *this * other; }
+
+        constexpr inline basic_int128& operator/= (basic_int128 other) noexcept { return *this = *this / other; }
+
+        constexpr inline basic_int128& operator%= (basic_int128 other) noexcept { return *this = *this % other; }
+
+        constexpr inline basic_int128& operator&= (basic_int128 other) noexcept { return *this = *this & other; }
+
+        constexpr inline basic_int128& operator|= (basic_int128 other) noexcept { return *this = *this | other; }
+
+        constexpr inline basic_int128& operator^= (basic_int128 other) noexcept { return *this = *this ^ other; }
+
+        constexpr inline basic_int128& operator<<= (int shift) noexcept { return *this = *this << shift; }
+
+        constexpr inline basic_int128& operator>>= (int shift) noexcept { return *this = *this >> shift; }
+
+        constexpr inline basic_int128& operator++ () noexcept { return *this += 1; }
+
+        constexpr inline basic_int128& operator-- () noexcept { return *this -= 1; }
+
+        constexpr inline basic_int128 operator++ (int) noexcept
+        {
+            auto old{*this};
+            ++*this;
+            return old;
+        }
+
+        constexpr inline basic_int128 operator-- (int) noexcept
+        {
+            auto old{*this};
+            --*this;
+            return old;
+        }
+    };
+
+    /**
+     * @brief 无符号128位整数
+     *
+     * @note 不依赖__int128扩展
+     */
+    using uint128_t = ::cppfastbox::basic_int128<false>;
     /**
-     * @brief 通过内建类型合成的__int128_t
+     * @brief 有符号128位整数
      *
-     * @note 在不支持__int128扩展的机器上为void
+     * @note 不依赖__int128扩展
      */
-    using int128_t = ::std::conditional_t<::cppfastbox::int128_support, ::cppfastbox::detail::int128_t_impl, void>;
+    using int128_t = ::cppfastbox::basic_int128<true>;
+
+    /**
+     * @brief 64位乘法的完整结果
+     *
+     * @note 支持__int128扩展时编译为单条乘法指令，x86 BMI2下为mulx
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::cppfastbox::uint128_t wide_multiply(::std::uint64_t a, ::std::uint64_t b) noexcept
+    {
+#ifdef __SIZEOF_INT128__
+        auto product{static_cast<::cppfastbox::native_uint128_t>(a) * b};
+        return ::cppfastbox::uint128_t{static_cast<::std::uint64_t>(product >> 64), static_cast<::std::uint64_t>(product)};
+#else
+        auto product{::cppfastbox::detail::uint128_multiply_64(a, b)};
+        return ::cppfastbox::uint128_t{product.hi, product.lo};
+#endif
+    }
+
+    // 从最高位开始连续的0的个数
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline int countl_zero(::cppfastbox::uint128_t value) noexcept
+    {
+        if(value.hi != 0) { return ::std::countl_zero(value.hi); }
+        else { return 64 + ::std::countl_zero(value.lo); }
+    }
 }  // namespace cppfastbox
 
 namespace cppfastbox
@@ -0,0 +1,496 @@
+/**
+ * @file wide_uint.h
+ * @brief 定宽的无符号大整数
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <compare>
+#include "utility.h"
+
+/**
+ * @brief 以64位limb数组表示的大整数运算
+ *
+ * @note limb数均为编译期常量，循环可被完全展开；比较、加减法、乘法和countl_zero的执行路径与操作数的值无关，移位的执行路径取决于移位的位数
+ */
+namespace cppfastbox::detail
+{
+    // limb数不小于此值且为偶数时使用Karatsuba乘法
+    constexpr inline auto karatsuba_threshold{16zu};
+
+    /**
+     * @brief 带进位的加法
+     *
+     * @param result a + b + carry的低64位
+     * @return 进位
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline bool add_carry(::std::uint64_t a, ::std::uint64_t b, bool carry, ::std::uint64_t& result) noexcept
+    {
+#ifdef CPPFASTBOX_X64
+        if !consteval
+        {
+            unsigned long long sum;
+            auto carry_out{__builtin_ia32_addcarryx_u64(carry, a, b, &sum)};
+            result = sum;
+            return carry_out != 0;
+        }
+#endif
+        auto sum{a + b};
+        result = sum + carry;
+        return (sum < a) | (result < sum);
+    }
+
+    /**
+     * @brief 带借位的减法
+     *
+     * @param result a - b - borrow的低64位
+     * @return 借位
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline bool
+        subtract_borrow(::std::uint64_t a, ::std::uint64_t b, bool borrow, ::std::uint64_t& result) noexcept
+    {
+#ifdef CPPFASTBOX_X64
+        if !consteval
+        {
+            unsigned long long difference;
+            auto borrow_out{__builtin_ia32_sbb_u64(borrow, a, b, &difference)};
+            result = difference;
+            return borrow_out != 0;
+        }
+#endif
+        auto difference{a - b};
+        result = difference - borrow;
+        return (a < b) | (difference < static_cast<::std::uint64_t>(borrow));
+    }
+
+    /**
+     * @brief result = a + b
+     *
+     * @return 最高位的进位
+     * @note result可以与a或b相同
+     */
+    template <::std::size_t n>
+    constexpr inline bool wide_add(::std::uint64_t* result, const ::std::uint64_t* a, const ::std::uint64_t* b) noexcept
+    {
+        bool carry{};
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+        for(auto i{0zu}; i < n; i++) { carry = ::cppfastbox::detail::add_carry(a[i], b[i], carry, result[i]); }
+        return carry;
+    }
+
+    /**
+     * @brief result = a - b
+     *
+     * @return 最高位的借位
+     * @note result可以与a或b相同
+     */
+    template <::std::size_t n>
+    constexpr inline bool wide_subtract(::std::uint64_t* result, const ::std::uint64_t* a, const ::std::uint64_t* b) noexcept
+    {
+        bool borrow{};
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+        for(auto i{0zu}; i < n; i++) { borrow = ::cppfastbox::detail::subtract_borrow(a[i], b[i], borrow, result[i]); }
+        return borrow;
+    }
+
+    /**
+     * @brief 将value加到result上并传播进位
+     *
+     * @return 最高位的进位
+     */
+    template <::std::size_t n>
+    constexpr inline bool wide_add_limb(::std::uint64_t* result, ::std::uint64_t value) noexcept
+    {
+        auto carry{::cppfastbox::detail::add_carry(result[0], value, false, result[0])};
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+        for(auto i{1zu}; i < n; i++) { carry = ::cppfastbox::detail::add_carry(result[i], 0, carry, result[i]); }
+        return carry;
+    }
+
+    /**
+     * @brief 以教科书方法计算乘积的低count个limb
+     *
+     * @tparam n a和b的limb数
+     * @tparam count 结果的limb数，不超过2n；只计算影响结果的部分积
+     */
+    template <::std::size_t n, ::std::size_t count>
+    constexpr inline void wide_multiply_schoolbook(::std::uint64_t* result, const ::std::uint64_t* a, const ::std::uint64_t* b) noexcept
+    {
+        constexpr auto rows{n < count ? n : count};
+        for(auto i{0zu}; i < count; i++) { result[i] = 0; }
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+        for(auto i{0zu}; i < rows; i++)
+        {
+            ::std::uint64_t carry{};
+            auto limit{::cppfastbox::min(n, count - i)};
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 64
+#endif
+            for(auto j{0zu}; j < limit; j++)
+            {
+                // 不会溢出：(2^64 - 1)^2 + 2 * (2^64 - 1) = 2^128 - 1
+                auto product{::cppfastbox::wide_multiply(a[j], b[i])};
+                product += result[i + j];
+                product += carry;
+                result[i + j] = product.lo;
+                carry = product.hi;
+            }
+            if(i + n < count) { result[i + n] = carry; }
+        }
+    }
+
+    /**
+     * @brief 计算完整的2n个limb的乘积
+     *
+     * @note 超过karatsuba_threshold时以Karatsuba方法将4次半长乘法减少为3次
+     */
+    template <::std::size_t n>
+    constexpr inline void wide_multiply_full(::std::uint64_t* result, const ::std::uint64_t* a, const ::std::uint64_t* b) noexcept
+    {
+        if constexpr(n < ::cppfastbox::detail::karatsuba_threshold || n % 2 != 0)
+        {
+            ::cppfastbox::detail::wide_multiply_schoolbook<n, 2 * n>(result, a, b);
+        }
+        else
+        {
+            constexpr auto half{n / 2};
+            // a0 * b0和a1 * b1
+            ::cppfastbox::detail::wide_multiply_full<half>(result, a, b);
+            ::cppfastbox::detail::wide_multiply_full<half>(result + n, a + half, b + half);
+            // (a0 + a1) * (b0 + b1)，和的进位以掩码参与运算，不引入分支
+            ::std::uint64_t sum_a[half]{};
+            ::std::uint64_t sum_b[half]{};
+            auto carry_a{::cppfastbox::detail::wide_add<half>(sum_a, a, a + half)};
+            auto carry_b{::cppfastbox::detail::wide_add<half>(sum_b, b, b + half)};
+            ::std::uint64_t middle[n]{};
+            ::cppfastbox::detail::wide_multiply_full<half>(middle, sum_a, sum_b);
+            ::std::uint64_t masked_a[half]{};
+            ::std::uint64_t masked_b[half]{};
+            for(auto i{0zu}; i < half; i++)
+            {
+                masked_a[i] = sum_a[i] & (0 - static_cast<::std::uint64_t>(carry_b));
+                masked_b[i] = sum_b[i] & (0 - static_cast<::std::uint64_t>(carry_a));
+            }
+            ::std::uint64_t top{static_cast<::std::uint64_t>(carry_a & carry_b)};
+            top += ::cppfastbox::detail::wide_add<half>(middle + half, middle + half, masked_a);
+            top += ::cppfastbox::detail::wide_add<half>(middle + half, middle + half, masked_b);
+            // 减去a0 * b0和a1 * b1得到a0 * b1 + a1 * b0
+            top -= ::cppfastbox::detail::wide_subtract<n>(middle, middle, result);
+            top -= ::cppfastbox::detail::wide_subtract<n>(middle, middle, result + n);
+            auto carry{::cppfastbox::detail::wide_add<n>(result + half, result + half, middle)};
+            ::cppfastbox::detail::wide_add_limb<half>(result + n + half, top + carry);
+        }
+    }
+
+    /**
+     * @brief 计算乘积的低n个limb
+     *
+     * @note 超过karatsuba_threshold时低半部分的乘积使用Karatsuba方法，交叉项只需要低半部分
+     */
+    template <::std::size_t n>
+    constexpr inline void wide_multiply_low(::std::uint64_t* result, const ::std::uint64_t* a, const ::std::uint64_t* b) noexcept
+    {
+        if constexpr(n < ::cppfastbox::detail::karatsuba_threshold || n % 2 != 0)
+        {
+            ::cppfastbox::detail::wide_multiply_schoolbook<n, n>(result, a, b);
+        }
+        else
+        {
+            constexpr auto half{n / 2};
+            ::cppfastbox::detail::wide_multiply_full<half>(result, a, b);
+            ::std::uint64_t cross[half]{};
+            ::cppfastbox::detail::wide_multiply_low<half>(cross, a, b + half);
+            ::cppfastbox::detail::wide_add<half>(result + half, result + half, cross);
+            ::cppfastbox::detail::wide_multiply_low<half>(cross, a + half, b);
+            ::cppfastbox::detail::wide_add<half>(result + half, result + half, cross);
+        }
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 定宽的无符号大整数
+     *
+     * @tparam bits 位数，必须是64的倍数
+     * @note 不进行堆分配；limbs按从低到高的顺序存储，与端序无关；加、减、乘和左移在溢出时回绕；
+     * ==、<=>、加减法和乘法的执行路径与操作数的值无关
+     */
+    template <::std::size_t bits>
+        requires (bits != 0 && bits % 64 == 0)
+    struct wide_uint
+    {
+        constexpr static auto limb_count{bits / 64};
+
+        ::std::uint64_t limbs[limb_count]{};
+
+        constexpr inline wide_uint() noexcept = default;
+
+        /**
+         * @brief 从整数构造
+         *
+         * @note 与内建类型的转换相同，负数按补码表示进行符号扩展
+         */
+        template <::cppfastbox::integral type>
+        constexpr inline wide_uint(type value) noexcept
+        {
+            ::std::uint64_t fill{};
+            if constexpr(::cppfastbox::signed_integral<type>) { fill = value < 0 ? ~0ull : 0; }
+            limbs[0] = static_cast<::std::uint64_t>(value);
+            for(auto i{1zu}; i < limb_count; i++) { limbs[i] = fill; }
+            if constexpr(sizeof(type) > sizeof(::std::uint64_t) && limb_count > 1) { limbs[1] = static_cast<::std::uint64_t>(value >> 64); }
+        }
+
+        constexpr inline wide_uint(::cppfastbox::uint128_t value) noexcept
+        {
+            limbs[0] = value.lo;
+            if constexpr(limb_count > 1) { limbs[1] = value.hi; }
+        }
+
+        /**
+         * @brief 从其他宽度的大整数构造，截断或以0扩展
+         *
+         */
+        template <::std::size_t other_bits>
+        constexpr inline explicit(other_bits > bits) wide_uint(const ::cppfastbox::wide_uint<other_bits>& other) noexcept
+        {
+            constexpr auto count{::cppfastbox::min(limb_count, ::cppfastbox::wide_uint<other_bits>::limb_count)};
+            for(auto i{0zu}; i < count; i++) { limbs[i] = other.limbs[i]; }
+        }
+
+        /**
+         * @brief 转换为整数，截断高位
+         *
+         * @note 转换为bool时判断是否不为0
+         */
+        template <::cppfastbox::integral type>
+        constexpr inline explicit operator type() const noexcept
+        {
+            if constexpr(::std::same_as<type, bool>) { return *this != wide_uint{}; }
+            else if constexpr(sizeof(type) > sizeof(::std::uint64_t) && limb_count > 1)
+            {
+                return static_cast<type>(static_cast<type>(limbs[1]) << 64 | limbs[0]);
+            }
+            else { return static_cast<type>(limbs[0]); }
+        }
+
+        // 转换为128位整数，截断高位
+        constexpr inline explicit operator ::cppfastbox::uint128_t() const noexcept
+        {
+            if constexpr(limb_count > 1) { return ::cppfastbox::uint128_t{limbs[1], limbs[0]}; }
+            else { return limbs[0]; }
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator+ (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            ::cppfastbox::detail::wide_add<limb_count>(result.limbs, a.limbs, b.limbs);
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator- (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            ::cppfastbox::detail::wide_subtract<limb_count>(result.limbs, a.limbs, b.limbs);
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator* (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            ::cppfastbox::detail::wide_multiply_low<limb_count>(result.limbs, a.limbs, b.limbs);
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator& (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            for(auto i{0zu}; i < limb_count; i++) { result.limbs[i] = a.limbs[i] & b.limbs[i]; }
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator| (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            for(auto i{0zu}; i < limb_count; i++) { result.limbs[i] = a.limbs[i] | b.limbs[i]; }
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr inline wide_uint operator^ (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            wide_uint result;
+            for(auto i{0zu}; i < limb_count; i++) { result.limbs[i] = a.limbs[i] ^ b.limbs[i]; }
+            return result;
+        }
+
+        /**
+         * @brief 左移
+         *
+         * @param shift 移位的位数，必须在[0, bits)内
+         */
+        [[nodiscard]] friend constexpr inline wide_uint operator<< (const wide_uint& value, int shift) noexcept
+        {
+            wide_uint result;
+            auto limb_shift{static_cast<::std::size_t>(shift) / 64};
+            auto bit_shift{static_cast<unsigned>(shift) % 64};
+            for(auto i{limb_shift}; i < limb_count; i++)
+            {
+                auto limb{value.limbs[i - limb_shift] << bit_shift};
+                if(bit_shift != 0 && i > limb_shift) { limb |= value.limbs[i - limb_shift - 1] >> (64 - bit_shift); }
+                result.limbs[i] = limb;
+            }
+            return result;
+        }
+
+        /**
+         * @brief 逻辑右移
+         *
+         * @param shift 移位的位数，必须在[0, bits)内
+         */
+        [[nodiscard]] friend constexpr inline wide_uint operator>> (const wide_uint& value, int shift) noexcept
+        {
+            wide_uint result;
+            auto limb_shift{static_cast<::std::size_t>(shift) / 64};
+            auto bit_shift{static_cast<unsigned>(shift) % 64};
+            for(auto i{0zu}; i + limb_shift < limb_count; i++)
+            {
+                auto limb{value.limbs[i + limb_shift] >> bit_shift};
+                if(bit_shift != 0 && i + limb_shift + 1 < limb_count) { limb |= value.limbs[i + limb_shift + 1] << (64 - bit_shift); }
+                result.limbs[i] = limb;
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr inline wide_uint operator+ () const noexcept { return *this; }
+
+        [[nodiscard]] constexpr inline wide_uint operator- () const noexcept { return wide_uint{} - *this; }
+
+        [[nodiscard]] constexpr inline wide_uint operator~ () const noexcept
+        {
+            wide_uint result;
+            for(auto i{0zu}; i < limb_count; i++) { result.limbs[i] = ~limbs[i]; }
+            return result;
+        }
+
+        // 不提前退出，比较时间与操作数的值无关
+        [[nodiscard]] friend constexpr inline bool operator== (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            ::std::uint64_t difference{};
+            for(auto i{0zu}; i < limb_count; i++) { difference |= a.limbs[i] ^ b.limbs[i]; }
+            return difference == 0;
+        }
+
+        // 由a - b的借位和差是否为0得出结果，比较时间与操作数的值无关
+        [[nodiscard]] friend constexpr inline ::std::strong_ordering operator<=> (const wide_uint& a, const wide_uint& b) noexcept
+        {
+            ::std::uint64_t difference[limb_count]{};
+            auto borrow{::cppfastbox::detail::wide_subtract<limb_count>(difference, a.limbs, b.limbs)};
+            ::std::uint64_t any{};
+            for(auto i{0zu}; i < limb_count; i++) { any |= difference[i]; }
+            // 有借位时为负，否则差不为0时为正，不引入分支
+            auto sign{static_cast<int>(any != 0) - 2 * static_cast<int>(borrow)};
+            return sign <=> 0;
+        }
+
+        constexpr inline wide_uint& operator+= (const wide_uint& other) noexcept
+        {
+            ::cppfastbox::detail::wide_add<limb_count>(limbs, limbs, other.limbs);
+            return *this;
+        }
+
+        constexpr inline wide_uint& operator-= (const wide_uint& other) noexcept
+        {
+            ::cppfastbox::detail::wide_subtract<limb_count>(limbs, limbs, other.limbs);
+            return *this;
+        }
+
+        constexpr inline wide_uint& operator*= (const wide_uint& other) noexcept { return *this = *this * other; }
+
+        constexpr inline wide_uint& operator&= (const wide_uint& other) noexcept { return *this = *this & other; }
+
+        constexpr inline wide_uint& operator|= (const wide_uint& other) noexcept { return *this = *this | other; }
+
+        constexpr inline wide_uint& operator^= (const wide_uint& other) noexcept { return *this = *this ^ other; }
+
+        constexpr inline wide_uint& operator<<= (int shift) noexcept { return *this = *this << shift; }
+
+        constexpr inline wide_uint& operator>>= (int shift) noexcept { return *this = *this >> shift; }
+
+        constexpr inline wide_uint& operator++ () noexcept
+        {
+            ::cppfastbox::detail::wide_add_limb<limb_count>(limbs, 1);
+            return *this;
+        }
+
+        constexpr inline wide_uint& operator-- () noexcept { return *this -= 1u; }
+
+        constexpr inline wide_uint operator++ (int) noexcept
+        {
+            auto old{*this};
+            ++*this;
+            return old;
+        }
+
+        constexpr inline wide_uint operator-- (int) noexcept
+        {
+            auto old{*this};
+            --*this;
+            return old;
+        }
+    };
+
+    // 256位无符号整数
+    using uint256_t = ::cppfastbox::wide_uint<256>;
+    // 512位无符号整数
+    using uint512_t = ::cppfastbox::wide_uint<512>;
+
+    /**
+     * @brief 乘法的完整结果
+     *
+     */
+    template <::std::size_t bits>
+    constexpr inline ::cppfastbox::wide_uint<bits * 2> wide_multiply(const ::cppfastbox::wide_uint<bits>& a,
+                                                                     const ::cppfastbox::wide_uint<bits>& b) noexcept
+    {
+        ::cppfastbox::wide_uint<bits * 2> result;
+        ::cppfastbox::detail::wide_multiply_full<::cppfastbox::wide_uint<bits>::limb_count>(result.limbs, a.limbs, b.limbs);
+        return result;
+    }
+
+    /**
+     * @brief 从最高位开始连续的0的个数
+     *
+     * @note 遍历全部limb并以掩码选择最高的非0 limb，执行路径与值无关
+     */
+    template <::std::size_t bits>
+    constexpr inline int countl_zero(const ::cppfastbox::wide_uint<bits>& value) noexcept
+    {
+        auto result{static_cast<int>(bits)};
+        for(auto i{0zu}; i < ::cppfastbox::wide_uint<bits>::limb_count; i++)
+        {
+            auto count{static_cast<int>((::cppfastbox::wide_uint<bits>::limb_count - 1 - i) * 64) + ::std::countl_zero(value.limbs[i])};
+            auto mask{-static_cast<int>(value.limbs[i] != 0)};
+            result = (count & mask) | (result & ~mask);
+        }
+        return result;
+    }
+}  // namespace cppfastbox
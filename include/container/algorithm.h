@@ -7,11 +7,15 @@
  */
 #pragma once
 #include <bit>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ranges>
 #include <compare>
+#include <utility>
 #include "../base/utility.h"
+#include "simd.h"
 
 namespace cppfastbox::detail
 {
@@ -286,3 +290,1447 @@ namespace cppfastbox
         ::cppfastbox::detail::trivially_swap<sizeof(type), align == 0 ? alignof(type) : align>(::std::addressof(a), ::std::addressof(b));
     }
 }  // namespace cppfastbox
+
+namespace cppfastbox
+{
+    // 谓词与给定值的比较方式
+    enum class value_compare
+    {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal
+    };
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    /**
+     * @brief 逐元素比较a和b
+     *
+     * @note 算术类型显式转换到寻常算术转换的结果类型，结果与内建的比较相同但不会产生符号不同的警告
+     */
+    template <::cppfastbox::value_compare compare, typename type1, typename type2>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline bool algorithm_compare_scalar(const type1& a, const type2& b) noexcept
+    {
+        if constexpr(::std::is_arithmetic_v<type1> && ::std::is_arithmetic_v<type2> && !::std::same_as<type1, type2>)
+        {
+            using common = decltype(a + b);
+            return ::cppfastbox::detail::algorithm_compare_scalar<compare>(static_cast<common>(a), static_cast<common>(b));
+        }
+        else if constexpr(compare == ::cppfastbox::value_compare::equal) { return a == b; }
+        else if constexpr(compare == ::cppfastbox::value_compare::not_equal) { return a != b; }
+        else if constexpr(compare == ::cppfastbox::value_compare::less) { return a < b; }
+        else if constexpr(compare == ::cppfastbox::value_compare::less_equal) { return a <= b; }
+        else if constexpr(compare == ::cppfastbox::value_compare::greater) { return a > b; }
+        else { return a >= b; }
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 将元素与给定值比较的谓词
+     *
+     * @tparam compare 比较方式，元素位于运算符左侧
+     * @note find_if和count_if可以向量化此谓词
+     */
+    template <::cppfastbox::value_compare compare, typename type>
+    struct value_predicate
+    {
+        type value;
+
+        template <typename element>
+        [[nodiscard]] constexpr inline bool operator() (const element& x) const noexcept
+        {
+            return ::cppfastbox::detail::algorithm_compare_scalar<compare>(x, value);
+        }
+    };
+
+    // 元素等于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto equal_to(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::equal, type>{value};
+    }
+
+    // 元素不等于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto not_equal_to(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::not_equal, type>{value};
+    }
+
+    // 元素小于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto less_than(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::less, type>{value};
+    }
+
+    // 元素小于等于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto less_equal(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::less_equal, type>{value};
+    }
+
+    // 元素大于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto greater_than(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::greater, type>{value};
+    }
+
+    // 元素大于等于value
+    template <typename type>
+    [[nodiscard]] constexpr inline auto greater_equal(type value) noexcept
+    {
+        return ::cppfastbox::value_predicate<::cppfastbox::value_compare::greater_equal, type>{value};
+    }
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    template <typename type>
+    consteval inline auto get_algorithm_lane() noexcept
+    {
+        if constexpr(::std::floating_point<type>) { return type{}; }
+        else if constexpr(::cppfastbox::integral<type>)
+        {
+            return ::cppfastbox::fixed_size_integer_t<::cppfastbox::signed_integral<type>, sizeof(type)>{};
+        }
+        else { return ::cppfastbox::fixed_size_integer_t<false, sizeof(type)>{}; }
+    }
+
+    /**
+     * @brief 可以向量化的元素
+     *
+     * @note 浮点数以浮点数比较，其余类型以相同大小的整数逐位比较
+     */
+    template <typename type>
+    concept algorithm_element =
+        ::cppfastbox::trivially_equality_comparable<type> && !::std::is_volatile_v<type> &&
+        (::std::same_as<::std::remove_cv_t<type>, float> || ::std::same_as<::std::remove_cv_t<type>, double> ||
+         (!::std::floating_point<::std::remove_cv_t<type>> && ::std::has_single_bit(sizeof(type)) && sizeof(type) <= 8));
+
+    // 向量中元素的类型，整数保持符号，指针比较地址
+    template <typename type>
+    using algorithm_lane_t = decltype(::cppfastbox::detail::get_algorithm_lane<::std::remove_cv_t<type>>());
+
+    // 向量的元素数，位掩码至多64位
+    template <typename lane>
+    constexpr inline auto algorithm_lanes{::cppfastbox::min(::cppfastbox::simd_native_lanes<lane>, 64zu)};
+
+    // 可以转换为指向元素的指针的迭代器
+    template <typename iterator, typename sentinel>
+    concept algorithm_contiguous = ::std::contiguous_iterator<iterator> && ::std::sized_sentinel_for<sentinel, iterator> &&
+                                   ::cppfastbox::detail::algorithm_element<::std::iter_value_t<iterator>>;
+
+    // 可以由元素的大小关系推导出顺序的元素
+    template <typename type>
+    concept algorithm_ordered = ::std::is_arithmetic_v<type> || ::std::is_pointer_v<type>;
+
+    /**
+     * @brief 将value转换为向量中元素的类型
+     *
+     * @param result 与value相等的元素值
+     * @return 是否存在与value相等的元素值
+     * @note 按元素与value比较时的寻常算术转换判断，如int8_t的元素不可能等于300
+     */
+    template <typename element, typename type>
+    constexpr inline bool algorithm_cast_value(const type& value, ::cppfastbox::detail::algorithm_lane_t<element>& result) noexcept
+    {
+        auto cast{static_cast<element>(value)};
+        result = ::std::bit_cast<::cppfastbox::detail::algorithm_lane_t<element>>(cast);
+        if constexpr(::std::is_arithmetic_v<element>)
+        {
+            using common = decltype(cast + value);
+            return static_cast<common>(cast) == static_cast<common>(value);
+        }
+        else { return true; }
+    }
+
+    /**
+     * @brief 可以在向量中与元素比较相等的值
+     *
+     * @note 浮点数不能精确地转换为整数，故不向量化整数与浮点数的比较
+     */
+    template <typename element, typename type>
+    concept algorithm_equality_value =
+        ::std::same_as<::std::remove_cv_t<element>, ::std::remove_cvref_t<type>> ||
+        (::std::is_arithmetic_v<element> && ::std::is_arithmetic_v<::std::remove_cvref_t<type>> &&
+         !(::cppfastbox::integral<::std::remove_cv_t<element>> && ::std::floating_point<::std::remove_cvref_t<type>>)) ||
+        (::std::is_pointer_v<element> && ::std::convertible_to<type, ::std::remove_cv_t<element>>);
+
+    // 可以在向量中计算的谓词
+    template <typename element, typename predicate>
+    constexpr inline auto algorithm_vector_predicate{false};
+
+    template <typename element, ::cppfastbox::value_compare compare, typename type>
+    constexpr inline auto algorithm_vector_predicate<element, ::cppfastbox::value_predicate<compare, type>>{
+        compare == ::cppfastbox::value_compare::equal || compare == ::cppfastbox::value_compare::not_equal
+            ? ::cppfastbox::detail::algorithm_equality_value<element, type>
+            : ::cppfastbox::detail::algorithm_ordered<::std::remove_cv_t<element>> && ::std::same_as<::std::remove_cv_t<element>, type>};
+
+    // 以向量比较a和value
+    template <::cppfastbox::value_compare compare, typename vector>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline auto algorithm_compare(const vector& a, const vector& value) noexcept
+    {
+        if constexpr(compare == ::cppfastbox::value_compare::equal) { return a == value; }
+        else if constexpr(compare == ::cppfastbox::value_compare::not_equal) { return a != value; }
+        else if constexpr(compare == ::cppfastbox::value_compare::less) { return a < value; }
+        else if constexpr(compare == ::cppfastbox::value_compare::less_equal) { return a <= value; }
+        else if constexpr(compare == ::cppfastbox::value_compare::greater) { return a > value; }
+        else { return a >= value; }
+    }
+
+    /**
+     * @brief 查找第一个满足条件的元素
+     *
+     * @tparam n 向量的元素数
+     * @param count 元素数
+     * @param compare 接受向量的元素数和起始索引，返回向量比较的结果
+     * @return 第一个满足条件的元素的索引，不存在时返回count
+     * @note 末尾不足一个向量的部分与前一个向量重叠地读取
+     */
+    template <::std::size_t n, typename function>
+    inline ::std::size_t algorithm_find(::std::size_t count, function compare) noexcept
+    {
+        constexpr ::std::integral_constant<::std::size_t, n> lanes{};
+        auto i{0zu};
+        // 每次检查4个向量，减少分支
+        for(; i + n * 4 <= count; i += n * 4)
+        {
+            auto mask0{compare(lanes, i)};
+            auto mask1{compare(lanes, i + n)};
+            auto mask2{compare(lanes, i + n * 2)};
+            auto mask3{compare(lanes, i + n * 3)};
+            if((mask0 | mask1 | mask2 | mask3).any()) [[unlikely]]
+            {
+                if(mask0.any()) { return i + mask0.first_index(); }
+                else if(mask1.any()) { return i + n + mask1.first_index(); }
+                else if(mask2.any()) { return i + n * 2 + mask2.first_index(); }
+                else { return i + n * 3 + mask3.first_index(); }
+            }
+        }
+        for(; i + n <= count; i += n)
+        {
+            auto mask{compare(lanes, i)};
+            if(mask.any()) { return i + mask.first_index(); }
+        }
+        if(i == count) { return count; }
+        else if(count >= n)
+        {
+            auto mask{compare(lanes, count - n)};
+            return mask.any() ? count - n + mask.first_index() : count;
+        }
+        else
+        {
+            for(; i < count; i++)
+            {
+                if(compare(::std::integral_constant<::std::size_t, 1>{}, i)[0]) { return i; }
+            }
+            return count;
+        }
+    }
+
+    /**
+     * @brief 统计满足条件的元素数
+     *
+     * @tparam lane 向量中元素的类型
+     * @tparam n 向量的元素数
+     * @param count 元素数
+     * @param compare 接受向量的元素数和起始索引，返回向量比较的结果
+     * @note 以与元素等宽的计数器累加掩码，在计数器溢出前归约
+     */
+    template <typename lane, ::std::size_t n, typename function>
+    inline ::std::size_t algorithm_count(::std::size_t count, function compare) noexcept
+    {
+        using counter = ::cppfastbox::simd<::cppfastbox::fixed_size_integer_t<false, sizeof(lane)>, n>;
+        constexpr auto limit{sizeof(lane) >= sizeof(::std::size_t) ? ~0zu : static_cast<::std::size_t>(~0ull >> (64 - sizeof(lane) * 8))};
+        ::std::size_t result{};
+        auto i{0zu};
+        while(count - i >= n)
+        {
+            auto blocks{::cppfastbox::min((count - i) / n, limit)};
+            counter total{};
+            for(auto j{0zu}; j < blocks; j++, i += n)
+            {
+                auto mask{compare(::std::integral_constant<::std::size_t, n>{}, i)};
+                total -= counter{::std::bit_cast<typename counter::vector_type>(mask.vector)};
+            }
+            for(auto j{0zu}; j < n; j++) { result += static_cast<::std::size_t>(total[j]); }
+        }
+        for(; i < count; i++) { result += compare(::std::integral_constant<::std::size_t, 1>{}, i)[0]; }
+        return result;
+    }
+
+    /**
+     * @brief 以向量查找或统计与给定值比较满足条件的元素
+     *
+     * @tparam count_mode 为true时统计满足条件的元素数，否则查找第一个满足条件的元素
+     * @return 元素的索引或满足条件的元素数
+     */
+    template <bool count_mode, ::cppfastbox::value_compare compare, typename element, typename type>
+    inline ::std::size_t algorithm_find_value(const element* ptr, ::std::size_t count, const type& value) noexcept
+    {
+        using lane = ::cppfastbox::detail::algorithm_lane_t<element>;
+        constexpr auto n{::cppfastbox::detail::algorithm_lanes<lane>};
+        lane cast{};
+        if constexpr(compare == ::cppfastbox::value_compare::equal || compare == ::cppfastbox::value_compare::not_equal)
+        {
+            if(!::cppfastbox::detail::algorithm_cast_value<::std::remove_cv_t<element>>(value, cast))
+            {
+                // 没有与value相等的元素
+                constexpr auto equal{compare == ::cppfastbox::value_compare::equal};
+                if constexpr(count_mode) { return equal ? 0zu : count; }
+                else { return equal || count == 0 ? count : 0zu; }
+            }
+        }
+        else { cast = ::std::bit_cast<lane>(value); }
+        auto data{reinterpret_cast<const lane*>(ptr)};
+        auto function{[data, cast]<::std::size_t lanes>(::std::integral_constant<::std::size_t, lanes>, ::std::size_t index) noexcept {
+            using vector = ::cppfastbox::simd<lane, lanes>;
+            return ::cppfastbox::detail::algorithm_compare<compare>(vector::load(data + index), vector{cast});
+        }};
+        if constexpr(count_mode) { return ::cppfastbox::detail::algorithm_count<lane, n>(count, function); }
+        else { return ::cppfastbox::detail::algorithm_find<n>(count, function); }
+    }
+
+    // 以向量查找第一对不相等的元素
+    template <typename element>
+    inline ::std::size_t algorithm_mismatch(const element* a, const element* b, ::std::size_t count) noexcept
+    {
+        using lane = ::cppfastbox::detail::algorithm_lane_t<element>;
+        auto data_a{reinterpret_cast<const lane*>(a)};
+        auto data_b{reinterpret_cast<const lane*>(b)};
+        return ::cppfastbox::detail::algorithm_find<::cppfastbox::detail::algorithm_lanes<lane>>(
+            count, [data_a, data_b]<::std::size_t lanes>(::std::integral_constant<::std::size_t, lanes>, ::std::size_t index) noexcept {
+                using vector = ::cppfastbox::simd<lane, lanes>;
+                return vector::load(data_a + index) != vector::load(data_b + index);
+            });
+    }
+
+    // 两个迭代器指向的元素可以在向量中比较
+    template <typename iterator1, typename sentinel1, typename iterator2>
+    concept algorithm_comparable_contiguous =
+        ::cppfastbox::detail::algorithm_contiguous<iterator1, sentinel1> && ::std::contiguous_iterator<iterator2> &&
+        ::std::same_as<::std::iter_value_t<iterator1>, ::std::iter_value_t<iterator2>>;
+}  // namespace cppfastbox::detail
+
+/**
+ * @brief 查找、统计和比较
+ *
+ * @note 对于指向trivially_equality_comparable元素的连续迭代器，将迭代器转换为指针并以simd比较，否则逐元素比较
+ */
+namespace cppfastbox
+{
+    /**
+     * @brief 查找第一个等于value的元素
+     *
+     * @return 指向该元素的迭代器，不存在时返回last
+     */
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename type>
+    [[nodiscard]] constexpr inline iterator find(iterator first, sentinel last, const type& value) noexcept
+    {
+        using element = ::std::remove_reference_t<::std::iter_reference_t<iterator>>;
+        if constexpr(::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                     ::cppfastbox::detail::algorithm_equality_value<element, type>)
+        {
+            if !consteval
+            {
+                auto ptr{::std::to_address(first)};
+                auto count{static_cast<::std::size_t>(last - first)};
+                auto index{::cppfastbox::detail::algorithm_find_value<false, ::cppfastbox::value_compare::equal>(ptr, count, value)};
+                return first + static_cast<::std::iter_difference_t<iterator>>(index);
+            }
+        }
+        for(; first != last; ++first)
+        {
+            if(::cppfastbox::detail::algorithm_compare_scalar<::cppfastbox::value_compare::equal>(*first, value)) { break; }
+        }
+        return first;
+    }
+
+    /**
+     * @brief 查找第一个满足谓词的元素
+     *
+     * @return 指向该元素的迭代器，不存在时返回last
+     * @note 仅向量化value_predicate，大小比较要求value与元素的类型相同
+     */
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename predicate>
+    [[nodiscard]] constexpr inline iterator find_if(iterator first, sentinel last, predicate pred) noexcept
+    {
+        using element = ::std::remove_reference_t<::std::iter_reference_t<iterator>>;
+        if constexpr(::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                     ::cppfastbox::detail::algorithm_vector_predicate<element, predicate>)
+        {
+            if !consteval
+            {
+                auto count{static_cast<::std::size_t>(last - first)};
+                auto index{[&]<::cppfastbox::value_compare compare, typename type>(const ::cppfastbox::value_predicate<compare, type>& value) {
+                    return ::cppfastbox::detail::algorithm_find_value<false, compare>(::std::to_address(first), count, value.value);
+                }(pred)};
+                return first + static_cast<::std::iter_difference_t<iterator>>(index);
+            }
+        }
+        for(; first != last; ++first)
+        {
+            if(pred(*first)) { break; }
+        }
+        return first;
+    }
+
+    // 统计等于value的元素数
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename type>
+    [[nodiscard]] constexpr inline ::std::iter_difference_t<iterator> count(iterator first, sentinel last, const type& value) noexcept
+    {
+        using element = ::std::remove_reference_t<::std::iter_reference_t<iterator>>;
+        if constexpr(::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                     ::cppfastbox::detail::algorithm_equality_value<element, type>)
+        {
+            if !consteval
+            {
+                auto ptr{::std::to_address(first)};
+                auto count{static_cast<::std::size_t>(last - first)};
+                auto result{::cppfastbox::detail::algorithm_find_value<true, ::cppfastbox::value_compare::equal>(ptr, count, value)};
+                return static_cast<::std::iter_difference_t<iterator>>(result);
+            }
+        }
+        ::std::iter_difference_t<iterator> result{};
+        for(; first != last; ++first)
+        {
+            if(::cppfastbox::detail::algorithm_compare_scalar<::cppfastbox::value_compare::equal>(*first, value)) { result++; }
+        }
+        return result;
+    }
+
+    /**
+     * @brief 统计满足谓词的元素数
+     *
+     * @note 仅向量化value_predicate，大小比较要求value与元素的类型相同
+     */
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename predicate>
+    [[nodiscard]] constexpr inline ::std::iter_difference_t<iterator> count_if(iterator first, sentinel last, predicate pred) noexcept
+    {
+        using element = ::std::remove_reference_t<::std::iter_reference_t<iterator>>;
+        if constexpr(::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                     ::cppfastbox::detail::algorithm_vector_predicate<element, predicate>)
+        {
+            if !consteval
+            {
+                auto count{static_cast<::std::size_t>(last - first)};
+                return static_cast<::std::iter_difference_t<iterator>>(
+                    [&]<::cppfastbox::value_compare compare, typename type>(const ::cppfastbox::value_predicate<compare, type>& value) {
+                        return ::cppfastbox::detail::algorithm_find_value<true, compare>(::std::to_address(first), count, value.value);
+                    }(pred));
+            }
+        }
+        ::std::iter_difference_t<iterator> result{};
+        for(; first != last; ++first)
+        {
+            if(pred(*first)) { result++; }
+        }
+        return result;
+    }
+
+    /**
+     * @brief 查找第一对不相等的元素
+     *
+     * @return 分别指向两个范围中该对元素的迭代器，范围较短者到达末尾时停止
+     */
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2,
+              ::std::sentinel_for<iterator2> sentinel2>
+    [[nodiscard]] constexpr inline ::std::pair<iterator1, iterator2> mismatch(iterator1 first1, sentinel1 last1, iterator2 first2,
+                                                                              sentinel2 last2) noexcept
+    {
+        if constexpr(::cppfastbox::detail::algorithm_comparable_contiguous<iterator1, sentinel1, iterator2> &&
+                     ::std::sized_sentinel_for<sentinel2, iterator2>)
+        {
+            if !consteval
+            {
+                auto count{::cppfastbox::min(static_cast<::std::size_t>(last1 - first1), static_cast<::std::size_t>(last2 - first2))};
+                auto index{::cppfastbox::detail::algorithm_mismatch(::std::to_address(first1), ::std::to_address(first2), count)};
+                return {first1 + static_cast<::std::iter_difference_t<iterator1>>(index),
+                        first2 + static_cast<::std::iter_difference_t<iterator2>>(index)};
+            }
+        }
+        for(; first1 != last1 && first2 != last2; ++first1, ++first2)
+        {
+            if(!(*first1 == *first2)) { break; }
+        }
+        return {first1, first2};
+    }
+
+    /**
+     * @brief 查找第一对不相等的元素
+     *
+     * @note 第二个范围的长度不小于第一个范围
+     */
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2>
+    [[nodiscard]] constexpr inline ::std::pair<iterator1, iterator2> mismatch(iterator1 first1, sentinel1 last1, iterator2 first2) noexcept
+    {
+        if constexpr(::cppfastbox::detail::algorithm_comparable_contiguous<iterator1, sentinel1, iterator2>)
+        {
+            if !consteval
+            {
+                auto count{static_cast<::std::size_t>(last1 - first1)};
+                auto index{::cppfastbox::detail::algorithm_mismatch(::std::to_address(first1), ::std::to_address(first2), count)};
+                return {first1 + static_cast<::std::iter_difference_t<iterator1>>(index),
+                        first2 + static_cast<::std::iter_difference_t<iterator2>>(index)};
+            }
+        }
+        for(; first1 != last1; ++first1, ++first2)
+        {
+            if(!(*first1 == *first2)) { break; }
+        }
+        return {first1, first2};
+    }
+
+    // 两个范围的元素是否逐个相等，长度不同时不相等
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2,
+              ::std::sentinel_for<iterator2> sentinel2>
+    [[nodiscard]] constexpr inline bool equal(iterator1 first1, sentinel1 last1, iterator2 first2, sentinel2 last2) noexcept
+    {
+        if constexpr(::std::sized_sentinel_for<sentinel1, iterator1> && ::std::sized_sentinel_for<sentinel2, iterator2>)
+        {
+            if(last1 - first1 != last2 - first2) { return false; }
+        }
+        auto [end1, end2]{::cppfastbox::mismatch(::std::move(first1), last1, ::std::move(first2), last2)};
+        return end1 == last1 && end2 == last2;
+    }
+
+    /**
+     * @brief 两个范围的元素是否逐个相等
+     *
+     * @note 第二个范围的长度不小于第一个范围
+     */
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2>
+    [[nodiscard]] constexpr inline bool equal(iterator1 first1, sentinel1 last1, iterator2 first2) noexcept
+    {
+        return ::cppfastbox::mismatch(::std::move(first1), last1, ::std::move(first2)).first == last1;
+    }
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    // 元素是否是NaN
+    template <typename type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline bool algorithm_is_nan(const type& value) noexcept
+    {
+        if constexpr(::std::floating_point<type>) { return value != value; }
+        else { return false; }
+    }
+
+    /**
+     * @brief 以向量查找最小或最大的元素
+     *
+     * @tparam greater 为true时查找最大的元素
+     * @tparam last 为true时在相等的元素中选择最后一个，否则选择第一个
+     * @param count 元素数，不为0
+     * @return 元素的索引
+     * @note 调用者保证第一个元素不是NaN，其余的NaN不会被选择。每个向量元素记录其取得最值的轮次，
+     *       轮次与元素等宽，故每当轮次将要溢出时归约一次
+     */
+    template <bool greater, bool last, typename lane>
+    inline ::std::size_t algorithm_extreme(const lane* ptr, ::std::size_t count) noexcept
+    {
+        constexpr auto n{::cppfastbox::detail::algorithm_lanes<lane>};
+        using vector = ::cppfastbox::simd<lane, n>;
+        using index_lane = ::cppfastbox::fixed_size_integer_t<false, sizeof(lane)>;
+        using index_vector = ::cppfastbox::simd<index_lane, n>;
+        using index_mask = ::cppfastbox::simd_mask<index_lane, n>;
+        constexpr auto limit{sizeof(lane) >= sizeof(::std::size_t) ? ~0zu : static_cast<::std::size_t>(1ull << (sizeof(lane) * 8))};
+        // x是否严格优于best
+        constexpr auto better{[](const auto& x, const auto& best) constexpr noexcept {
+            if constexpr(greater) { return x > best; }
+            else { return x < best; }
+        }};
+        auto result{0zu};
+        auto result_value{::cppfastbox::simd<lane, 1>::load(ptr)[0]};
+        // 严格更优，或相等且索引更符合要求时替换结果
+        auto update{[&](lane value, ::std::size_t index) noexcept {
+            if(better(value, result_value) || (value == result_value && (last ? index > result : index < result)))
+            {
+                result = index;
+                result_value = value;
+            }
+        }};
+        auto i{0zu};
+        while(count - i >= n)
+        {
+            auto blocks{::cppfastbox::min((count - i) / n, limit)};
+            auto best{vector::load(ptr + i)};
+            index_vector best_block{};
+            for(auto j{1zu}; j < blocks; j++)
+            {
+                auto x{vector::load(ptr + i + j * n)};
+                auto mask{last ? (better(x, best) | (x == best)) : better(x, best)};
+                if constexpr(::std::floating_point<lane>) { mask = mask | (best != best); }
+                best = blend(mask, x, best);
+                best_block = blend(index_mask{mask.vector}, index_vector{static_cast<index_lane>(j)}, best_block);
+            }
+            for(auto k{0zu}; k < n; k++) { update(best[k], i + static_cast<::std::size_t>(best_block[k]) * n + k); }
+            i += blocks * n;
+        }
+        for(; i < count; i++) { update(::cppfastbox::simd<lane, 1>::load(ptr + i)[0], i); }
+        return result;
+    }
+
+    /**
+     * @brief 以向量求和
+     *
+     * @tparam n 向量的元素数
+     * @param term 接受向量的元素数和起始索引，返回要累加的向量
+     * @note 以4个向量累加，浮点数的结果与顺序累加不同
+     */
+    template <typename lane, ::std::size_t n, typename function>
+    inline lane algorithm_sum(::std::size_t count, function term) noexcept
+    {
+        using vector = ::cppfastbox::simd<lane, n>;
+        constexpr ::std::integral_constant<::std::size_t, n> lanes{};
+        vector sum0{};
+        vector sum1{};
+        vector sum2{};
+        vector sum3{};
+        auto i{0zu};
+        for(; i + n * 4 <= count; i += n * 4)
+        {
+            sum0 += term(lanes, i);
+            sum1 += term(lanes, i + n);
+            sum2 += term(lanes, i + n * 2);
+            sum3 += term(lanes, i + n * 3);
+        }
+        for(; i + n <= count; i += n) { sum0 += term(lanes, i); }
+        auto result{reduce_add((sum0 + sum1) + (sum2 + sum3))};
+        for(; i < count; i++) { result = static_cast<lane>(result + term(::std::integral_constant<::std::size_t, 1>{}, i)[0]); }
+        return result;
+    }
+
+    // 可以以向量查找最值的元素
+    template <typename iterator, typename sentinel>
+    concept algorithm_extreme_contiguous =
+        ::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> && ::cppfastbox::detail::algorithm_ordered<::std::iter_value_t<iterator>>;
+
+    // 可以以向量求和的元素，和的类型与元素相同
+    template <typename iterator, typename sentinel, typename type>
+    concept algorithm_sum_contiguous = ::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                                       ::std::is_arithmetic_v<::std::iter_value_t<iterator>> &&
+                                       !::std::same_as<::std::iter_value_t<iterator>, bool> &&
+                                       ::std::same_as<::std::iter_value_t<iterator>, type>;
+
+    /**
+     * @brief 查找最小或最大的元素
+     *
+     * @tparam greater 为true时查找最大的元素
+     * @tparam last 为true时在相等的元素中选择最后一个，否则选择第一个
+     * @note 第一个元素是NaN时返回first，其余的NaN不会被选择，与逐个以<比较的结果相同
+     */
+    template <bool greater, bool last, typename iterator, typename sentinel>
+    constexpr inline iterator algorithm_extreme_element(iterator first, sentinel end) noexcept
+    {
+        if(first == end) { return first; }
+        if constexpr(::cppfastbox::detail::algorithm_extreme_contiguous<iterator, sentinel>)
+        {
+            if !consteval
+            {
+                if(::cppfastbox::detail::algorithm_is_nan(*first)) { return first; }
+                using lane = ::cppfastbox::detail::algorithm_lane_t<::std::iter_value_t<iterator>>;
+                auto ptr{reinterpret_cast<const lane*>(::std::to_address(first))};
+                auto count{static_cast<::std::size_t>(end - first)};
+                auto index{::cppfastbox::detail::algorithm_extreme<greater, last>(ptr, count)};
+                return first + static_cast<::std::iter_difference_t<iterator>>(index);
+            }
+        }
+        auto result{first};
+        if(::cppfastbox::detail::algorithm_is_nan(*first)) { return first; }
+        for(++first; first != end; ++first)
+        {
+            if constexpr(greater && last)
+            {
+                if(!(*first < *result) && !::cppfastbox::detail::algorithm_is_nan(*first)) { result = first; }
+            }
+            else if constexpr(greater)
+            {
+                if(*result < *first) { result = first; }
+            }
+            else
+            {
+                if(*first < *result) { result = first; }
+            }
+        }
+        return result;
+    }
+}  // namespace cppfastbox::detail
+
+/**
+ * @brief 最值与归约
+ *
+ * @note 对于连续迭代器指向的算术类型和指针，将迭代器转换为指针并以simd计算，否则逐元素计算
+ */
+namespace cppfastbox
+{
+    /**
+     * @brief 查找最小的元素
+     *
+     * @return 第一个最小的元素，范围为空时返回last
+     * @note 与逐个以<比较的结果相同：第一个元素是NaN时返回first，否则NaN不会被选择
+     */
+    template <::std::forward_iterator iterator, ::std::sentinel_for<iterator> sentinel>
+    [[nodiscard]] constexpr inline iterator min_element(iterator first, sentinel last) noexcept
+    {
+        return ::cppfastbox::detail::algorithm_extreme_element<false, false>(::std::move(first), last);
+    }
+
+    /**
+     * @brief 查找最大的元素
+     *
+     * @return 第一个最大的元素，范围为空时返回last
+     * @note 与逐个以<比较的结果相同：第一个元素是NaN时返回first，否则NaN不会被选择
+     */
+    template <::std::forward_iterator iterator, ::std::sentinel_for<iterator> sentinel>
+    [[nodiscard]] constexpr inline iterator max_element(iterator first, sentinel last) noexcept
+    {
+        return ::cppfastbox::detail::algorithm_extreme_element<true, false>(::std::move(first), last);
+    }
+
+    /**
+     * @brief 同时查找最小和最大的元素
+     *
+     * @return 第一个最小的元素和最后一个最大的元素，与std::minmax_element相同
+     * @note 第一个元素是NaN时均返回first，否则NaN不会被选择
+     */
+    template <::std::forward_iterator iterator, ::std::sentinel_for<iterator> sentinel>
+    [[nodiscard]] constexpr inline ::std::pair<iterator, iterator> minmax_element(iterator first, sentinel last) noexcept
+    {
+        return {::cppfastbox::detail::algorithm_extreme_element<false, false>(first, last),
+                ::cppfastbox::detail::algorithm_extreme_element<true, true>(first, last)};
+    }
+
+    /**
+     * @brief 求和
+     *
+     * @param init 初始值，和的类型与init相同
+     * @note init与元素的类型相同时以simd求和，浮点数的结果可能与顺序累加不同；常量求值时顺序累加
+     */
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename type>
+    [[nodiscard]] constexpr inline type reduce(iterator first, sentinel last, type init) noexcept
+    {
+        if constexpr(::cppfastbox::detail::algorithm_sum_contiguous<iterator, sentinel, type>)
+        {
+            if !consteval
+            {
+                using lane = ::cppfastbox::detail::algorithm_lane_t<type>;
+                auto ptr{reinterpret_cast<const lane*>(::std::to_address(first))};
+                auto sum{::cppfastbox::detail::algorithm_sum<lane, ::cppfastbox::detail::algorithm_lanes<lane>>(
+                    static_cast<::std::size_t>(last - first),
+                    [ptr]<::std::size_t lanes>(::std::integral_constant<::std::size_t, lanes>, ::std::size_t index) noexcept {
+                        return ::cppfastbox::simd<lane, lanes>::load(ptr + index);
+                    })};
+                return static_cast<type>(init + static_cast<type>(sum));
+            }
+        }
+        for(; first != last; ++first) { init = static_cast<type>(init + *first); }
+        return init;
+    }
+
+    // 求和，和的类型与元素相同
+    template <::std::input_iterator iterator, ::std::sentinel_for<iterator> sentinel>
+    [[nodiscard]] constexpr inline ::std::iter_value_t<iterator> reduce(iterator first, sentinel last) noexcept
+    {
+        return ::cppfastbox::reduce(::std::move(first), last, ::std::iter_value_t<iterator>{});
+    }
+
+    /**
+     * @brief 点积
+     *
+     * @param init 初始值，结果的类型与init相同
+     * @note 第二个范围的长度不小于第一个范围。两个范围的元素与init的类型相同时以simd计算，浮点数的结果可能与顺序累加不同
+     */
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2, typename type>
+    [[nodiscard]] constexpr inline type dot(iterator1 first1, sentinel1 last1, iterator2 first2, type init) noexcept
+    {
+        if constexpr(::cppfastbox::detail::algorithm_sum_contiguous<iterator1, sentinel1, type> && ::std::contiguous_iterator<iterator2> &&
+                     ::std::same_as<::std::iter_value_t<iterator2>, type>)
+        {
+            if !consteval
+            {
+                using lane = ::cppfastbox::detail::algorithm_lane_t<type>;
+                auto ptr1{reinterpret_cast<const lane*>(::std::to_address(first1))};
+                auto ptr2{reinterpret_cast<const lane*>(::std::to_address(first2))};
+                auto sum{::cppfastbox::detail::algorithm_sum<lane, ::cppfastbox::detail::algorithm_lanes<lane>>(
+                    static_cast<::std::size_t>(last1 - first1),
+                    [ptr1, ptr2]<::std::size_t lanes>(::std::integral_constant<::std::size_t, lanes>, ::std::size_t index) noexcept {
+                        using vector = ::cppfastbox::simd<lane, lanes>;
+                        return vector::load(ptr1 + index) * vector::load(ptr2 + index);
+                    })};
+                return static_cast<type>(init + static_cast<type>(sum));
+            }
+        }
+        for(; first1 != last1; ++first1, ++first2) { init = static_cast<type>(init + *first1 * *first2); }
+        return init;
+    }
+
+    // 点积，结果的类型与第一个范围的元素相同
+    template <::std::input_iterator iterator1, ::std::sentinel_for<iterator1> sentinel1, ::std::input_iterator iterator2>
+    [[nodiscard]] constexpr inline ::std::iter_value_t<iterator1> dot(iterator1 first1, sentinel1 last1, iterator2 first2) noexcept
+    {
+        return ::cppfastbox::dot(::std::move(first1), last1, ::std::move(first2), ::std::iter_value_t<iterator1>{});
+    }
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    // 插入排序，用于小的范围
+    template <typename iterator, typename compare>
+    constexpr inline void algorithm_insertion_sort(iterator first, iterator last, compare& comp) noexcept
+    {
+        if(first == last) { return; }
+        for(auto i{first + 1}; i != last; ++i)
+        {
+            auto value{::std::ranges::iter_move(i)};
+            auto hole{i};
+            for(; hole != first && comp(value, *(hole - 1)); --hole) { *hole = ::std::ranges::iter_move(hole - 1); }
+            *hole = ::std::move(value);
+        }
+    }
+
+    // 将first[start]下沉到大顶堆first[0, count)中的位置
+    template <typename iterator, typename compare, typename difference>
+    constexpr inline void algorithm_sift_down(iterator first, difference start, difference count, compare& comp) noexcept
+    {
+        auto value{::std::ranges::iter_move(first + start)};
+        auto hole{start};
+        while(true)
+        {
+            auto child{hole * 2 + 1};
+            if(child >= count) { break; }
+            if(child + 1 < count && comp(first[child], first[child + 1])) { child++; }
+            if(!comp(value, first[child])) { break; }
+            first[hole] = ::std::ranges::iter_move(first + child);
+            hole = child;
+        }
+        first[hole] = ::std::move(value);
+    }
+
+    // 堆排序，用于内省排序递归过深时保证O(nlogn)
+    template <typename iterator, typename compare>
+    constexpr inline void algorithm_heap_sort(iterator first, iterator last, compare& comp) noexcept
+    {
+        auto count{last - first};
+        for(auto i{count / 2}; i-- > 0;) { ::cppfastbox::detail::algorithm_sift_down(first, i, count, comp); }
+        for(auto end{count}; end-- > 1;)
+        {
+            ::std::ranges::iter_swap(first, first + end);
+            ::cppfastbox::detail::algorithm_sift_down(first, decltype(count){}, end, comp);
+        }
+    }
+
+    // 将a、b、c的中位数交换到result
+    template <typename iterator, typename compare>
+    constexpr inline void algorithm_median_to_first(iterator result, iterator a, iterator b, iterator c, compare& comp) noexcept
+    {
+        if(comp(*a, *b))
+        {
+            if(comp(*b, *c)) { ::std::ranges::iter_swap(result, b); }
+            else if(comp(*a, *c)) { ::std::ranges::iter_swap(result, c); }
+            else { ::std::ranges::iter_swap(result, a); }
+        }
+        else if(comp(*a, *c)) { ::std::ranges::iter_swap(result, a); }
+        else if(comp(*b, *c)) { ::std::ranges::iter_swap(result, c); }
+        else { ::std::ranges::iter_swap(result, b); }
+    }
+
+    /**
+     * @brief 内省排序
+     *
+     * @param depth 剩余的递归深度，耗尽时改用堆排序
+     * @note 三数取中后以first为枢轴划分，三个样本保证两侧的扫描不会越界
+     */
+    template <typename iterator, typename compare>
+    constexpr inline void algorithm_introsort(iterator first, iterator last, compare& comp, ::std::size_t depth) noexcept
+    {
+        while(last - first > 16)
+        {
+            if(depth == 0)
+            {
+                ::cppfastbox::detail::algorithm_heap_sort(first, last, comp);
+                return;
+            }
+            depth--;
+            ::cppfastbox::detail::algorithm_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+            auto left{first + 1};
+            auto right{last};
+            while(true)
+            {
+                while(comp(*left, *first)) { ++left; }
+                --right;
+                while(comp(*first, *right)) { --right; }
+                if(!(left < right)) { break; }
+                ::std::ranges::iter_swap(left, right);
+                ++left;
+            }
+            ::cppfastbox::detail::algorithm_introsort(left, last, comp, depth);
+            last = left;
+        }
+        ::cppfastbox::detail::algorithm_insertion_sort(first, last, comp);
+    }
+
+    /**
+     * @brief 比较交换两个向量
+     *
+     * @note 相等时a和b保持不变，使浮点数的正负零不会丢失
+     */
+    template <typename vector>
+    CPPFASTBOX_ALWAYS_INLINE inline void algorithm_sort_exchange(vector& a, vector& b) noexcept
+    {
+        auto low{min(a, b)};
+        b = max(b, a);
+        a = low;
+    }
+
+    // 第i个元素与第i ^ bits个元素交换位置
+    template <::std::size_t bits, typename lane, ::std::size_t n>
+    CPPFASTBOX_ALWAYS_INLINE inline auto algorithm_sort_xor(const ::cppfastbox::simd<lane, n>& value) noexcept
+    {
+        if constexpr(bits == 0) { return value; }
+        else
+        {
+            return [&value]<::std::size_t... index>(::std::index_sequence<index...>) noexcept {
+                return shuffle<(index ^ bits)...>(value);
+            }(::std::make_index_sequence<n>{});
+        }
+    }
+
+    /**
+     * @brief 双调排序网络的一步
+     *
+     * @tparam bits 比较的两个元素的索引之差，按位异或
+     * @note 元素的索引为向量的索引乘n加向量中的索引，每对元素中索引较小的取较小者
+     */
+    template <::std::size_t bits, typename lane, ::std::size_t n, ::std::size_t m>
+    CPPFASTBOX_ALWAYS_INLINE inline void algorithm_bitonic_step(::cppfastbox::simd<lane, n> (&vectors)[m]) noexcept
+    {
+        constexpr auto top{::std::bit_floor(bits)};
+        if constexpr(top < n)
+        {
+            // 在向量内比较，以编译期确定的混合选择较小者或较大者
+            [&vectors]<::std::size_t... index>(::std::index_sequence<index...>) noexcept {
+                for(auto& i : vectors)
+                {
+                    auto partner{::cppfastbox::detail::algorithm_sort_xor<bits>(i)};
+                    auto low{min(i, partner)};
+                    auto high{max(i, partner)};
+                    i.vector = __builtin_shufflevector(low.vector, high.vector, ((index & top) == 0 ? index : n + index)...);
+                }
+            }(::std::make_index_sequence<n>{});
+        }
+        else
+        {
+            // 在向量间比较，较小的向量中的元素全部取较小者
+            [&vectors]<::std::size_t... index>(::std::index_sequence<index...>) noexcept {
+                auto exchange{[&vectors]<::std::size_t a>(::std::integral_constant<::std::size_t, a>) noexcept {
+                    if constexpr((a & (top / n)) == 0)
+                    {
+                        constexpr auto b{a ^ (bits / n)};
+                        auto partner{::cppfastbox::detail::algorithm_sort_xor<bits % n>(vectors[b])};
+                        ::cppfastbox::detail::algorithm_sort_exchange(vectors[a], partner);
+                        vectors[b] = ::cppfastbox::detail::algorithm_sort_xor<bits % n>(partner);
+                    }
+                }};
+                (exchange(::std::integral_constant<::std::size_t, index>{}), ...);
+            }(::std::make_index_sequence<m>{});
+        }
+    }
+
+    // 合并长为k的双调序列，首步比较对称位置的元素，其后比较距离减半的元素
+    template <::std::size_t k, typename lane, ::std::size_t n, ::std::size_t m>
+    CPPFASTBOX_ALWAYS_INLINE inline void algorithm_bitonic_merge(::cppfastbox::simd<lane, n> (&vectors)[m]) noexcept
+    {
+        ::cppfastbox::detail::algorithm_bitonic_step<k - 1>(vectors);
+        [&vectors]<::std::size_t... index>(::std::index_sequence<index...>) noexcept {
+            (::cppfastbox::detail::algorithm_bitonic_step<(k >> (index + 2))>(vectors), ...);
+        }(::std::make_index_sequence<::std::countr_zero(k) - 1>{});
+    }
+
+    /**
+     * @brief 以寄存器中的双调排序网络排序不超过m个向量的元素
+     *
+     * @note 不足m个向量的部分以最大值填充
+     */
+    template <typename lane, ::std::size_t n, ::std::size_t m>
+    inline void algorithm_bitonic_sort(lane* ptr, ::std::size_t count) noexcept
+    {
+        using vector = ::cppfastbox::simd<lane, n>;
+        constexpr auto padding{::std::floating_point<lane> ? ::std::numeric_limits<lane>::infinity() : ::std::numeric_limits<lane>::max()};
+        auto index{[]<::std::size_t... i>(::std::index_sequence<i...>) noexcept {
+            return vector{typename vector::vector_type{static_cast<lane>(i)...}};
+        }(::std::make_index_sequence<n>{})};
+        vector vectors[m];
+        for(auto i{0zu}; i < m; i++)
+        {
+            auto begin{i * n};
+            if(begin + n <= count) { vectors[i] = vector::load(ptr + begin); }
+            else if(begin < count)
+            {
+                auto mask{index < vector{static_cast<lane>(count - begin)}};
+                vectors[i] = blend(mask, vector::load_masked(ptr + begin, mask), vector{padding});
+            }
+            else { vectors[i] = vector{padding}; }
+        }
+        [&vectors]<::std::size_t... i>(::std::index_sequence<i...>) noexcept {
+            (::cppfastbox::detail::algorithm_bitonic_merge<(2zu << i)>(vectors), ...);
+        }(::std::make_index_sequence<::std::countr_zero(n * m)>{});
+        for(auto i{0zu}; i < m; i++)
+        {
+            auto begin{i * n};
+            if(begin + n <= count) { vectors[i].store(ptr + begin); }
+            else if(begin < count) { vectors[i].store_masked(ptr + begin, index < vector{static_cast<lane>(count - begin)}); }
+        }
+    }
+
+    // 划分向量的方式：0为逐元素，1为查表重排(avx2)，2为压缩写入(avx512f)
+    template <typename lane, ::std::size_t n>
+    consteval inline int algorithm_partition_isa() noexcept
+    {
+        if constexpr(!::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>() && !::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x64>())
+        {
+            return 0;
+        }
+        else if constexpr(sizeof(lane) < 4) { return 0; }
+        else if constexpr(sizeof(lane) * n == 64 && ::cppfastbox::cpu_flags::x86::avx512f_support) { return 2; }
+        else if constexpr(sizeof(lane) * n == 32 && ::cppfastbox::cpu_flags::x86::avx2_support) { return 1; }
+        else { return 0; }
+    }
+
+    // 重排表，第bits项将bits中为1的元素依序移到前部，其余元素移到后部，每个字节为一个32位元素的索引
+    template <::std::size_t n>
+    struct algorithm_partition_table
+    {
+        ::std::uint64_t value[1zu << n]{};
+
+        consteval inline algorithm_partition_table() noexcept
+        {
+            constexpr auto dwords{8zu / n};
+            for(auto bits{0zu}; bits < (1zu << n); bits++)
+            {
+                auto position{0zu};
+                auto append{[&](::std::size_t lane) constexpr noexcept {
+                    for(auto i{0zu}; i < dwords; i++) { value[bits] |= static_cast<::std::uint64_t>(lane * dwords + i) << (8 * position++); }
+                }};
+                for(auto i{0zu}; i < n; i++)
+                {
+                    if((bits >> i & 1) != 0) { append(i); }
+                }
+                for(auto i{0zu}; i < n; i++)
+                {
+                    if((bits >> i & 1) == 0) { append(i); }
+                }
+            }
+        }
+    };
+
+    template <::std::size_t n>
+    constexpr inline ::cppfastbox::detail::algorithm_partition_table<n> algorithm_partition_table_v{};
+
+    /**
+     * @brief 将向量中掩码为真的元素写入left，其余元素写入right_end之前
+     *
+     * @return 掩码为真的元素数
+     * @note 调用者保证left之后和right_end之前各有至少n个可以覆盖的位置
+     */
+    template <typename lane, ::std::size_t n>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t algorithm_partition_store(const ::cppfastbox::simd<lane, n>& value,
+                                                                           const ::cppfastbox::simd_mask<lane, n>& mask,
+                                                                           lane* left,
+                                                                           lane* right_end) noexcept
+    {
+        constexpr auto isa{::cppfastbox::detail::algorithm_partition_isa<lane, n>()};
+        if constexpr(isa == 2)
+        {
+            auto bits{mask.to_bitmask()};
+            auto low{static_cast<::std::size_t>(::std::popcount(bits))};
+            if constexpr(sizeof(lane) == 4)
+            {
+                using vi32 = ::cppfastbox::detail::simd_vector_t<int, 64>;
+                auto data{::std::bit_cast<vi32>(value.vector)};
+                auto mask_low{static_cast<::std::uint16_t>(bits)};
+                __builtin_ia32_compressstoresi512_mask(reinterpret_cast<vi32*>(left), data, mask_low);  //< avx512f
+                __builtin_ia32_compressstoresi512_mask(reinterpret_cast<vi32*>(right_end - (n - low)), data, ~mask_low);  //< avx512f
+            }
+            else
+            {
+                using vi64 = ::cppfastbox::detail::simd_vector_t<long long, 64>;
+                auto data{::std::bit_cast<vi64>(value.vector)};
+                auto mask_low{static_cast<::std::uint8_t>(bits)};
+                __builtin_ia32_compressstoredi512_mask(reinterpret_cast<vi64*>(left), data, mask_low);  //< avx512f
+                __builtin_ia32_compressstoredi512_mask(reinterpret_cast<vi64*>(right_end - (n - low)), data, ~mask_low);  //< avx512f
+            }
+            return low;
+        }
+        else if constexpr(isa == 1)
+        {
+            // 表项放入128位向量的低8字节，大小依赖模板参数以推迟内建函数的查找
+            using vi8 = ::cppfastbox::detail::simd_vector_t<char, sizeof(lane) * n / 2>;
+            using vi64 = ::cppfastbox::detail::simd_vector_t<long long, sizeof(lane) * n / 2>;
+            using vi32 = ::cppfastbox::detail::simd_vector_t<int, 32>;
+            auto bits{mask.to_bitmask()};
+            auto entry{static_cast<long long>(::cppfastbox::detail::algorithm_partition_table_v<n>.value[bits])};
+            auto index{__builtin_ia32_pmovzxbd256(::std::bit_cast<vi8>(vi64{entry, 0}))};  //< avx2
+            ::cppfastbox::simd<lane, n> result{::std::bit_cast<typename ::cppfastbox::simd<lane, n>::vector_type>(
+                __builtin_ia32_permvarsi256(::std::bit_cast<vi32>(value.vector), index))};  //< avx2
+            result.store(left);
+            result.store(right_end - n);
+            return static_cast<::std::size_t>(::std::popcount(bits));
+        }
+        else
+        {
+            auto low{0zu};
+            auto high{0zu};
+            for(auto i{0zu}; i < n; i++)
+            {
+                auto element{value[i]};
+                auto is_low{mask[i]};
+                left[low] = element;
+                right_end[-1 - static_cast<::std::ptrdiff_t>(high)] = element;
+                low += is_low;
+                high += !is_low;
+            }
+            return low;
+        }
+    }
+
+    /**
+     * @brief 以向量划分
+     *
+     * @tparam inclusive 为true时划分为不大于pivot和大于pivot的两部分，否则划分为小于pivot和不小于pivot的两部分
+     * @param count 元素数，不小于2n
+     * @return 前一部分的元素数
+     * @note 先保存两端的向量以留出空位，每次从空位较少的一端读取，使两端始终各有至少n个空位。剩余的元素逐元素写入
+     */
+    template <bool inclusive, typename lane, ::std::size_t n>
+    inline ::std::size_t algorithm_partition(lane* ptr, ::std::size_t count, lane pivot) noexcept
+    {
+        using vector = ::cppfastbox::simd<lane, n>;
+        vector pivot_vector{pivot};
+        auto saved_left{vector::load(ptr)};
+        auto saved_right{vector::load(ptr + count - n)};
+        auto left_write{0zu};
+        auto right_write{count};
+        auto left_read{n};
+        auto right_read{count - n};
+        while(right_read - left_read >= n)
+        {
+            vector value;
+            if(left_read - left_write <= right_write - right_read)
+            {
+                value = vector::load(ptr + left_read);
+                left_read += n;
+            }
+            else
+            {
+                right_read -= n;
+                value = vector::load(ptr + right_read);
+            }
+            auto mask{inclusive ? value <= pivot_vector : value < pivot_vector};
+            auto low{::cppfastbox::detail::algorithm_partition_store(value, mask, ptr + left_write, ptr + right_write)};
+            left_write += low;
+            right_write -= n - low;
+        }
+        // 复制剩余的元素后，left_write和right_write之间均为空位
+        lane rest[n];
+        auto rest_count{right_read - left_read};
+        for(auto i{0zu}; i < rest_count; i++) { rest[i] = ptr[left_read + i]; }
+        auto scalar{[&](lane element) noexcept {
+            auto is_low{inclusive ? !(pivot < element) : element < pivot};
+            ptr[left_write] = element;
+            ptr[right_write - 1] = element;
+            left_write += is_low;
+            right_write -= !is_low;
+        }};
+        for(auto i{0zu}; i < rest_count; i++) { scalar(rest[i]); }
+        for(auto i{0zu}; i < n; i++) { scalar(saved_left[i]); }
+        for(auto i{0zu}; i < n; i++) { scalar(saved_right[i]); }
+        return left_write;
+    }
+
+    // 9个均匀分布的样本的中位数的中位数
+    template <typename lane>
+    inline lane algorithm_sort_pivot(const lane* ptr, ::std::size_t count) noexcept
+    {
+        auto median{[](lane a, lane b, lane c) noexcept {
+            return ::cppfastbox::max(::cppfastbox::min(a, b), ::cppfastbox::min(::cppfastbox::max(a, b), c));
+        }};
+        auto step{count / 9};
+        auto sample{[&](::std::size_t i) noexcept { return ptr[i * step + step / 2]; }};
+        return median(median(sample(0), sample(1), sample(2)), median(sample(3), sample(4), sample(5)), median(sample(6), sample(7), sample(8)));
+    }
+
+    /**
+     * @brief 以向量快速排序
+     *
+     * @param depth 剩余的递归深度，耗尽时改用堆排序
+     * @note 调用者保证没有NaN。划分后前一部分为空时枢轴是最小值，再次划分出所有等于枢轴的元素，使大量重复的元素不会退化
+     */
+    template <typename lane>
+    inline void algorithm_vector_sort(lane* ptr, ::std::size_t count, ::std::size_t depth) noexcept
+    {
+        constexpr auto n{::cppfastbox::detail::algorithm_lanes<lane>};
+        while(count > n * 8)
+        {
+            if(depth == 0)
+            {
+                ::std::ranges::less comp{};
+                ::cppfastbox::detail::algorithm_heap_sort(ptr, ptr + count, comp);
+                return;
+            }
+            depth--;
+            auto pivot{::cppfastbox::detail::algorithm_sort_pivot(ptr, count)};
+            auto middle{::cppfastbox::detail::algorithm_partition<false, lane, n>(ptr, count, pivot)};
+            if(middle == 0)
+            {
+                middle = ::cppfastbox::detail::algorithm_partition<true, lane, n>(ptr, count, pivot);
+                ptr += middle;
+                count -= middle;
+            }
+            else if(middle < count - middle)
+            {
+                ::cppfastbox::detail::algorithm_vector_sort(ptr, middle, depth);
+                ptr += middle;
+                count -= middle;
+            }
+            else
+            {
+                ::cppfastbox::detail::algorithm_vector_sort(ptr + middle, count - middle, depth);
+                count = middle;
+            }
+        }
+        auto vectors{(count + n - 1) / n};
+        if(vectors <= 1) { ::cppfastbox::detail::algorithm_bitonic_sort<lane, n, 1>(ptr, count); }
+        else if(vectors <= 2) { ::cppfastbox::detail::algorithm_bitonic_sort<lane, n, 2>(ptr, count); }
+        else if(vectors <= 4) { ::cppfastbox::detail::algorithm_bitonic_sort<lane, n, 4>(ptr, count); }
+        else { ::cppfastbox::detail::algorithm_bitonic_sort<lane, n, 8>(ptr, count); }
+    }
+
+    // 与<等价的比较
+    template <typename compare, typename type>
+    concept algorithm_less = ::std::same_as<compare, ::std::ranges::less> || ::std::same_as<compare, ::std::less<>> ||
+                             ::std::same_as<compare, ::std::less<type>>;
+
+    // 可以以向量排序的元素
+    template <typename iterator, typename sentinel, typename compare>
+    concept algorithm_sort_contiguous = ::cppfastbox::detail::algorithm_contiguous<iterator, sentinel> &&
+                                        ::std::is_arithmetic_v<::std::iter_value_t<iterator>> &&
+                                        !::std::same_as<::std::iter_value_t<iterator>, bool> &&
+                                        ::cppfastbox::detail::algorithm_less<compare, ::std::iter_value_t<iterator>>;
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 不稳定排序
+     *
+     * @param comp 比较函数，默认为<
+     * @note 以<排序连续迭代器指向的算术类型时，以双调排序网络排序小的块，以向量划分的快速排序处理大的块，
+     *       否则使用内省排序。以<排序浮点数时NaN被移动到末尾，其余元素有序
+     */
+    template <::std::random_access_iterator iterator, ::std::sentinel_for<iterator> sentinel, typename compare = ::std::ranges::less>
+        requires (::std::sortable<iterator, compare>)
+    constexpr inline void sort(iterator first, sentinel last, compare comp = {}) noexcept
+    {
+        auto end{::std::ranges::next(first, last)};
+        using value_type = ::std::iter_value_t<iterator>;
+        if constexpr(::std::floating_point<value_type> && ::cppfastbox::detail::algorithm_less<compare, value_type>)
+        {
+            // NaN与任何元素都不满足<，不构成严格弱序
+            for(auto i{first}; i != end;)
+            {
+                if(*i != *i) { ::std::ranges::iter_swap(i, --end); }
+                else { ++i; }
+            }
+        }
+        if constexpr(::cppfastbox::detail::algorithm_sort_contiguous<iterator, iterator, compare>)
+        {
+            if !consteval
+            {
+                using lane = ::cppfastbox::detail::algorithm_lane_t<value_type>;
+                auto count{static_cast<::std::size_t>(end - first)};
+                auto ptr{reinterpret_cast<lane*>(::std::to_address(first))};
+                ::cppfastbox::detail::algorithm_vector_sort(ptr, count, static_cast<::std::size_t>(::std::bit_width(count)) * 2);
+                return;
+            }
+        }
+        auto count{static_cast<::std::size_t>(end - first)};
+        ::cppfastbox::detail::algorithm_introsort(first, end, comp, static_cast<::std::size_t>(::std::bit_width(count)) * 2);
+    }
+}  // namespace cppfastbox
+
+namespace cppfastbox
+{
+    /**
+     * @brief 可以作为基数排序的键的类型
+     *
+     * @note 包括所有整数、128位整数、float和double
+     */
+    template <typename type>
+    concept radix_sort_key = ::cppfastbox::integral<type> || ::std::same_as<type, ::cppfastbox::uint128_t> ||
+                             ::std::same_as<type, ::cppfastbox::int128_t> || ::std::same_as<type, float> || ::std::same_as<type, double>;
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    /**
+     * @brief 将键映射为无符号整数，使无符号整数的大小关系与键相同
+     *
+     * @return 16字节的键映射为uint128_t，其余映射为相同大小的无符号整数
+     * @note 有符号数翻转符号位；浮点数为正时置符号位，为负时按位取反，负零排在正零之前，
+     *       符号位为0的NaN排在正无穷之后，符号位为1的NaN排在负无穷之前
+     */
+    template <::cppfastbox::radix_sort_key type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline auto algorithm_radix_key(const type& value) noexcept
+    {
+        if constexpr(::std::same_as<type, ::cppfastbox::uint128_t>) { return value; }
+        else if constexpr(::std::same_as<type, ::cppfastbox::int128_t>)
+        {
+            return ::cppfastbox::uint128_t{static_cast<::std::uint64_t>(value.hi) ^ (1ull << 63), value.lo};
+        }
+        else if constexpr(sizeof(type) == 16)
+        {
+            auto high{static_cast<::std::uint64_t>(value >> 64)};
+            if constexpr(::cppfastbox::signed_integral<type>) { high ^= 1ull << 63; }
+            return ::cppfastbox::uint128_t{high, static_cast<::std::uint64_t>(value)};
+        }
+        else
+        {
+            using key = ::cppfastbox::fixed_size_integer_t<false, sizeof(type)>;
+            constexpr auto sign{static_cast<key>(static_cast<key>(1) << (sizeof(type) * 8 - 1))};
+            if constexpr(::std::floating_point<type>)
+            {
+                auto bits{::std::bit_cast<key>(value)};
+                return static_cast<key>((bits & sign) != 0 ? ~bits : bits | sign);
+            }
+            else if constexpr(::cppfastbox::signed_integral<type>) { return static_cast<key>(static_cast<key>(value) ^ sign); }
+            else { return static_cast<key>(value); }
+        }
+    }
+
+    // 键的第pass个字节，从最低字节开始
+    template <typename key>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t algorithm_radix_digit(const key& value, ::std::size_t pass) noexcept
+    {
+        if constexpr(::std::same_as<key, ::cppfastbox::uint128_t>)
+        {
+            auto part{pass < 8 ? value.lo : value.hi};
+            return static_cast<::std::size_t>(part >> (pass % 8 * 8) & 0xff);
+        }
+        else { return static_cast<::std::size_t>(value >> (pass * 8) & 0xff); }
+    }
+
+    /**
+     * @brief 最低位优先的基数排序，每轮排序一个字节
+     *
+     * @param scratch 至少容纳count个元素的缓冲区
+     * @note 一次读取建立所有轮的直方图，所有元素的某个字节相同时跳过该轮。元素在data和scratch之间交替分发，
+     *       结果位于scratch时复制回data。元素不多于32个时以插入排序代替
+     */
+    template <typename type, typename projection>
+    constexpr inline void algorithm_radix_sort(type* data, type* scratch, ::std::size_t count, projection& proj) noexcept
+    {
+        auto key{[&proj](const type& value) constexpr noexcept {
+            return ::cppfastbox::detail::algorithm_radix_key(::std::invoke(proj, value));
+        }};
+        if(count <= 32)
+        {
+            auto less{[&key](const type& a, const type& b) constexpr noexcept { return key(a) < key(b); }};
+            ::cppfastbox::detail::algorithm_insertion_sort(data, data + count, less);
+            return;
+        }
+        constexpr auto passes{sizeof(decltype(key(*data)))};
+        ::std::size_t histogram[passes][256]{};
+        for(auto i{0zu}; i < count; i++)
+        {
+            auto value{key(data[i])};
+            for(auto pass{0zu}; pass < passes; pass++) { histogram[pass][::cppfastbox::detail::algorithm_radix_digit(value, pass)]++; }
+        }
+        auto source{data};
+        auto target{scratch};
+        for(auto pass{0zu}; pass < passes; pass++)
+        {
+            auto& offset{histogram[pass]};
+            if(offset[::cppfastbox::detail::algorithm_radix_digit(key(source[0]), pass)] == count) { continue; }
+            auto sum{0zu};
+            for(auto& i : offset)
+            {
+                auto bucket{i};
+                i = sum;
+                sum += bucket;
+            }
+            for(auto i{0zu}; i < count; i++)
+            {
+                auto digit{::cppfastbox::detail::algorithm_radix_digit(key(source[i]), pass)};
+                ::std::construct_at(target + offset[digit]++, source[i]);
+            }
+            auto temp{source};
+            source = target;
+            target = temp;
+        }
+        if(source != data)
+        {
+            for(auto i{0zu}; i < count; i++) { data[i] = source[i]; }
+        }
+    }
+
+    // 可以以基数排序的元素，投影的结果作为键
+    template <typename iterator, typename sentinel, typename projection>
+    concept algorithm_radix_sortable =
+        ::std::contiguous_iterator<iterator> && ::std::sized_sentinel_for<sentinel, iterator> && ::std::permutable<iterator> &&
+        ::std::is_trivially_copyable_v<::std::iter_value_t<iterator>> && ::std::indirectly_regular_unary_invocable<projection&, iterator> &&
+        ::cppfastbox::radix_sort_key<::std::remove_cvref_t<::std::indirect_result_t<projection&, iterator>>>;
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 稳定的基数排序，使用调用者提供的缓冲区
+     *
+     * @param scratch 至少容纳last - first个元素的缓冲区，其内容被覆盖
+     * @param proj 由元素得到键的投影，默认为元素本身
+     * @note 按键映射为无符号整数后的大小排序，浮点数的顺序见algorithm_radix_key
+     */
+    template <::std::contiguous_iterator iterator, ::std::sized_sentinel_for<iterator> sentinel, typename projection = ::std::identity>
+        requires (::cppfastbox::detail::algorithm_radix_sortable<iterator, sentinel, projection>)
+    constexpr inline void radix_sort(iterator first, sentinel last, ::std::iter_value_t<iterator>* scratch, projection proj = {}) noexcept
+    {
+        auto count{static_cast<::std::size_t>(last - first)};
+        ::cppfastbox::detail::algorithm_radix_sort(::std::to_address(first), scratch, count, proj);
+    }
+
+    /**
+     * @brief 稳定的基数排序
+     *
+     * @param proj 由元素得到键的投影，默认为元素本身
+     * @note 每次调用分配一次与范围等大的缓冲区，元素不多于32个时不分配
+     * @code {.cpp}
+     * cppfastbox::radix_sort(records.begin(), records.end(), &record::id);
+     * @endcode
+     */
+    template <::std::contiguous_iterator iterator, ::std::sized_sentinel_for<iterator> sentinel, typename projection = ::std::identity>
+        requires (::cppfastbox::detail::algorithm_radix_sortable<iterator, sentinel, projection>)
+    constexpr inline void radix_sort(iterator first, sentinel last, projection proj = {}) noexcept
+    {
+        using value_type = ::std::iter_value_t<iterator>;
+        auto count{static_cast<::std::size_t>(last - first)};
+        if(count <= 32)
+        {
+            ::cppfastbox::detail::algorithm_radix_sort<value_type>(::std::to_address(first), nullptr, count, proj);
+            return;
+        }
+        ::std::allocator<value_type> allocator{};
+        auto scratch{allocator.allocate(count)};
+        ::cppfastbox::detail::algorithm_radix_sort(::std::to_address(first), scratch, count, proj);
+        allocator.deallocate(scratch, count);
+    }
+}  // namespace cppfastbox
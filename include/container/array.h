@@ -8,6 +8,7 @@
 #pragma once
 #include <iterator>
 #include "../libc/assert.h"
+#include "../libc/memcmp.h"
 #include "algorithm.h"
 
 /**
@@ -106,7 +107,7 @@ namespace cppfastbox
             {
                 if constexpr(::cppfastbox::trivially_equality_comparable<value_type>)
                 {
-                    return __builtin_memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) == 0;
+                    return ::cppfastbox::libc::bcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) == 0;
                 }
             }
             for(auto i{0zu}; i < size(); i++)
@@ -123,7 +124,7 @@ namespace cppfastbox
             {
                 if constexpr(::cppfastbox::trivially_three_way_comparable<value_type>)
                 {
-                    return result_type{__builtin_memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) <=> 0};
+                    return result_type{::cppfastbox::libc::memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) <=> 0};
                 }
             }
             for(auto i{0zu}; i < size(); i++)
@@ -512,7 +513,7 @@ namespace cppfastbox
             {
                 if constexpr(::cppfastbox::trivially_equality_comparable<value_type>)
                 {
-                    return __builtin_memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) == 0;
+                    return ::cppfastbox::libc::bcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) == 0;
                 }
                 else
                 {
@@ -535,7 +536,7 @@ namespace cppfastbox
             {
                 if constexpr(::cppfastbox::trivially_three_way_comparable<value_type>)
                 {
-                    return result_type{__builtin_memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) <=> 0};
+                    return result_type{::cppfastbox::libc::memcmp(::std::addressof(a), ::std::addressof(b), size() * sizeof(value_type)) <=> 0};
                 }
                 else
                 {
@@ -663,6 +664,194 @@ namespace cppfastbox
     }
 }  // namespace cppfastbox
 
+namespace cppfastbox::detail
+{
+    /**
+     * @brief 编译期生成的Batcher奇偶归并排序网络
+     *
+     * @tparam n 元素数
+     * @note 比较器按层排列，同一层的比较器互不相交。4和8个元素时比较器数最优，32个元素时为191个，已知最优为185个
+     */
+    template <::std::size_t n>
+    struct array_sort_network
+    {
+        /**
+         * @brief 按层遍历所有比较器
+         *
+         * @param visit 以层、较小的索引和较大的索引调用
+         * @return 层数
+         */
+        template <typename function>
+        consteval inline static ::std::size_t visit(function visit) noexcept
+        {
+            auto layer{0zu};
+            for(auto p{1zu}; p < n; p <<= 1)
+            {
+                for(auto k{p}; k >= 1; k >>= 1)
+                {
+                    auto empty{true};
+                    for(auto j{k % p}; j + k < n; j += k * 2)
+                    {
+                        for(auto i{0zu}; i < ::cppfastbox::min(k, n - j - k); i++)
+                        {
+                            if((i + j) / (p * 2) == (i + j + k) / (p * 2))
+                            {
+                                visit(layer, i + j, i + j + k);
+                                empty = false;
+                            }
+                        }
+                    }
+                    if(!empty) { layer++; }
+                }
+            }
+            return layer;
+        }
+
+        consteval inline static ::std::size_t get_comparators() noexcept
+        {
+            auto count{0zu};
+            visit([&count](::std::size_t, ::std::size_t, ::std::size_t) constexpr noexcept { count++; });
+            return count;
+        }
+
+        // 比较器数
+        constexpr inline static ::std::size_t comparators{get_comparators()};
+        // 层数
+        constexpr inline static ::std::size_t layers{visit([](::std::size_t, ::std::size_t, ::std::size_t) constexpr noexcept {})};
+
+        ::std::size_t low[comparators + 1]{};
+        ::std::size_t high[comparators + 1]{};
+        // 第i层的比较器为[layer_begin[i], layer_begin[i + 1])
+        ::std::size_t layer_begin[layers + 1]{};
+
+        consteval inline array_sort_network() noexcept
+        {
+            auto count{0zu};
+            visit([this, &count](::std::size_t layer, ::std::size_t i, ::std::size_t j) constexpr noexcept {
+                low[count] = i;
+                high[count] = j;
+                layer_begin[layer + 1] = ++count;
+            });
+        }
+    };
+
+    template <::std::size_t n>
+    constexpr inline ::cppfastbox::detail::array_sort_network<n> array_sort_network_v{};
+
+    // 比较交换，b < a时交换，算术类型以条件选择代替分支
+    template <typename type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline void array_sort_exchange(type& a, type& b) noexcept
+    {
+        if constexpr(::std::is_arithmetic_v<type>)
+        {
+            auto x{a};
+            auto y{b};
+            auto swap{y < x};
+            a = swap ? y : x;
+            b = swap ? x : y;
+        }
+        else
+        {
+            if(b < a) { ::std::ranges::swap(a, b); }
+        }
+    }
+
+    /**
+     * @brief 以向量执行排序网络的一层
+     *
+     * @note 每个元素与其在本层的比较对象以编译期确定的重排对齐，较小的索引取较小者；不在本层的元素与自身比较
+     */
+    template <::std::size_t n, ::std::size_t layer, typename type, ::std::size_t lanes>
+    CPPFASTBOX_ALWAYS_INLINE inline void array_sort_layer(::cppfastbox::simd<type, lanes>& value) noexcept
+    {
+        struct table
+        {
+            ::std::size_t partner[lanes];
+            bool is_low[lanes];
+        };
+
+        constexpr auto layer_table{[] consteval noexcept {
+            constexpr auto& network{::cppfastbox::detail::array_sort_network_v<n>};
+            table result{};
+            for(auto i{0zu}; i < lanes; i++)
+            {
+                result.partner[i] = i;
+                result.is_low[i] = true;
+            }
+            for(auto i{network.layer_begin[layer]}; i < network.layer_begin[layer + 1]; i++)
+            {
+                result.partner[network.low[i]] = network.high[i];
+                result.partner[network.high[i]] = network.low[i];
+                result.is_low[network.high[i]] = false;
+            }
+            return result;
+        }()};
+        [&value]<::std::size_t... i>(::std::index_sequence<i...>) noexcept {
+            auto partner{shuffle<layer_table.partner[i]...>(value)};
+            auto low{min(value, partner)};
+            auto high{max(value, partner)};
+            value.vector = __builtin_shufflevector(low.vector, high.vector, (layer_table.is_low[i] ? i : lanes + i)...);
+        }(::std::make_index_sequence<lanes>{});
+    }
+
+    // 可以在一个向量中执行排序网络的元素
+    template <typename type, ::std::size_t n>
+    concept array_sort_simd = ::cppfastbox::simd_element<type> && ::std::is_arithmetic_v<type> && n >= 4 &&
+                              sizeof(type) * ::std::bit_ceil(n) <= ::cppfastbox::cpu_flags::native_simd_max_size;
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 以编译期生成的排序网络排序定长数组
+     *
+     * @note 以<比较，不稳定。元素数不超过64时展开为无分支的比较交换，整个数组可以放入一个向量时每层以向量的min和max计算；
+     *       更多的元素使用sort(first, last)
+     */
+    template <typename type, ::std::size_t n>
+    constexpr inline void sort(::cppfastbox::array<type, n>& array) noexcept
+    {
+        if constexpr(n > 64) { ::cppfastbox::sort(array.begin(), array.end()); }
+        else
+        {
+            if constexpr(::cppfastbox::detail::array_sort_simd<type, n>)
+            {
+                if !consteval
+                {
+                    constexpr auto lanes{::std::bit_ceil(n)};
+                    using vector = ::cppfastbox::simd<type, lanes>;
+                    auto sort_vector{[](vector& value) noexcept {
+                        [&value]<::std::size_t... layer>(::std::index_sequence<layer...>) noexcept {
+                            (::cppfastbox::detail::array_sort_layer<n, layer>(value), ...);
+                        }(::std::make_index_sequence<::cppfastbox::detail::array_sort_network<n>::layers>{});
+                    }};
+                    if constexpr(lanes == n)
+                    {
+                        auto value{vector::load(array.array)};
+                        sort_vector(value);
+                        value.store(array.array);
+                    }
+                    else
+                    {
+                        // 不足一个向量的部分不参与比较，以0填充
+                        type buffer[lanes]{};
+                        __builtin_memcpy(buffer, array.array, sizeof(array.array));
+                        auto value{vector::load(buffer)};
+                        sort_vector(value);
+                        value.store(buffer);
+                        __builtin_memcpy(array.array, buffer, sizeof(array.array));
+                    }
+                    return;
+                }
+            }
+            constexpr auto& network{::cppfastbox::detail::array_sort_network_v<n>};
+            [&array]<::std::size_t... i>(::std::index_sequence<i...>) constexpr noexcept {
+                (::cppfastbox::detail::array_sort_exchange(array.array[network.low[i]], array.array[network.high[i]]), ...);
+            }(::std::make_index_sequence<network.comparators>{});
+        }
+    }
+}  // namespace cppfastbox
+
 namespace std
 {
     template <::std::size_t index, typename type_in, ::std::size_t n, ::std::size_t... next>
@@ -0,0 +1,898 @@
+/**
+ * @file simd.h
+ * @brief 可移植的定长向量
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+#include "../base/divider.h"
+#include "../base/min_max.h"
+#include "../base/utility.h"
+
+namespace cppfastbox
+{
+    // 可以作为simd元素的类型
+    template <typename type>
+    concept simd_element = (::cppfastbox::fixed_size_integral<type> && sizeof(type) <= 8) || ::cppfastbox::simd_integral<type> ||
+                           ::std::same_as<type, float> || ::std::same_as<type, double>;
+
+    /**
+     * @brief 硬件支持的最大向量可以容纳的元素数
+     *
+     * @note 硬件不支持向量化时为1，此时simd退化为标量
+     */
+    template <::cppfastbox::simd_element type>
+    constexpr inline auto simd_native_lanes{::cppfastbox::max(::cppfastbox::cpu_flags::native_simd_max_size, sizeof(type)) / sizeof(type)};
+
+    template <::cppfastbox::simd_element type, ::std::size_t n = ::cppfastbox::simd_native_lanes<type>>
+        requires (::std::has_single_bit(n))
+    struct simd_mask;
+
+    template <::cppfastbox::simd_element type, ::std::size_t n = ::cppfastbox::simd_native_lanes<type>>
+        requires (::std::has_single_bit(n))
+    struct simd;
+}  // namespace cppfastbox
+
+namespace cppfastbox::detail
+{
+    // 由type组成的size字节的向量
+    template <typename type, ::std::size_t size>
+    using simd_vector_t [[__gnu__::__vector_size__(size)]] = type;
+
+    // 向量的元素类型
+    template <typename vector>
+    using simd_element_t = ::std::remove_cvref_t<decltype(::std::declval<vector>()[0])>;
+
+    // 将向量拆分为低半部分和高半部分
+    template <typename vector>
+    CPPFASTBOX_ALWAYS_INLINE inline auto simd_split(vector value) noexcept
+    {
+        using half = ::cppfastbox::detail::simd_vector_t<::cppfastbox::detail::simd_element_t<vector>, sizeof(vector) / 2>;
+        struct
+        {
+            half low;
+            half high;
+        } result;
+        __builtin_memcpy(&result, &value, sizeof(vector));
+        return result;
+    }
+
+    // 将有符号整数向量转换为无符号整数向量，使加减乘法在溢出时回绕
+    template <typename vector>
+    constexpr inline auto simd_wrapping(vector value) noexcept
+    {
+        using element = ::cppfastbox::detail::simd_element_t<vector>;
+        if constexpr(::cppfastbox::signed_integral<element>)
+        {
+            return ::std::bit_cast<::cppfastbox::detail::simd_vector_t<::std::make_unsigned_t<element>, sizeof(vector)>>(value);
+        }
+        else { return value; }
+    }
+
+    /**
+     * @brief 获取可以由单条指令将掩码向量转换为位掩码的最大向量大小
+     *
+     * @tparam element_size 元素大小
+     * @note 不支持时为0，更大的向量需要拆分
+     */
+    template <::std::size_t element_size>
+    consteval inline ::std::size_t simd_bitmask_max_size() noexcept
+    {
+        if constexpr(!::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>() && !::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x64>())
+        {
+            return 0zu;
+        }
+        else if constexpr(element_size <= 2 ? ::cppfastbox::cpu_flags::x86::avx512bw_support : ::cppfastbox::cpu_flags::x86::avx512dq_support)
+        {
+            return 64zu;
+        }
+        else if constexpr(::cppfastbox::cpu_flags::x86::avx2_support) { return 32zu; }
+        else if constexpr(::cppfastbox::cpu_flags::x86::avx_support && element_size >= 4) { return 32zu; }
+        else if constexpr(::cppfastbox::cpu_flags::x86::sse2_support) { return 16zu; }
+        else { return 0zu; }
+    }
+
+    /**
+     * @brief 将掩码向量转换为位掩码
+     *
+     * @param mask 每个元素为0或-1的向量
+     * @return 第i位为第i个元素的最高位
+     */
+    template <typename vector>
+    inline ::std::uint64_t simd_to_bitmask(vector mask) noexcept
+    {
+        constexpr auto size{sizeof(vector)};
+        constexpr auto element_size{sizeof(::cppfastbox::detail::simd_element_t<vector>)};
+        constexpr auto lanes{size / element_size};
+        constexpr auto max_size{::cppfastbox::detail::simd_bitmask_max_size<element_size>()};
+        if constexpr(max_size == 0 || size < 16)
+        {
+            ::std::uint64_t bits{};
+            for(auto i{0zu}; i < lanes; i++) { bits |= static_cast<::std::uint64_t>(mask[i] & 1) << i; }
+            return bits;
+        }
+        else if constexpr(size > max_size)
+        {
+            auto [low, high]{::cppfastbox::detail::simd_split(mask)};
+            return ::cppfastbox::detail::simd_to_bitmask(low) | ::cppfastbox::detail::simd_to_bitmask(high) << (lanes / 2);
+        }
+        else if constexpr(size == 64)
+        {
+            if constexpr(element_size == 1)
+            {
+                return __builtin_ia32_cvtb2mask512(::std::bit_cast<::cppfastbox::detail::simd_vector_t<char, 64>>(mask));  //< avx512bw
+            }
+            else if constexpr(element_size == 2)
+            {
+                return __builtin_ia32_cvtw2mask512(::std::bit_cast<::cppfastbox::detail::simd_vector_t<short, 64>>(mask));  //< avx512bw
+            }
+            else if constexpr(element_size == 4)
+            {
+                return __builtin_ia32_cvtd2mask512(::std::bit_cast<::cppfastbox::detail::simd_vector_t<int, 64>>(mask));  //< avx512dq
+            }
+            else
+            {
+                return __builtin_ia32_cvtq2mask512(::std::bit_cast<::cppfastbox::detail::simd_vector_t<long long, 64>>(mask));  //< avx512dq
+            }
+        }
+        else if constexpr(element_size == 1)
+        {
+            using vi8 = ::cppfastbox::detail::simd_vector_t<char, size>;
+            if constexpr(size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb256(::std::bit_cast<vi8>(mask))); }  //< avx2
+            else { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb128(::std::bit_cast<vi8>(mask))); }  //< sse2
+        }
+        else if constexpr(element_size == 2)
+        {
+            // 以有符号饱和将每个元素压缩为1字节
+            using vi16 = ::cppfastbox::detail::simd_vector_t<short, 16>;
+            vi16 low;
+            vi16 high{};
+            __builtin_memcpy(&low, &mask, 16);
+            if constexpr(size == 32) { __builtin_memcpy(&high, reinterpret_cast<const char*>(&mask) + 16, 16); }
+            auto packed{__builtin_ia32_packsswb128(low, high)};                               //< sse2
+            return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb128(packed));  //< sse2
+        }
+        else if constexpr(element_size == 4)
+        {
+            using vf32 = ::cppfastbox::detail::simd_vector_t<float, size>;
+            if constexpr(size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_movmskps256(::std::bit_cast<vf32>(mask))); }  //< avx
+            else { return static_cast<::std::uint32_t>(__builtin_ia32_movmskps(::std::bit_cast<vf32>(mask))); }  //< sse
+        }
+        else
+        {
+            using vf64 = ::cppfastbox::detail::simd_vector_t<double, size>;
+            if constexpr(size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_movmskpd256(::std::bit_cast<vf64>(mask))); }  //< avx
+            else { return static_cast<::std::uint32_t>(__builtin_ia32_movmskpd(::std::bit_cast<vf64>(mask))); }  //< sse2
+        }
+    }
+
+    // 以divider逐元素相除，元素转换为divider接受的向量扩展使用的整数类型
+    template <typename vector, typename type>
+    inline vector simd_divide(vector dividend, const ::cppfastbox::divider<type>& divisor) noexcept
+    {
+        using element = decltype(::cppfastbox::detail::get_simd_integral_impl<::cppfastbox::signed_integral<type>, sizeof(type)>());
+        using integral_vector = ::cppfastbox::detail::simd_vector_t<element, sizeof(vector)>;
+        return ::std::bit_cast<vector>(divisor.divide(::std::bit_cast<integral_vector>(dividend)));
+    }
+
+    /**
+     * @brief 是否可以使用avx512的掩码读写指令
+     *
+     * @note 1字节和2字节元素需要avx512bw，小于512位的向量需要avx512vl
+     */
+    template <::std::size_t element_size, ::std::size_t size>
+    consteval inline bool simd_masked_avx512_support() noexcept
+    {
+        if constexpr(!::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>() && !::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x64>())
+        {
+            return false;
+        }
+        else
+        {
+            auto isa{element_size <= 2 ? ::cppfastbox::cpu_flags::x86::avx512bw_support : ::cppfastbox::cpu_flags::x86::avx512f_support};
+            return isa && size >= 16 && (size == 64 || ::cppfastbox::cpu_flags::x86::avx512vl_support);
+        }
+    }
+
+    // 是否可以使用avx2的掩码读写指令，仅支持4字节和8字节元素
+    template <::std::size_t element_size, ::std::size_t size>
+    consteval inline bool simd_masked_avx2_support() noexcept
+    {
+        if constexpr(!::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x86>() && !::cppfastbox::is_cpu_arch<::cppfastbox::cpu_arch::x64>())
+        {
+            return false;
+        }
+        else { return ::cppfastbox::cpu_flags::x86::avx2_support && element_size >= 4 && (size == 16 || size == 32); }
+    }
+
+    /**
+     * @brief 读取掩码中非0的元素，其余元素为0
+     *
+     * @note 被屏蔽的元素不会被访问，即使它们位于不可读的页中
+     */
+    template <typename vector, typename mask_vector>
+    inline vector simd_load_masked(const ::cppfastbox::detail::simd_element_t<vector>* ptr, mask_vector mask) noexcept
+    {
+        using element = ::cppfastbox::detail::simd_element_t<vector>;
+        constexpr auto size{sizeof(vector)};
+        constexpr auto element_size{sizeof(element)};
+        if constexpr(::cppfastbox::detail::simd_masked_avx512_support<element_size, size>())
+        {
+            auto bits{::cppfastbox::detail::simd_to_bitmask(mask)};
+            if constexpr(element_size == 1)
+            {
+                using vi8 = ::cppfastbox::detail::simd_vector_t<char, size>;
+                auto p{reinterpret_cast<const char*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquqi512_mask(p, vi8{}, bits));  //< avx512bw
+                }
+                else if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquqi256_mask(p, vi8{}, bits));  //< avx512vl
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquqi128_mask(p, vi8{}, bits));  //< avx512vl
+                }
+            }
+            else if constexpr(element_size == 2)
+            {
+                using vi16 = ::cppfastbox::detail::simd_vector_t<short, size>;
+                auto p{reinterpret_cast<const short*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquhi512_mask(p, vi16{}, bits));  //< avx512bw
+                }
+                else if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquhi256_mask(p, vi16{}, bits));  //< avx512vl
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddquhi128_mask(p, vi16{}, bits));  //< avx512vl
+                }
+            }
+            else if constexpr(element_size == 4)
+            {
+                using vi32 = ::cppfastbox::detail::simd_vector_t<int, size>;
+                auto p{reinterpret_cast<const int*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqusi512_mask(p, vi32{}, bits));  //< avx512f
+                }
+                else if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqusi256_mask(p, vi32{}, bits));  //< avx512vl
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqusi128_mask(p, vi32{}, bits));  //< avx512vl
+                }
+            }
+            else
+            {
+                using vi64 = ::cppfastbox::detail::simd_vector_t<long long, size>;
+                auto p{reinterpret_cast<const long long*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqudi512_mask(p, vi64{}, bits));  //< avx512f
+                }
+                else if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqudi256_mask(p, vi64{}, bits));  //< avx512vl
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_loaddqudi128_mask(p, vi64{}, bits));  //< avx512vl
+                }
+            }
+        }
+        else if constexpr(::cppfastbox::detail::simd_masked_avx2_support<element_size, size>())
+        {
+            if constexpr(element_size == 4)
+            {
+                using vi32 = ::cppfastbox::detail::simd_vector_t<int, size>;
+                auto p{reinterpret_cast<const vi32*>(ptr)};
+                if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_maskloadd256(p, ::std::bit_cast<vi32>(mask)));  //< avx2
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_maskloadd(p, ::std::bit_cast<vi32>(mask)));  //< avx2
+                }
+            }
+            else
+            {
+                using vi64 = ::cppfastbox::detail::simd_vector_t<long long, size>;
+                auto p{reinterpret_cast<const vi64*>(ptr)};
+                if constexpr(size == 32)
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_maskloadq256(p, ::std::bit_cast<vi64>(mask)));  //< avx2
+                }
+                else
+                {
+                    return ::std::bit_cast<vector>(__builtin_ia32_maskloadq(p, ::std::bit_cast<vi64>(mask)));  //< avx2
+                }
+            }
+        }
+        else
+        {
+            vector result{};
+            for(auto i{0zu}; i < size / element_size; i++)
+            {
+                if(mask[i] != 0) { result[i] = ptr[i]; }
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief 写入掩码中非0的元素
+     *
+     * @note 被屏蔽的元素不会被访问，即使它们位于不可写的页中
+     */
+    template <typename vector, typename mask_vector>
+    inline void simd_store_masked(::cppfastbox::detail::simd_element_t<vector>* ptr, vector value, mask_vector mask) noexcept
+    {
+        using element = ::cppfastbox::detail::simd_element_t<vector>;
+        constexpr auto size{sizeof(vector)};
+        constexpr auto element_size{sizeof(element)};
+        if constexpr(::cppfastbox::detail::simd_masked_avx512_support<element_size, size>())
+        {
+            auto bits{::cppfastbox::detail::simd_to_bitmask(mask)};
+            if constexpr(element_size == 1)
+            {
+                using vi8 = ::cppfastbox::detail::simd_vector_t<char, size>;
+                auto p{reinterpret_cast<char*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    __builtin_ia32_storedquqi512_mask(p, ::std::bit_cast<vi8>(value), bits);  //< avx512bw
+                }
+                else if constexpr(size == 32)
+                {
+                    __builtin_ia32_storedquqi256_mask(p, ::std::bit_cast<vi8>(value), bits);  //< avx512vl
+                }
+                else
+                {
+                    __builtin_ia32_storedquqi128_mask(p, ::std::bit_cast<vi8>(value), bits);  //< avx512vl
+                }
+            }
+            else if constexpr(element_size == 2)
+            {
+                using vi16 = ::cppfastbox::detail::simd_vector_t<short, size>;
+                auto p{reinterpret_cast<short*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    __builtin_ia32_storedquhi512_mask(p, ::std::bit_cast<vi16>(value), bits);  //< avx512bw
+                }
+                else if constexpr(size == 32)
+                {
+                    __builtin_ia32_storedquhi256_mask(p, ::std::bit_cast<vi16>(value), bits);  //< avx512vl
+                }
+                else
+                {
+                    __builtin_ia32_storedquhi128_mask(p, ::std::bit_cast<vi16>(value), bits);  //< avx512vl
+                }
+            }
+            else if constexpr(element_size == 4)
+            {
+                using vi32 = ::cppfastbox::detail::simd_vector_t<int, size>;
+                auto p{reinterpret_cast<int*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    __builtin_ia32_storedqusi512_mask(p, ::std::bit_cast<vi32>(value), bits);  //< avx512f
+                }
+                else if constexpr(size == 32)
+                {
+                    __builtin_ia32_storedqusi256_mask(p, ::std::bit_cast<vi32>(value), bits);  //< avx512vl
+                }
+                else
+                {
+                    __builtin_ia32_storedqusi128_mask(p, ::std::bit_cast<vi32>(value), bits);  //< avx512vl
+                }
+            }
+            else
+            {
+                using vi64 = ::cppfastbox::detail::simd_vector_t<long long, size>;
+                auto p{reinterpret_cast<long long*>(ptr)};
+                if constexpr(size == 64)
+                {
+                    __builtin_ia32_storedqudi512_mask(p, ::std::bit_cast<vi64>(value), bits);  //< avx512f
+                }
+                else if constexpr(size == 32)
+                {
+                    __builtin_ia32_storedqudi256_mask(p, ::std::bit_cast<vi64>(value), bits);  //< avx512vl
+                }
+                else
+                {
+                    __builtin_ia32_storedqudi128_mask(p, ::std::bit_cast<vi64>(value), bits);  //< avx512vl
+                }
+            }
+        }
+        else if constexpr(::cppfastbox::detail::simd_masked_avx2_support<element_size, size>())
+        {
+            if constexpr(element_size == 4)
+            {
+                using vi32 = ::cppfastbox::detail::simd_vector_t<int, size>;
+                auto p{reinterpret_cast<vi32*>(ptr)};
+                if constexpr(size == 32)
+                {
+                    __builtin_ia32_maskstored256(p, ::std::bit_cast<vi32>(mask), ::std::bit_cast<vi32>(value));  //< avx2
+                }
+                else
+                {
+                    __builtin_ia32_maskstored(p, ::std::bit_cast<vi32>(mask), ::std::bit_cast<vi32>(value));  //< avx2
+                }
+            }
+            else
+            {
+                using vi64 = ::cppfastbox::detail::simd_vector_t<long long, size>;
+                auto p{reinterpret_cast<vi64*>(ptr)};
+                if constexpr(size == 32)
+                {
+                    __builtin_ia32_maskstoreq256(p, ::std::bit_cast<vi64>(mask), ::std::bit_cast<vi64>(value));  //< avx2
+                }
+                else
+                {
+                    __builtin_ia32_maskstoreq(p, ::std::bit_cast<vi64>(mask), ::std::bit_cast<vi64>(value));  //< avx2
+                }
+            }
+        }
+        else
+        {
+            for(auto i{0zu}; i < size / element_size; i++)
+            {
+                if(mask[i] != 0) { ptr[i] = value[i]; }
+            }
+        }
+    }
+}  // namespace cppfastbox::detail
+
+namespace cppfastbox
+{
+    /**
+     * @brief 定长向量的逐元素比较结果
+     *
+     * @tparam type 被比较的向量的元素类型
+     * @tparam n 元素数
+     * @note 每个元素为0或-1，与被比较的向量的元素大小相同
+     */
+    template <::cppfastbox::simd_element type, ::std::size_t n>
+        requires (::std::has_single_bit(n))
+    struct simd_mask
+    {
+        using value_type = bool;
+        using size_type = ::std::size_t;
+        using element_type = ::cppfastbox::fixed_size_integer_t<true, sizeof(type)>;
+        using vector_type = ::cppfastbox::detail::simd_vector_t<element_type, sizeof(type) * n>;
+
+        vector_type vector{};
+
+        constexpr inline simd_mask() noexcept = default;
+
+        constexpr inline simd_mask(vector_type value) noexcept : vector{value} {}
+
+        // 将value广播到所有元素
+        constexpr inline explicit simd_mask(bool value) noexcept : vector{vector_type{} - static_cast<element_type>(value)} {}
+
+        [[nodiscard]] consteval inline static size_type size() noexcept { return n; }
+
+        [[nodiscard]] constexpr inline bool operator[] (size_type index) const noexcept { return vector[index] != 0; }
+
+        // 由位掩码构造，第i位对应第i个元素
+        [[nodiscard]] constexpr inline static simd_mask from_bitmask(::std::uint64_t bits) noexcept
+            requires (n <= 64)
+        {
+            return [bits]<::std::size_t... index>(::std::index_sequence<index...>) constexpr noexcept {
+                return simd_mask{vector_type{static_cast<element_type>(-static_cast<element_type>(bits >> index & 1))...}};
+            }(::std::make_index_sequence<n>{});
+        }
+
+        // 转换为位掩码，第i位对应第i个元素
+        [[nodiscard]] constexpr inline ::std::uint64_t to_bitmask() const noexcept
+            requires (n <= 64)
+        {
+            if consteval
+            {
+                ::std::uint64_t bits{};
+                for(auto i{0zu}; i < n; i++) { bits |= static_cast<::std::uint64_t>(vector[i] & 1) << i; }
+                return bits;
+            }
+            else { return ::cppfastbox::detail::simd_to_bitmask(vector); }
+        }
+
+        // 是否存在非0的元素
+        [[nodiscard]] constexpr inline bool any() const noexcept { return to_bitmask() != 0; }
+
+        // 是否所有元素均非0
+        [[nodiscard]] constexpr inline bool all() const noexcept { return to_bitmask() == (~0ull >> (64 - n)); }
+
+        // 是否所有元素均为0
+        [[nodiscard]] constexpr inline bool none() const noexcept { return to_bitmask() == 0; }
+
+        // 非0元素的个数
+        [[nodiscard]] constexpr inline ::std::size_t count() const noexcept { return static_cast<::std::size_t>(::std::popcount(to_bitmask())); }
+
+        /**
+         * @brief 第一个非0元素的索引
+         *
+         * @note 所有元素均为0时返回n
+         */
+        [[nodiscard]] constexpr inline ::std::size_t first_index() const noexcept
+        {
+            return ::cppfastbox::min(static_cast<::std::size_t>(::std::countr_zero(to_bitmask())), n);
+        }
+
+        [[nodiscard]] friend constexpr inline simd_mask operator& (const simd_mask& a, const simd_mask& b) noexcept
+        {
+            return simd_mask{a.vector & b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd_mask operator| (const simd_mask& a, const simd_mask& b) noexcept
+        {
+            return simd_mask{a.vector | b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd_mask operator^ (const simd_mask& a, const simd_mask& b) noexcept
+        {
+            return simd_mask{a.vector ^ b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd_mask operator~ (const simd_mask& a) noexcept { return simd_mask{~a.vector}; }
+    };
+
+    /**
+     * @brief 基于向量扩展的定长向量
+     *
+     * @tparam type 元素类型
+     * @tparam n 元素数，默认为硬件支持的最大向量可以容纳的元素数
+     * @note 超过硬件支持的向量由编译器拆分，不支持向量化时由编译器逐元素计算
+     * @code {.cpp}
+     * auto a{cppfastbox::simd<float>::load(ptr)};
+     * auto sum{reduce_add(a * a)};
+     * @endcode
+     */
+    template <::cppfastbox::simd_element type, ::std::size_t n>
+        requires (::std::has_single_bit(n))
+    struct simd
+    {
+        using value_type = type;
+        using size_type = ::std::size_t;
+        using mask_type = ::cppfastbox::simd_mask<type, n>;
+        using vector_type = ::cppfastbox::detail::simd_vector_t<type, sizeof(type) * n>;
+
+        vector_type vector{};
+
+        constexpr inline simd() noexcept = default;
+
+        constexpr inline simd(vector_type value) noexcept : vector{value} {}
+
+        // 将value广播到所有元素
+        constexpr inline simd(const type& value) noexcept : vector{vector_type{} + value} {}
+
+        [[nodiscard]] consteval inline static size_type size() noexcept { return n; }
+
+        [[nodiscard]] constexpr inline type operator[] (size_type index) const noexcept { return vector[index]; }
+
+        // 从非对齐的地址读取
+        [[nodiscard]] inline static simd load(const type* ptr) noexcept
+        {
+            simd result;
+            __builtin_memcpy(&result.vector, ptr, sizeof(vector_type));
+            return result;
+        }
+
+        // 从按向量大小对齐的地址读取
+        [[nodiscard]] inline static simd load_aligned(const type* ptr) noexcept
+        {
+            return simd{*static_cast<const vector_type*>(__builtin_assume_aligned(ptr, sizeof(vector_type)))};
+        }
+
+        /**
+         * @brief 读取掩码中为真的元素，其余元素为0
+         *
+         * @note 被屏蔽的元素不会被访问，可用于读取数组末尾不足一个向量的部分
+         */
+        [[nodiscard]] inline static simd load_masked(const type* ptr, const mask_type& mask) noexcept
+        {
+            return simd{::cppfastbox::detail::simd_load_masked<vector_type>(ptr, mask.vector)};
+        }
+
+        // 写入非对齐的地址
+        inline void store(type* ptr) const noexcept { __builtin_memcpy(ptr, &vector, sizeof(vector_type)); }
+
+        // 写入按向量大小对齐的地址
+        inline void store_aligned(type* ptr) const noexcept
+        {
+            *static_cast<vector_type*>(__builtin_assume_aligned(ptr, sizeof(vector_type))) = vector;
+        }
+
+        // 写入掩码中为真的元素，被屏蔽的元素不会被访问
+        inline void store_masked(type* ptr, const mask_type& mask) const noexcept
+        {
+            ::cppfastbox::detail::simd_store_masked(ptr, vector, mask.vector);
+        }
+
+        // 低半部分
+        [[nodiscard]] constexpr inline auto low() const noexcept
+            requires (n > 1)
+        {
+            return [this]<::std::size_t... index>(::std::index_sequence<index...>) constexpr noexcept {
+                return ::cppfastbox::simd<type, n / 2>{__builtin_shufflevector(vector, vector, index...)};
+            }(::std::make_index_sequence<n / 2>{});
+        }
+
+        // 高半部分
+        [[nodiscard]] constexpr inline auto high() const noexcept
+            requires (n > 1)
+        {
+            return [this]<::std::size_t... index>(::std::index_sequence<index...>) constexpr noexcept {
+                return ::cppfastbox::simd<type, n / 2>{__builtin_shufflevector(vector, vector, (n / 2 + index)...)};
+            }(::std::make_index_sequence<n / 2>{});
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator+ (const simd& a) noexcept { return a; }
+
+        [[nodiscard]] friend constexpr inline simd operator- (const simd& a) noexcept
+        {
+            return simd{::std::bit_cast<vector_type>(-::cppfastbox::detail::simd_wrapping(a.vector))};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator+ (const simd& a, const simd& b) noexcept
+        {
+            return simd{::std::bit_cast<vector_type>(::cppfastbox::detail::simd_wrapping(a.vector) +
+                                                     ::cppfastbox::detail::simd_wrapping(b.vector))};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator- (const simd& a, const simd& b) noexcept
+        {
+            return simd{::std::bit_cast<vector_type>(::cppfastbox::detail::simd_wrapping(a.vector) -
+                                                     ::cppfastbox::detail::simd_wrapping(b.vector))};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator* (const simd& a, const simd& b) noexcept
+        {
+            return simd{::std::bit_cast<vector_type>(::cppfastbox::detail::simd_wrapping(a.vector) *
+                                                     ::cppfastbox::detail::simd_wrapping(b.vector))};
+        }
+
+        // 整数除法没有向量指令，除数不变时应使用divider
+        [[nodiscard]] friend constexpr inline simd operator/ (const simd& a, const simd& b) noexcept { return simd{a.vector / b.vector}; }
+
+        [[nodiscard]] friend constexpr inline simd operator% (const simd& a, const simd& b) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector % b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator~ (const simd& a) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{~a.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator& (const simd& a, const simd& b) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector & b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator| (const simd& a, const simd& b) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector | b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator^ (const simd& a, const simd& b) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector ^ b.vector};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator<< (const simd& a, int shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector << shift};
+        }
+
+        [[nodiscard]] friend constexpr inline simd operator>> (const simd& a, int shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector >> shift};
+        }
+
+        // 逐元素移位
+        [[nodiscard]] friend constexpr inline simd operator<< (const simd& a, const simd& shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector << shift.vector};
+        }
+
+        // 逐元素移位
+        [[nodiscard]] friend constexpr inline simd operator>> (const simd& a, const simd& shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return simd{a.vector >> shift.vector};
+        }
+
+        /**
+         * @brief 除以运行时不变的除数
+         *
+         * @note 以乘法的高半部分代替逐元素的除法
+         */
+        template <::cppfastbox::fixed_size_integral divisor_type>
+            requires (::cppfastbox::integral<type> &&
+                      ::std::same_as<divisor_type, ::cppfastbox::fixed_size_integer_t<::cppfastbox::signed_integral<type>, sizeof(type)>>)
+        [[nodiscard]] friend inline simd operator/ (const simd& a, const ::cppfastbox::divider<divisor_type>& divisor) noexcept
+        {
+            return simd{::cppfastbox::detail::simd_divide(a.vector, divisor)};
+        }
+
+        // 对运行时不变的除数取余
+        template <::cppfastbox::fixed_size_integral divisor_type>
+            requires (::cppfastbox::integral<type> &&
+                      ::std::same_as<divisor_type, ::cppfastbox::fixed_size_integer_t<::cppfastbox::signed_integral<type>, sizeof(type)>>)
+        [[nodiscard]] friend inline simd operator% (const simd& a, const ::cppfastbox::divider<divisor_type>& divisor) noexcept
+        {
+            return a - a / divisor * simd{static_cast<type>(divisor.divisor())};
+        }
+
+        constexpr inline simd& operator+= (const simd& other) noexcept { return *this = *this + other; }
+
+        constexpr inline simd& operator-= (const simd& other) noexcept { return *this = *this - other; }
+
+        constexpr inline simd& operator*= (const simd& other) noexcept { return *this = *this * other; }
+
+        constexpr inline simd& operator/= (const simd& other) noexcept { return *this = *this / other; }
+
+        constexpr inline simd& operator&= (const simd& other) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return *this = *this & other;
+        }
+
+        constexpr inline simd& operator|= (const simd& other) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return *this = *this | other;
+        }
+
+        constexpr inline simd& operator^= (const simd& other) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return *this = *this ^ other;
+        }
+
+        constexpr inline simd& operator<<= (int shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return *this = *this << shift;
+        }
+
+        constexpr inline simd& operator>>= (int shift) noexcept
+            requires (::cppfastbox::integral<type>)
+        {
+            return *this = *this >> shift;
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator== (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector == b.vector)};
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator!= (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector != b.vector)};
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator< (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector < b.vector)};
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator<= (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector <= b.vector)};
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator> (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector > b.vector)};
+        }
+
+        [[nodiscard]] friend constexpr inline mask_type operator>= (const simd& a, const simd& b) noexcept
+        {
+            return mask_type{::std::bit_cast<typename mask_type::vector_type>(a.vector >= b.vector)};
+        }
+
+        /**
+         * @brief 逐元素选择，掩码为真时选择a，否则选择b
+         *
+         * @note 常量求值时向量的条件运算符不可用，以位运算代替
+         */
+        [[nodiscard]] friend constexpr inline simd blend(const mask_type& mask, const simd& a, const simd& b) noexcept
+        {
+            if consteval
+            {
+                using bits_vector = typename mask_type::vector_type;
+                auto bits_a{::std::bit_cast<bits_vector>(a.vector)};
+                auto bits_b{::std::bit_cast<bits_vector>(b.vector)};
+                return simd{::std::bit_cast<vector_type>(static_cast<bits_vector>((mask.vector & bits_a) | (~mask.vector & bits_b)))};
+            }
+            else { return simd{mask.vector ? a.vector : b.vector}; }
+        }
+
+        [[nodiscard]] friend constexpr inline simd min(const simd& a, const simd& b) noexcept { return blend(b < a, b, a); }
+
+        [[nodiscard]] friend constexpr inline simd max(const simd& a, const simd& b) noexcept { return blend(a < b, b, a); }
+
+        /**
+         * @brief 以二元运算归约所有元素
+         *
+         * @param op 接受两个simd<type, n / 2>并返回simd<type, n / 2>的运算
+         * @note 以对半折叠的顺序计算，浮点数的结果可能与顺序累加不同
+         */
+        template <typename operation>
+        [[nodiscard]] friend constexpr inline type reduce(const simd& value, operation op) noexcept
+        {
+            if constexpr(n == 1) { return value.vector[0]; }
+            else { return reduce(op(value.low(), value.high()), op); }
+        }
+
+        // 所有元素的和
+        [[nodiscard]] friend constexpr inline type reduce_add(const simd& value) noexcept
+        {
+            return reduce(value, [](const auto& a, const auto& b) constexpr noexcept { return a + b; });
+        }
+
+        // 所有元素的最小值
+        [[nodiscard]] friend constexpr inline type reduce_min(const simd& value) noexcept
+        {
+            return reduce(value, [](const auto& a, const auto& b) constexpr noexcept { return min(a, b); });
+        }
+
+        // 所有元素的最大值
+        [[nodiscard]] friend constexpr inline type reduce_max(const simd& value) noexcept
+        {
+            return reduce(value, [](const auto& a, const auto& b) constexpr noexcept { return max(a, b); });
+        }
+
+        /**
+         * @brief 以编译期确定的索引重排元素
+         *
+         * @tparam indices 结果的第i个元素为value的第indices[i]个元素
+         */
+        template <::std::size_t... indices>
+            requires (sizeof...(indices) == n && ((indices < n) && ...))
+        [[nodiscard]] friend constexpr inline simd shuffle(const simd& value) noexcept
+        {
+            return simd{__builtin_shufflevector(value.vector, value.vector, indices...)};
+        }
+
+        /**
+         * @brief 以运行时确定的索引重排元素
+         *
+         * @param index 结果的第i个元素为value的第index[i] % n个元素
+         */
+        template <::cppfastbox::simd_element index_type>
+            requires (::cppfastbox::integral<index_type> && sizeof(index_type) == sizeof(type))
+        [[nodiscard]] friend inline simd permute(const simd& value, const ::cppfastbox::simd<index_type, n>& index) noexcept
+        {
+#ifdef __clang__
+            simd result;
+            for(auto i{0zu}; i < n; i++) { result.vector[i] = value.vector[static_cast<::std::size_t>(index.vector[i]) % n]; }
+            return result;
+#else
+            using index_vector = typename mask_type::vector_type;
+            return simd{__builtin_shuffle(value.vector, ::std::bit_cast<index_vector>(index.vector))};
+#endif
+        }
+    };
+}  // namespace cppfastbox
@@ -12,26 +12,23 @@
     #include <cstdio>
 #endif
 #include "../base/assert.h"
-#if __has_include(<charconv>)
-// 实现itoa后替换此处
-#include <charconv>
-#endif
+#include "../base/charconv.h"
 #undef assert
 
 namespace cppfastbox
 {
     namespace detail
     {
-#if __has_include(<cstdio>) && __has_include(<charconv>)
+#if __has_include(<cstdio>)
         [[noreturn]] inline void assert_failed(const char* file, unsigned line, unsigned colum, const char* function) noexcept
         {
             ::fwrite("Assert failed: In file ", 1, 23, stderr);
             ::fwrite(file, 1, __builtin_strlen(file), stderr);
             ::fwrite(" ", 1, 1, stderr);
             char buf[32]{};
-            auto res{::std::to_chars(buf, buf + 32, line).ptr};
+            auto res{::cppfastbox::to_chars(buf, line)};
             *res++ = ':';
-            res = ::std::to_chars(res, buf + 32, colum).ptr;
+            res = ::cppfastbox::to_chars(res, colum);
             __builtin_memcpy(res, " function: ", 11);
             res += 11;
             ::fwrite(buf, 1, res - buf, stderr);
@@ -0,0 +1,148 @@
+/**
+ * @file lane.h
+ * @brief 按通道读写内存的公共支持
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <cstdint>
+#include "../base/utility.h"
+#include "../base/cpu_runtime.h"
+
+/**
+ * @brief 按通道读写内存
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    // 拷贝和填充使用的最大通道大小
+    constexpr inline auto copy_lane_max_size{::cppfastbox::cpu_flags::native_ls_lane_max_size};
+    // 无法获取末级缓存大小时使用的非临时存储阈值
+    constexpr inline auto default_nontemporal_threshold{4zu * 1024 * 1024};
+
+    /**
+     * @brief 获取非临时存储阈值，不小于该大小的拷贝和填充使用非临时存储
+     *
+     * @note 阈值为运行时探测到的末级缓存大小的3/4，超过它的写入无法从缓存中获益，反而会将其他数据逐出缓存；
+     * 首次调用时计算并缓存
+     */
+    inline ::std::size_t nontemporal_threshold() noexcept
+    {
+        static const auto threshold{[]() noexcept -> ::std::size_t
+                                    {
+                                        auto size{::cppfastbox::cpu_flags::runtime::l3_cache_size()};
+                                        if(size == 0) { size = ::cppfastbox::cpu_flags::runtime::l2_cache_size(); }
+                                        return size == 0 ? ::cppfastbox::libc::detail::default_nontemporal_threshold : size / 4 * 3;
+                                    }()};
+        return threshold;
+    }
+    // 是否支持非临时存储
+    constexpr inline auto support_nontemporal_store{::cppfastbox::is_cpu_family<::cppfastbox::cpu_family::x86>() &&
+                                                    ::cppfastbox::cpu_flags::x86::sse2_support};
+
+    /**
+     * @brief 可以非对齐读写且可以别名任何类型的通道
+     *
+     * @note 直接解引用而不是使用__builtin_memcpy，避免调试模式下生成对memcpy自身的调用
+     */
+    template <::std::size_t size>
+    struct unaligned_lane;
+
+    template <>
+    struct unaligned_lane<64>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l64_t;
+    };
+
+    template <>
+    struct unaligned_lane<32>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l32_t;
+    };
+
+    template <>
+    struct unaligned_lane<16>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l16_t;
+    };
+
+    template <>
+    struct unaligned_lane<8>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l8_t;
+    };
+
+    template <>
+    struct unaligned_lane<4>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l4_t;
+    };
+
+    template <>
+    struct unaligned_lane<2>
+    {
+        using type [[__gnu__::__aligned__(1), __gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l2_t;
+    };
+
+    template <>
+    struct unaligned_lane<1>
+    {
+        using type [[__gnu__::__may_alias__]] = ::cppfastbox::native_ls_lanes::l1_t;
+    };
+
+    template <::std::size_t size>
+    using unaligned_lane_t = ::cppfastbox::libc::detail::unaligned_lane<size>::type;
+
+    template <::std::size_t size>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::unaligned_lane_t<size> load_lane(const void* ptr) noexcept
+    {
+        return *static_cast<const ::cppfastbox::libc::detail::unaligned_lane_t<size>*>(ptr);
+    }
+
+    template <::std::size_t size>
+    CPPFASTBOX_ALWAYS_INLINE inline void store_lane(void* ptr, ::cppfastbox::libc::detail::unaligned_lane_t<size> value) noexcept
+    {
+        *static_cast<::cppfastbox::libc::detail::unaligned_lane_t<size>*>(ptr) = value;
+    }
+
+    /**
+     * @brief 将字节广播到通道的所有字节
+     *
+     */
+    template <::std::size_t size>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::unaligned_lane_t<size> broadcast_lane(::std::uint8_t byte) noexcept
+    {
+        using lane = ::cppfastbox::libc::detail::unaligned_lane_t<size>;
+        if constexpr(size >= 16) { return lane{} + ::std::uint64_t{byte} * 0x01010101'01010101u; }
+        else { return static_cast<lane>(::std::uint64_t{byte} * 0x01010101'01010101u); }
+    }
+
+    /**
+     * @brief 绕过缓存写入一个通道
+     *
+     * @param ptr 要写入的地址，必须对齐到size
+     * @note 使用后需要调用nontemporal_fence
+     */
+    template <::std::size_t size>
+    CPPFASTBOX_ALWAYS_INLINE inline void store_lane_nontemporal(void* ptr, ::cppfastbox::libc::detail::unaligned_lane_t<size> value) noexcept
+    {
+        using vi64 [[__gnu__::__vector_size__(size)]] = long long;
+        static_assert(size >= 16, "Non-temporal store requires vector lanes.");
+#ifdef __clang__
+        __builtin_nontemporal_store(::std::bit_cast<vi64>(value), static_cast<vi64*>(__builtin_assume_aligned(ptr, size)));
+#else
+        if constexpr(size == 64) { __builtin_ia32_movntdq512(static_cast<vi64*>(ptr), ::std::bit_cast<vi64>(value)); }  //< avx512f
+        else if constexpr(size == 32) { __builtin_ia32_movntdq256(static_cast<vi64*>(ptr), ::std::bit_cast<vi64>(value)); }  //< avx
+        else { __builtin_ia32_movntdq(static_cast<vi64*>(ptr), ::std::bit_cast<vi64>(value)); }  //< sse2
+#endif
+    }
+
+    // 使非临时存储对其他核心可见
+    CPPFASTBOX_ALWAYS_INLINE inline void nontemporal_fence() noexcept
+    {
+#ifdef __SSE2__
+        __builtin_ia32_sfence();  //< sse
+#endif
+    }
+}  // namespace cppfastbox::libc::detail
@@ -0,0 +1,195 @@
+/**
+ * @file memchr.h
+ * @brief 实现memchr、memrchr和rawmemchr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "scan.h"
+
+/**
+ * @brief memchr标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* memchr_scalar(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        for(auto i{0zu}; i < count; i++)
+        {
+            if(str[i] == ch) { return str + i; }
+        }
+        return nullptr;
+    }
+
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* memrchr_scalar(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        for(auto i{count}; i != 0; i--)
+        {
+            if(str[i - 1] == ch) { return str + i - 1; }
+        }
+        return nullptr;
+    }
+
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* rawmemchr_scalar(const char_type* str, char_type ch) noexcept
+    {
+        while(*str != ch) { str++; }
+        return str;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief memchr向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* memchr_simd(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        const auto vch{::cppfastbox::libc::detail::scan_broadcast<vector_size>(ch)};
+        if(count < lanes)
+        {
+            auto mask{::cppfastbox::libc::detail::scan_partial_equal<vector_size>(str, vch, ch, count)};
+            if(mask == 0) { return nullptr; }
+            return str + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask);
+        }
+        for(auto i{0zu}; count - i > lanes; i += lanes)
+        {
+            auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(
+                ::cppfastbox::libc::detail::scan_load<vector_size>(str + i),
+                vch)};
+            if(mask != 0) { return str + i + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        }
+        // 最后一个向量与之前的向量重叠，重叠部分中没有ch
+        const auto last{str + count - lanes};
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load<vector_size>(last), vch)};
+        if(mask == 0) { return nullptr; }
+        return last + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask);
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* memrchr_simd(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        const auto vch{::cppfastbox::libc::detail::scan_broadcast<vector_size>(ch)};
+        if(count < lanes)
+        {
+            auto mask{::cppfastbox::libc::detail::scan_partial_equal<vector_size>(str, vch, ch, count)};
+            if(mask == 0) { return nullptr; }
+            return str + ::cppfastbox::libc::detail::scan_last_index<vector_size, char_type>(mask);
+        }
+        for(auto i{count}; i > lanes; i -= lanes)
+        {
+            const auto block{str + i - lanes};
+            auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load<vector_size>(block), vch)};
+            if(mask != 0) { return block + ::cppfastbox::libc::detail::scan_last_index<vector_size, char_type>(mask); }
+        }
+        // 第一个向量与之后的向量重叠，重叠部分中没有ch
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load<vector_size>(str), vch)};
+        if(mask == 0) { return nullptr; }
+        return str + ::cppfastbox::libc::detail::scan_last_index<vector_size, char_type>(mask);
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* rawmemchr_simd(const char_type* str, char_type ch) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        const auto vch{::cppfastbox::libc::detail::scan_broadcast<vector_size>(ch)};
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        // 屏蔽str之前的元素
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                 vch) >>
+                  shift};
+        if(mask != 0) { return str + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        while(true)
+        {
+            block += lanes;
+            mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                  vch);
+            if(mask != 0) { return block + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 在str的前count个字符中查找第一个ch
+     *
+     * @param str 要查找的字符串
+     * @param ch 要查找的字符
+     * @param count 要查找的字符数
+     * @return 指向第一个ch的指针，若找不到则为nullptr
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* memchr(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::memchr_scalar(str, ch, count); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memchr_simd(ptr, fixed_ch, count));
+            }
+            else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memchr_scalar(ptr, fixed_ch, count)); }
+        }
+    }
+
+    /**
+     * @brief 在str的前count个字符中查找最后一个ch
+     *
+     * @param str 要查找的字符串
+     * @param ch 要查找的字符
+     * @param count 要查找的字符数
+     * @return 指向最后一个ch的指针，若找不到则为nullptr
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* memrchr(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::memrchr_scalar(str, ch, count); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memrchr_simd(ptr, fixed_ch, count));
+            }
+            else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memrchr_scalar(ptr, fixed_ch, count)); }
+        }
+    }
+
+    /**
+     * @brief 查找第一个ch，调用者保证ch存在
+     *
+     * @param str 要查找的字符串
+     * @param ch 要查找的字符
+     * @return 指向第一个ch的指针
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* rawmemchr(const char_type* str, char_type ch) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::rawmemchr_scalar(str, ch); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::rawmemchr_simd(ptr, fixed_ch));
+            }
+            else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::rawmemchr_scalar(ptr, fixed_ch)); }
+        }
+    }
+}  // namespace cppfastbox::libc
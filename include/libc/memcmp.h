@@ -0,0 +1,280 @@
+/**
+ * @file memcmp.h
+ * @brief 实现memcmp、bcmp和mismatch_index
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "lane.h"
+#include "scan.h"
+
+/**
+ * @brief memcmp标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 获取两个字中第一个不同字节的下标
+     *
+     * @note a和b必须不同
+     */
+    template <::std::unsigned_integral word>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t word_mismatch_index(word a, word b) noexcept
+    {
+        auto diff{static_cast<word>(a ^ b)};
+        if constexpr(::std::endian::native == ::std::endian::little) { return static_cast<::std::size_t>(::std::countr_zero(diff)) / 8; }
+        else { return static_cast<::std::size_t>(::std::countl_zero(diff)) / 8; }
+    }
+
+    /**
+     * @brief 使用首尾两个可能重叠的字查找[1, 2 * lane]字节中第一个不同字节的下标
+     *
+     * @return 第一个不同字节的下标，若全部相同则为size
+     */
+    template <::std::size_t lane = 8>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t mismatch_index_small(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        if constexpr(lane != 1)
+        {
+            if(size < lane) { return ::cppfastbox::libc::detail::mismatch_index_small<lane / 2>(a, b, size); }
+        }
+        auto head_a{::cppfastbox::libc::detail::load_lane<lane>(a)};
+        auto head_b{::cppfastbox::libc::detail::load_lane<lane>(b)};
+        if(head_a != head_b) { return ::cppfastbox::libc::detail::word_mismatch_index(head_a, head_b); }
+        auto tail_a{::cppfastbox::libc::detail::load_lane<lane>(a + size - lane)};
+        auto tail_b{::cppfastbox::libc::detail::load_lane<lane>(b + size - lane)};
+        if(tail_a != tail_b) { return size - lane + ::cppfastbox::libc::detail::word_mismatch_index(tail_a, tail_b); }
+        return size;
+    }
+
+    /**
+     * @brief 判断[1, 2 * lane]字节是否不同
+     *
+     */
+    template <::std::size_t lane = 8>
+    CPPFASTBOX_ALWAYS_INLINE inline bool bcmp_small(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        if constexpr(lane != 1)
+        {
+            if(size < lane) { return ::cppfastbox::libc::detail::bcmp_small<lane / 2>(a, b, size); }
+        }
+        auto head{::cppfastbox::libc::detail::load_lane<lane>(a) ^ ::cppfastbox::libc::detail::load_lane<lane>(b)};
+        auto tail{::cppfastbox::libc::detail::load_lane<lane>(a + size - lane) ^ ::cppfastbox::libc::detail::load_lane<lane>(b + size - lane)};
+        return (head | tail) != 0;
+    }
+
+    /**
+     * @brief 按8字节的字查找超过16字节的内存中第一个不同字节的下标
+     *
+     */
+    inline ::std::size_t mismatch_index_word(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        auto i{0zu};
+        for(; size - i > 8; i += 8)
+        {
+            auto wa{::cppfastbox::libc::detail::load_lane<8>(a + i)};
+            auto wb{::cppfastbox::libc::detail::load_lane<8>(b + i)};
+            if(wa != wb) { return i + ::cppfastbox::libc::detail::word_mismatch_index(wa, wb); }
+        }
+        // 最后一个字与之前的字重叠
+        auto wa{::cppfastbox::libc::detail::load_lane<8>(a + size - 8)};
+        auto wb{::cppfastbox::libc::detail::load_lane<8>(b + size - 8)};
+        if(wa != wb) { return size - 8 + ::cppfastbox::libc::detail::word_mismatch_index(wa, wb); }
+        return size;
+    }
+
+    /**
+     * @brief 按8字节的字判断超过16字节的内存是否不同
+     *
+     */
+    inline bool bcmp_word(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        ::std::uint64_t diff{};
+        for(auto i{0zu}; size - i > 8; i += 8)
+        {
+            diff |= ::cppfastbox::libc::detail::load_lane<8>(a + i) ^ ::cppfastbox::libc::detail::load_lane<8>(b + i);
+        }
+        diff |= ::cppfastbox::libc::detail::load_lane<8>(a + size - 8) ^ ::cppfastbox::libc::detail::load_lane<8>(b + size - 8);
+        return diff != 0;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief memcmp向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    // 比较vector_size字节的向量时，所有字节都相等对应的掩码
+    template <::std::size_t vector_size>
+    constexpr inline auto scan_full_mask{vector_size == 16 ? ::cppfastbox::libc::detail::scan_mask_t<vector_size>{0xffff}
+                                                           : ~::cppfastbox::libc::detail::scan_mask_t<vector_size>{}};
+
+    /**
+     * @brief 比较a和b处的一个向量并返回不同字节的掩码
+     *
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_mismatch(const char8_t* a, const char8_t* b) noexcept
+    {
+        return ::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(::cppfastbox::libc::detail::scan_load<vector_size>(a),
+                                                                            ::cppfastbox::libc::detail::scan_load<vector_size>(b)) ^
+               ::cppfastbox::libc::detail::scan_full_mask<vector_size>;
+    }
+
+    /**
+     * @brief 查找超过16字节的内存中第一个不同字节的下标
+     *
+     * @note 不足一个向量时使用两个重叠的半向量
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size>
+    [[nodiscard]] inline ::std::size_t mismatch_index_simd(const char8_t* a, const char8_t* b, ::std::size_t size) noexcept
+    {
+        if constexpr(vector_size > 16)
+        {
+            if(size < vector_size) { return ::cppfastbox::libc::detail::mismatch_index_simd<vector_size / 2>(a, b, size); }
+        }
+        auto i{0zu};
+        // 每次比较两个向量，仅在存在不同时定位下标
+        for(; size - i > 2 * vector_size; i += 2 * vector_size)
+        {
+            auto m0{::cppfastbox::libc::detail::scan_mismatch<vector_size>(a + i, b + i)};
+            auto m1{::cppfastbox::libc::detail::scan_mismatch<vector_size>(a + i + vector_size, b + i + vector_size)};
+            if((m0 | m1) != 0) [[unlikely]]
+            {
+                if(m0 != 0) { return i + ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(m0); }
+                return i + vector_size + ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(m1);
+            }
+        }
+        if(size - i > vector_size)
+        {
+            auto mask{::cppfastbox::libc::detail::scan_mismatch<vector_size>(a + i, b + i)};
+            if(mask != 0) { return i + ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(mask); }
+        }
+        // 最后一个向量与之前的向量重叠
+        auto mask{::cppfastbox::libc::detail::scan_mismatch<vector_size>(a + size - vector_size, b + size - vector_size)};
+        if(mask != 0) { return size - vector_size + ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(mask); }
+        return size;
+    }
+
+    /**
+     * @brief 判断超过16字节的内存是否不同
+     *
+     * @note 只累积差异而不定位下标
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, ::std::size_t unroll = 4>
+    [[nodiscard]] inline bool bcmp_simd(const char8_t* a, const char8_t* b, ::std::size_t size) noexcept
+    {
+        if constexpr(vector_size > 16)
+        {
+            if(size < vector_size) { return ::cppfastbox::libc::detail::bcmp_simd<vector_size / 2>(a, b, size); }
+        }
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        auto i{0zu};
+        for(; size - i > unroll * vector_size; i += unroll * vector_size)
+        {
+            vector diff{};
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto j{0zu}; j < unroll; j++)
+            {
+                diff |= ::cppfastbox::libc::detail::scan_load<vector_size>(a + i + j * vector_size) ^
+                        ::cppfastbox::libc::detail::scan_load<vector_size>(b + i + j * vector_size);
+            }
+            if(::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(diff, vector{}) !=
+               ::cppfastbox::libc::detail::scan_full_mask<vector_size>) [[unlikely]]
+            {
+                return true;
+            }
+        }
+        vector diff{};
+        for(; size - i > vector_size; i += vector_size)
+        {
+            diff |= ::cppfastbox::libc::detail::scan_load<vector_size>(a + i) ^ ::cppfastbox::libc::detail::scan_load<vector_size>(b + i);
+        }
+        // 最后一个向量与之前的向量重叠
+        diff |= ::cppfastbox::libc::detail::scan_load<vector_size>(a + size - vector_size) ^
+                ::cppfastbox::libc::detail::scan_load<vector_size>(b + size - vector_size);
+        return ::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(diff, vector{}) != ::cppfastbox::libc::detail::scan_full_mask<vector_size>;
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size>
+    inline ::std::size_t mismatch_index_impl(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        if(size <= 16) [[likely]]
+        {
+            if(size == 0) { return 0; }
+            return ::cppfastbox::libc::detail::mismatch_index_small(a, b, size);
+        }
+        if constexpr(vector_size != 0)
+        {
+            return ::cppfastbox::libc::detail::mismatch_index_simd<vector_size>(reinterpret_cast<const char8_t*>(a), reinterpret_cast<const char8_t*>(b), size);
+        }
+        else { return ::cppfastbox::libc::detail::mismatch_index_word(a, b, size); }
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size>
+    inline bool bcmp_impl(const char* a, const char* b, ::std::size_t size) noexcept
+    {
+        if(size <= 16) [[likely]]
+        {
+            if(size == 0) { return false; }
+            return ::cppfastbox::libc::detail::bcmp_small(a, b, size);
+        }
+        if constexpr(vector_size != 0)
+        {
+            return ::cppfastbox::libc::detail::bcmp_simd<vector_size>(reinterpret_cast<const char8_t*>(a), reinterpret_cast<const char8_t*>(b), size);
+        }
+        else { return ::cppfastbox::libc::detail::bcmp_word(a, b, size); }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 查找两段内存中第一个不同字节的下标
+     *
+     * @param a 第一段内存
+     * @param b 第二段内存
+     * @param count 要比较的字节数
+     * @return 第一个不同字节的下标，若全部相同则为count
+     */
+    [[nodiscard]] inline ::std::size_t mismatch_index(const void* a, const void* b, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::mismatch_index_impl(static_cast<const char*>(a), static_cast<const char*>(b), count);
+    }
+
+    /**
+     * @brief 按字典序比较两段内存
+     *
+     * @param a 第一段内存
+     * @param b 第二段内存
+     * @param count 要比较的字节数
+     * @return 第一个不同字节按unsigned char比较的结果，若全部相同则为0
+     */
+    [[nodiscard]] inline int memcmp(const void* a, const void* b, ::std::size_t count) noexcept
+    {
+        auto index{::cppfastbox::libc::mismatch_index(a, b, count)};
+        if(index == count) { return 0; }
+        return static_cast<int>(static_cast<const unsigned char*>(a)[index]) - static_cast<int>(static_cast<const unsigned char*>(b)[index]);
+    }
+
+    /**
+     * @brief 判断两段内存是否相同
+     *
+     * @param a 第一段内存
+     * @param b 第二段内存
+     * @param count 要比较的字节数
+     * @return 相同时为0，否则为非0值
+     * @note 不计算大小关系，因此比memcmp更快
+     */
+    [[nodiscard]] inline int bcmp(const void* a, const void* b, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::bcmp_impl(static_cast<const char*>(a), static_cast<const char*>(b), count);
+    }
+}  // namespace cppfastbox::libc
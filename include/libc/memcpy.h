@@ -0,0 +1,221 @@
+/**
+ * @file memcpy.h
+ * @brief 实现memcpy和memmove
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "lane.h"
+
+/**
+ * @brief memcpy实现
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 使用首尾两个可能重叠的通道拷贝[lane, 2 * lane]字节
+     *
+     * @note 先读取再写入，因此允许dest和src重叠
+     */
+    template <::std::size_t lane>
+    CPPFASTBOX_ALWAYS_INLINE inline void copy_head_tail(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        auto head{::cppfastbox::libc::detail::load_lane<lane>(src)};
+        auto tail{::cppfastbox::libc::detail::load_lane<lane>(src + size - lane)};
+        ::cppfastbox::libc::detail::store_lane<lane>(dest, head);
+        ::cppfastbox::libc::detail::store_lane<lane>(dest + size - lane, tail);
+    }
+
+    /**
+     * @brief 拷贝不超过2 * lane字节
+     *
+     * @note 允许dest和src重叠
+     */
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size>
+    CPPFASTBOX_ALWAYS_INLINE inline void copy_small(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        if constexpr(lane == 1)
+        {
+            if(size != 0) { ::cppfastbox::libc::detail::copy_head_tail<1>(dest, src, size); }
+        }
+        else
+        {
+            if(size >= lane) { ::cppfastbox::libc::detail::copy_head_tail<lane>(dest, src, size); }
+            else { ::cppfastbox::libc::detail::copy_small<lane / 2>(dest, src, size); }
+        }
+    }
+
+    /**
+     * @brief 从前向后拷贝超过2 * lane字节
+     *
+     * @tparam nontemporal 是否使用非临时存储
+     * @note 允许dest位于src之前的重叠
+     */
+    template <bool nontemporal, ::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size, ::std::size_t unroll = 4>
+    inline void copy_forward(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        // 首尾通道预先读取并在最后写入，重叠时之前的写入不会影响它们
+        auto head{::cppfastbox::libc::detail::load_lane<lane>(src)};
+        auto tail{::cppfastbox::libc::detail::load_lane<lane>(src + size - lane)};
+        auto* const first{dest};
+        auto* const last{dest + size - lane};
+        // 将dest对齐到通道大小，避免写入跨越缓存行
+        auto skip{lane - reinterpret_cast<::std::uintptr_t>(dest) % lane};
+        dest += skip, src += skip, size -= skip;
+        while(size > unroll * lane)
+        {
+            ::cppfastbox::libc::detail::unaligned_lane_t<lane> buf[unroll];
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto i{0zu}; i < unroll; i++) { buf[i] = ::cppfastbox::libc::detail::load_lane<lane>(src + i * lane); }
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto i{0zu}; i < unroll; i++)
+            {
+                if constexpr(nontemporal) { ::cppfastbox::libc::detail::store_lane_nontemporal<lane>(dest + i * lane, buf[i]); }
+                else { ::cppfastbox::libc::detail::store_lane<lane>(dest + i * lane, buf[i]); }
+            }
+            dest += unroll * lane, src += unroll * lane, size -= unroll * lane;
+        }
+        while(size > lane)
+        {
+            auto buf{::cppfastbox::libc::detail::load_lane<lane>(src)};
+            if constexpr(nontemporal) { ::cppfastbox::libc::detail::store_lane_nontemporal<lane>(dest, buf); }
+            else { ::cppfastbox::libc::detail::store_lane<lane>(dest, buf); }
+            dest += lane, src += lane, size -= lane;
+        }
+        if constexpr(nontemporal) { ::cppfastbox::libc::detail::nontemporal_fence(); }
+        // 剩余不超过一个通道，由尾通道覆盖
+        ::cppfastbox::libc::detail::store_lane<lane>(first, head);
+        ::cppfastbox::libc::detail::store_lane<lane>(last, tail);
+    }
+
+    /**
+     * @brief 从后向前拷贝超过2 * lane字节
+     *
+     * @note 允许dest位于src之后的重叠
+     */
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size, ::std::size_t unroll = 4>
+    inline void copy_backward(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        // 首尾通道预先读取并在最后写入，重叠时之前的写入不会影响它们
+        auto head{::cppfastbox::libc::detail::load_lane<lane>(src)};
+        auto tail{::cppfastbox::libc::detail::load_lane<lane>(src + size - lane)};
+        auto* const first{dest};
+        auto* const last{dest + size - lane};
+        dest += size, src += size;
+        // 将dest的结尾对齐到通道大小，避免写入跨越缓存行
+        auto skip{reinterpret_cast<::std::uintptr_t>(dest) % lane};
+        skip = skip == 0 ? lane : skip;
+        dest -= skip, src -= skip, size -= skip;
+        while(size > unroll * lane)
+        {
+            ::cppfastbox::libc::detail::unaligned_lane_t<lane> buf[unroll];
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto i{0zu}; i < unroll; i++) { buf[i] = ::cppfastbox::libc::detail::load_lane<lane>(src - (i + 1) * lane); }
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto i{0zu}; i < unroll; i++) { ::cppfastbox::libc::detail::store_lane<lane>(dest - (i + 1) * lane, buf[i]); }
+            dest -= unroll * lane, src -= unroll * lane, size -= unroll * lane;
+        }
+        while(size > lane)
+        {
+            dest -= lane, src -= lane, size -= lane;
+            ::cppfastbox::libc::detail::store_lane<lane>(dest, ::cppfastbox::libc::detail::load_lane<lane>(src));
+        }
+        // 剩余不超过一个通道，由首通道覆盖
+        ::cppfastbox::libc::detail::store_lane<lane>(first, head);
+        ::cppfastbox::libc::detail::store_lane<lane>(last, tail);
+    }
+
+    /**
+     * @brief 拷贝不重叠的内存
+     *
+     */
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size>
+    inline void memcpy_impl(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        if(size <= 2 * lane) [[likely]] { ::cppfastbox::libc::detail::copy_small<lane>(dest, src, size); }
+        else
+        {
+            if constexpr(::cppfastbox::libc::detail::support_nontemporal_store && lane >= 16)
+            {
+                if(size >= ::cppfastbox::libc::detail::nontemporal_threshold()) [[unlikely]]
+                {
+                    ::cppfastbox::libc::detail::copy_forward<true, lane>(dest, src, size);
+                    return;
+                }
+            }
+            ::cppfastbox::libc::detail::copy_forward<false, lane>(dest, src, size);
+        }
+    }
+
+    /**
+     * @brief 拷贝可能重叠的内存
+     *
+     */
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size>
+    inline void memmove_impl(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        if(size <= 2 * lane) [[likely]] { ::cppfastbox::libc::detail::copy_small<lane>(dest, src, size); }
+        else
+        {
+            auto d{reinterpret_cast<::std::uintptr_t>(dest)};
+            auto s{reinterpret_cast<::std::uintptr_t>(src)};
+            // dest不在[src, src + size)中时可以从前向后拷贝
+            if(d - s >= size)
+            {
+                // 完全不重叠时等同于memcpy
+                if(s - d >= size) { ::cppfastbox::libc::detail::memcpy_impl<lane>(dest, src, size); }
+                else { ::cppfastbox::libc::detail::copy_forward<false, lane>(dest, src, size); }
+            }
+            else { ::cppfastbox::libc::detail::copy_backward<lane>(dest, src, size); }
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 拷贝不重叠的内存
+     *
+     * @param dest 目标地址
+     * @param src 源地址
+     * @param count 要拷贝的字节数
+     * @return dest
+     */
+    inline void* memcpy(void* dest, const void* src, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memcpy_impl(static_cast<char*>(dest), static_cast<const char*>(src), count);
+        return dest;
+    }
+
+    /**
+     * @brief 拷贝可能重叠的内存
+     *
+     * @param dest 目标地址
+     * @param src 源地址
+     * @param count 要拷贝的字节数
+     * @return dest
+     */
+    inline void* memmove(void* dest, const void* src, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memmove_impl(static_cast<char*>(dest), static_cast<const char*>(src), count);
+        return dest;
+    }
+}  // namespace cppfastbox::libc
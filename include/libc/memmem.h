@@ -0,0 +1,317 @@
+/**
+ * @file memmem.h
+ * @brief 实现memmem和strstr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "memchr.h"
+#include "memcmp.h"
+#include "strlen.h"
+
+/**
+ * @brief memmem标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    // 朴素查找中验证候选位置的开销超过已扫描字符数的2倍加该值时转为two-way算法
+    constexpr inline auto memmem_two_way_threshold{256zu};
+
+    template <typename char_type>
+    [[nodiscard]] constexpr inline bool equal_scalar(const char_type* a, const char_type* b, ::std::size_t count) noexcept
+    {
+        for(auto i{0zu}; i < count; i++)
+        {
+            if(a[i] != b[i]) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 计算needle的最大后缀
+     *
+     * @param reverse 为true时使用相反的字符顺序
+     * @return 最大后缀的起始下标减1(可能回绕为SIZE_MAX)，以及其周期
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline auto maximal_suffix(const char_type* needle, ::std::size_t needle_count, bool reverse) noexcept
+    {
+        struct result
+        {
+            ::std::size_t suffix;
+            ::std::size_t period;
+        };
+
+        auto suffix{static_cast<::std::size_t>(-1)};
+        auto j{0zu};
+        auto k{1zu};
+        auto period{1zu};
+        while(j + k < needle_count)
+        {
+            auto a{needle[j + k]};
+            auto b{needle[suffix + k]};
+            if(reverse ? b < a : a < b)
+            {
+                j += k;
+                k = 1;
+                period = j - suffix;
+            }
+            else if(a == b)
+            {
+                if(k != period) { k++; }
+                else
+                {
+                    j += period;
+                    k = 1;
+                }
+            }
+            else
+            {
+                suffix = j++;
+                k = period = 1;
+            }
+        }
+        return result{suffix, period};
+    }
+
+    /**
+     * @brief 使用two-way算法查找needle
+     *
+     * @note 时间复杂度为O(count + needle_count)，额外空间为O(1)；needle_count必须不为0。
+     * 只在朴素查找退化时调用且不使用向量指令，因此不内联以免增大调用者
+     */
+    template <typename char_type>
+    [[nodiscard, gnu::noinline]] constexpr inline const char_type*
+        memmem_two_way(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        if(count < needle_count) { return nullptr; }
+        // 临界分解：needle = needle[0, suffix) + needle[suffix, needle_count)
+        auto forward{::cppfastbox::libc::detail::maximal_suffix(needle, needle_count, false)};
+        auto backward{::cppfastbox::libc::detail::maximal_suffix(needle, needle_count, true)};
+        auto [suffix, period]{forward.suffix + 1 > backward.suffix + 1 ? forward : backward};
+        suffix++;
+        if(::cppfastbox::libc::detail::equal_scalar(needle, needle + period, suffix))
+        {
+            // needle具有周期period，已匹配的前缀可以跳过
+            auto memory{0zu};
+            for(auto j{0zu}; j <= count - needle_count;)
+            {
+                auto i{suffix > memory ? suffix : memory};
+                while(i < needle_count && needle[i] == str[i + j]) { i++; }
+                if(i < needle_count)
+                {
+                    j += i - suffix + 1;
+                    memory = 0;
+                    continue;
+                }
+                i = suffix - 1;
+                while(memory < i + 1 && needle[i] == str[i + j]) { i--; }
+                if(i + 1 < memory + 1) { return str + j; }
+                j += period;
+                memory = needle_count - period;
+            }
+        }
+        else
+        {
+            period = (suffix > needle_count - suffix ? suffix : needle_count - suffix) + 1;
+            for(auto j{0zu}; j <= count - needle_count;)
+            {
+                auto i{suffix};
+                while(i < needle_count && needle[i] == str[i + j]) { i++; }
+                if(i < needle_count)
+                {
+                    j += i - suffix + 1;
+                    continue;
+                }
+                i = suffix - 1;
+                while(i != static_cast<::std::size_t>(-1) && needle[i] == str[i + j]) { i--; }
+                if(i == static_cast<::std::size_t>(-1)) { return str + j; }
+                j += period;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 先比较首尾字符再验证候选位置
+     *
+     * @note needle_count必须不小于2；验证开销过大时转为two-way算法
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type*
+        memmem_scalar(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        const auto first{needle[0]};
+        const auto last{needle[needle_count - 1]};
+        auto work{0zu};
+        for(auto i{0zu}; i + needle_count <= count; i++)
+        {
+            if(str[i] != first || str[i + needle_count - 1] != last) { continue; }
+            if(::cppfastbox::libc::detail::equal_scalar(str + i + 1, needle + 1, needle_count - 2)) { return str + i; }
+            work += needle_count;
+            if(work > 2 * i + ::cppfastbox::libc::detail::memmem_two_way_threshold) [[unlikely]]
+            {
+                return ::cppfastbox::libc::detail::memmem_two_way(str + i + 1, count - i - 1, needle, needle_count);
+            }
+        }
+        return nullptr;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief memmem向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 在一个向量的窗口中同时比较首尾字符，只验证两者都相同的位置
+     *
+     * @note needle_count必须不小于2且不大于count；不足一个向量的位置使用标量实现
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type*
+        memmem_simd(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        constexpr auto bits{::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>};
+        using mask_t = ::cppfastbox::libc::detail::scan_mask_t<vector_size>;
+        const auto vfirst{::cppfastbox::libc::detail::scan_broadcast<vector_size>(needle[0])};
+        const auto vlast{::cppfastbox::libc::detail::scan_broadcast<vector_size>(needle[needle_count - 1])};
+        // 首尾之间需要验证的字节数
+        const auto middle_size{(needle_count - 2) * sizeof(char_type)};
+        const auto positions{count - needle_count + 1};
+        auto work{0zu};
+        auto i{0zu};
+        for(; positions - i >= lanes; i += lanes)
+        {
+            if(work > 2 * i + ::cppfastbox::libc::detail::memmem_two_way_threshold) [[unlikely]]
+            {
+                return ::cppfastbox::libc::detail::memmem_two_way(str + i, count - i, needle, needle_count);
+            }
+            auto first{::cppfastbox::libc::detail::scan_load<vector_size>(str + i)};
+            auto last{::cppfastbox::libc::detail::scan_load<vector_size>(str + i + needle_count - 1)};
+            auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(first, vfirst) &
+                      ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(last, vlast)};
+            while(mask != 0)
+            {
+                auto index{::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask)};
+                auto* candidate{str + i + index};
+                if(!::cppfastbox::libc::detail::bcmp_impl<vector_size>(reinterpret_cast<const char*>(candidate + 1),
+                                                                       reinterpret_cast<const char*>(needle + 1),
+                                                                       middle_size))
+                {
+                    return candidate;
+                }
+                work += needle_count;
+                // 清除该元素对应的所有位
+                mask &= ~(((mask_t{1} << bits) - 1) << (index * bits));
+            }
+        }
+        return ::cppfastbox::libc::detail::memmem_scalar(str + i, count - i, needle, needle_count);
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] CPPFASTBOX_ALWAYS_INLINE inline const char_type*
+        memmem_impl(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        if(needle_count == 0) { return str; }
+        if(needle_count > count) { return nullptr; }
+        if constexpr(vector_size == 0)
+        {
+            if(needle_count == 1) { return ::cppfastbox::libc::detail::memchr_scalar(str, needle[0], count); }
+            return ::cppfastbox::libc::detail::memmem_scalar(str, count, needle, needle_count);
+        }
+        else
+        {
+            if(needle_count == 1) { return ::cppfastbox::libc::detail::memchr_simd<vector_size>(str, needle[0], count); }
+            return ::cppfastbox::libc::detail::memmem_simd<vector_size>(str, count, needle, needle_count);
+        }
+    }
+
+    /**
+     * @brief 在以\0结尾的字符串中查找needle
+     *
+     * @note 分块获取str的长度并查找，找到needle时无需扫描str的剩余部分
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* strstr_impl(const char_type* str, const char_type* needle) noexcept
+    {
+        ::std::size_t needle_count;
+        if constexpr(vector_size == 0) { needle_count = ::cppfastbox::libc::detail::strlen_scalar(needle); }
+        else { needle_count = ::cppfastbox::libc::detail::strlen_simd<vector_size>(needle); }
+        if(needle_count == 0) { return str; }
+        const auto chunk{needle_count > 4096 ? needle_count : 4096zu};
+        // 已知的str的长度，以及尚未排除的第一个位置
+        auto count{0zu};
+        auto start{0zu};
+        while(true)
+        {
+            ::std::size_t length;
+            if constexpr(vector_size == 0) { length = ::cppfastbox::libc::detail::strnlen_scalar(str + count, chunk); }
+            else { length = ::cppfastbox::libc::detail::strnlen_simd<vector_size>(str + count, chunk); }
+            count += length;
+            if(count - start >= needle_count)
+            {
+                auto result{::cppfastbox::libc::detail::memmem_impl<vector_size>(str + start, count - start, needle, needle_count)};
+                if(result != nullptr) { return result; }
+                start = count - needle_count + 1;
+            }
+            if(length < chunk) { return nullptr; }
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 在str的前count个字符中查找第一个needle
+     *
+     * @param str 要查找的字符串
+     * @param count 要查找的字符数
+     * @param needle 要查找的子串
+     * @param needle_count 子串的字符数
+     * @return 指向第一个needle的指针，若找不到则为nullptr；needle_count为0时返回str
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type*
+        memmem(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        if consteval
+        {
+            if(needle_count == 0) { return str; }
+            if(needle_count > count) { return nullptr; }
+            if(needle_count == 1) { return ::cppfastbox::libc::detail::memchr_scalar(str, needle[0], count); }
+            return ::cppfastbox::libc::detail::memmem_scalar(str, count, needle, needle_count);
+        }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto* needle_ptr{reinterpret_cast<const fixed_char*>(needle)};
+            return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memmem_impl(ptr, count, needle_ptr, needle_count));
+        }
+    }
+
+    /**
+     * @brief 在以\0结尾的字符串str中查找第一个needle
+     *
+     * @param str 要查找的字符串
+     * @param needle 要查找的以\0结尾的子串
+     * @return 指向第一个needle的指针，若找不到则为nullptr；needle为空串时返回str
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strstr(const char_type* str, const char_type* needle) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::memmem(str, ::cppfastbox::libc::strlen(str), needle, ::cppfastbox::libc::strlen(needle)); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto* needle_ptr{reinterpret_cast<const fixed_char*>(needle)};
+            return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strstr_impl(ptr, needle_ptr));
+        }
+    }
+}  // namespace cppfastbox::libc
@@ -0,0 +1,145 @@
+/**
+ * @file memset.h
+ * @brief 实现memset、bzero和explicit_bzero
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "lane.h"
+
+/**
+ * @brief memset实现
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 使用首尾两个可能重叠的通道填充[lane, 2 * lane]字节
+     *
+     */
+    template <::std::size_t lane>
+    CPPFASTBOX_ALWAYS_INLINE inline void set_head_tail(char* dest, ::std::uint8_t byte, ::std::size_t size) noexcept
+    {
+        auto value{::cppfastbox::libc::detail::broadcast_lane<lane>(byte)};
+        ::cppfastbox::libc::detail::store_lane<lane>(dest, value);
+        ::cppfastbox::libc::detail::store_lane<lane>(dest + size - lane, value);
+    }
+
+    /**
+     * @brief 填充不超过2 * lane字节
+     *
+     */
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size>
+    CPPFASTBOX_ALWAYS_INLINE inline void set_small(char* dest, ::std::uint8_t byte, ::std::size_t size) noexcept
+    {
+        if constexpr(lane == 1)
+        {
+            if(size != 0) { ::cppfastbox::libc::detail::set_head_tail<1>(dest, byte, size); }
+        }
+        else
+        {
+            if(size >= lane) { ::cppfastbox::libc::detail::set_head_tail<lane>(dest, byte, size); }
+            else { ::cppfastbox::libc::detail::set_small<lane / 2>(dest, byte, size); }
+        }
+    }
+
+    /**
+     * @brief 填充超过2 * lane字节
+     *
+     * @tparam nontemporal 是否使用非临时存储
+     */
+    template <bool nontemporal, ::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size, ::std::size_t unroll = 4>
+    inline void set_large(char* dest, ::std::uint8_t byte, ::std::size_t size) noexcept
+    {
+        auto value{::cppfastbox::libc::detail::broadcast_lane<lane>(byte)};
+        auto* const last{dest + size - lane};
+        ::cppfastbox::libc::detail::store_lane<lane>(dest, value);
+        // 将dest对齐到通道大小，避免写入跨越缓存行
+        auto skip{lane - reinterpret_cast<::std::uintptr_t>(dest) % lane};
+        dest += skip, size -= skip;
+        while(size > unroll * lane)
+        {
+#ifdef __clang__
+    #pragma clang loop unroll(full)
+#else
+    #pragma GCC unroll 16
+#endif
+            for(auto i{0zu}; i < unroll; i++)
+            {
+                if constexpr(nontemporal) { ::cppfastbox::libc::detail::store_lane_nontemporal<lane>(dest + i * lane, value); }
+                else { ::cppfastbox::libc::detail::store_lane<lane>(dest + i * lane, value); }
+            }
+            dest += unroll * lane, size -= unroll * lane;
+        }
+        while(size > lane)
+        {
+            if constexpr(nontemporal) { ::cppfastbox::libc::detail::store_lane_nontemporal<lane>(dest, value); }
+            else { ::cppfastbox::libc::detail::store_lane<lane>(dest, value); }
+            dest += lane, size -= lane;
+        }
+        if constexpr(nontemporal) { ::cppfastbox::libc::detail::nontemporal_fence(); }
+        // 剩余不超过一个通道，由尾通道覆盖
+        ::cppfastbox::libc::detail::store_lane<lane>(last, value);
+    }
+
+    template <::std::size_t lane = ::cppfastbox::libc::detail::copy_lane_max_size>
+    inline void memset_impl(char* dest, ::std::uint8_t byte, ::std::size_t size) noexcept
+    {
+        if(size <= 2 * lane) [[likely]] { ::cppfastbox::libc::detail::set_small<lane>(dest, byte, size); }
+        else
+        {
+            if constexpr(::cppfastbox::libc::detail::support_nontemporal_store && lane >= 16)
+            {
+                if(size >= ::cppfastbox::libc::detail::nontemporal_threshold()) [[unlikely]]
+                {
+                    ::cppfastbox::libc::detail::set_large<true, lane>(dest, byte, size);
+                    return;
+                }
+            }
+            ::cppfastbox::libc::detail::set_large<false, lane>(dest, byte, size);
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 用字节ch填充内存
+     *
+     * @param dest 目标地址
+     * @param ch 要填充的字节，转换为unsigned char
+     * @param count 要填充的字节数
+     * @return dest
+     */
+    inline void* memset(void* dest, int ch, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memset_impl(static_cast<char*>(dest), static_cast<::std::uint8_t>(ch), count);
+        return dest;
+    }
+
+    /**
+     * @brief 将内存清零
+     *
+     * @param dest 目标地址
+     * @param count 要清零的字节数
+     */
+    inline void bzero(void* dest, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memset_impl(static_cast<char*>(dest), 0, count);
+    }
+
+    /**
+     * @brief 将内存清零，且不会被编译器作为死存储消除
+     *
+     * @param dest 目标地址
+     * @param count 要清零的字节数
+     * @note 用于擦除密钥等敏感数据
+     */
+    inline void explicit_bzero(void* dest, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memset_impl(static_cast<char*>(dest), 0, count);
+        // 使编译器认为清零后的内存会被读取
+        __asm__ __volatile__("" : : "r"(dest) : "memory");
+    }
+}  // namespace cppfastbox::libc
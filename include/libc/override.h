@@ -7,3 +7,12 @@
  */
 #pragma once
 #include "override/strlen.h"
+#include "override/memchr.h"
+#include "override/strchr.h"
+#include "override/memcpy.h"
+#include "override/memset.h"
+#include "override/memcmp.h"
+#include "override/strcmp.h"
+#include "override/memmem.h"
+#include "override/strspn.h"
+#include "override/strcpy.h"
@@ -0,0 +1,133 @@
+/**
+ * @file dispatch.h
+ * @brief 运行时分派被覆盖的libc函数
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/dispatch.h"
+
+/**
+ * @brief 是否在运行时分派
+ *
+ * @note 编译期已支持avx512bw时无需分派
+ */
+#if defined(CPPFASTBOX_RUNTIME_DISPATCH) && defined(__SSE2__) && !(defined(__AVX512F__) && defined(__AVX512BW__))
+    #define CPPFASTBOX_LIBC_RUNTIME_DISPATCH
+    // glibc的动态链接器支持GNU ifunc，此时由链接器在加载时选择实现，调用没有额外开销
+    #if defined(__ELF__) && defined(__GLIBC__)
+        #define CPPFASTBOX_LIBC_IFUNC
+    #endif
+#endif
+
+#include "../lane.h"
+#include "../scan.h"
+
+namespace cppfastbox::libc::detail
+{
+    // 编译期确定的被覆盖函数的向量大小，为0时使用标量实现
+    constexpr inline auto override_vector_size{::cppfastbox::libc::detail::scan_vector_size};
+    // 向量大小为vector_size时拷贝和填充使用的通道大小
+    template <::std::size_t vector_size>
+    constexpr inline auto override_lane_size{vector_size == 0 ? ::cppfastbox::libc::detail::copy_lane_max_size : vector_size};
+}  // namespace cppfastbox::libc::detail
+
+#ifdef CPPFASTBOX_LIBC_RUNTIME_DISPATCH
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 按CPU支持的向量大小选择被覆盖函数的实现
+     *
+     * @tparam baseline 编译期确定的实现
+     * @tparam avx2 使用32字节向量的实现
+     * @tparam avx512 使用64字节向量的实现
+     */
+    template <auto baseline, auto avx2, auto avx512>
+    using override_dispatch =
+        ::cppfastbox::dispatch<::cppfastbox::dispatch_case<avx512, ::cppfastbox::cpu_flag::avx512f, ::cppfastbox::cpu_flag::avx512bw>,
+                               ::cppfastbox::dispatch_case<avx2, ::cppfastbox::cpu_flag::avx2>, ::cppfastbox::dispatch_case<baseline>>;
+
+    /**
+     * @brief 按CPU支持的指令集选择以pshufb查表的被覆盖函数的实现
+     *
+     * @tparam baseline 编译期确定的实现
+     * @tparam ssse3 使用16字节向量的实现，只支持sse2时不能使用pshufb
+     * @tparam avx2 使用32字节向量的实现
+     * @tparam avx512 使用64字节向量的实现
+     * @tparam avx512vbmi 使用64字节向量和vpermb的实现
+     */
+    template <auto baseline, auto ssse3, auto avx2, auto avx512, auto avx512vbmi>
+    using override_shuffle_dispatch =
+        ::cppfastbox::dispatch<::cppfastbox::dispatch_case<avx512vbmi, ::cppfastbox::cpu_flag::avx512f, ::cppfastbox::cpu_flag::avx512bw,
+                                                           ::cppfastbox::cpu_flag::avx512vbmi>,
+                               ::cppfastbox::dispatch_case<avx512, ::cppfastbox::cpu_flag::avx512f, ::cppfastbox::cpu_flag::avx512bw>,
+                               ::cppfastbox::dispatch_case<avx2, ::cppfastbox::cpu_flag::avx2>,
+                               ::cppfastbox::dispatch_case<ssse3, ::cppfastbox::cpu_flag::ssse3>, ::cppfastbox::dispatch_case<baseline>>;
+}  // namespace cppfastbox::libc::detail
+#endif
+
+/**
+ * @def CPPFASTBOX_LIBC_OVERRIDE(ret, name, params, args)
+ * @brief 定义被覆盖的C函数name，其实现为::cppfastbox::libc::detail::name##_override<vector_size>
+ *
+ * @param ret 返回类型
+ * @param params 带括号的形参列表
+ * @param args 带括号的实参列表
+ * @note 启用运行时分派时按CPU支持的向量大小选择实现，否则使用编译期确定的向量大小
+ */
+/**
+ * @def CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(ret, name, params, args)
+ * @brief 定义以pshufb查表的被覆盖的C函数name，其实现为::cppfastbox::libc::detail::name##_override<vector_size, use_vbmi>
+ *
+ * @note 参数同CPPFASTBOX_LIBC_OVERRIDE；vector_size为0时使用标量实现，use_vbmi为true时使用vpermb
+ */
+#ifdef CPPFASTBOX_LIBC_RUNTIME_DISPATCH
+    // 被覆盖函数name的分派器
+    #define CPPFASTBOX_LIBC_OVERRIDE_DISPATCH(name)                                                                                    \
+        ::cppfastbox::libc::detail::override_dispatch<                                                                                 \
+            &::cppfastbox::libc::detail::name##_override<::cppfastbox::libc::detail::override_vector_size>,                            \
+            &::cppfastbox::libc::detail::name##_override<32>,                                                                          \
+            &::cppfastbox::libc::detail::name##_override<64>>
+    // 以pshufb查表的被覆盖函数name的分派器
+    #define CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE_DISPATCH(name)                                                                            \
+        ::cppfastbox::libc::detail::override_shuffle_dispatch<                                                                         \
+            &::cppfastbox::libc::detail::name##_override<::cppfastbox::libc::detail::scan_shuffle_vector_size>,                        \
+            &::cppfastbox::libc::detail::name##_override<16>,                                                                          \
+            &::cppfastbox::libc::detail::name##_override<32>,                                                                          \
+            &::cppfastbox::libc::detail::name##_override<64>,                                                                          \
+            &::cppfastbox::libc::detail::name##_override<64, true>>
+    #ifdef CPPFASTBOX_LIBC_IFUNC
+        /**
+         * @brief 定义被覆盖函数name的解析器
+         *
+         * @param dispatcher 分派器宏名称中CPPFASTBOX_LIBC_OVERRIDE_之后的部分
+         * @note 解析器及其返回的实现均为隐藏符号，在重定位完成前也可以安全地取地址；探测指令集时不调用外部函数
+         */
+        #define CPPFASTBOX_LIBC_OVERRIDE_RESOLVER(name, dispatcher)                                                                    \
+            [[gnu::visibility("hidden")]] decltype(&::cppfastbox::libc::detail::name##_override<16>) cppfastbox_resolve_##name() noexcept \
+            {                                                                                                                          \
+                return CPPFASTBOX_LIBC_OVERRIDE_##dispatcher(name)::resolve(::cppfastbox::cpu_flags::runtime::detail::probe_flag_mask()); \
+            }
+        #define CPPFASTBOX_LIBC_OVERRIDE(ret, name, params, args)                                                                      \
+            CPPFASTBOX_LIBC_OVERRIDE_RESOLVER(name, DISPATCH)                                                                          \
+            ret CPPFASTBOX_CDECL name params __attribute__((ifunc("cppfastbox_resolve_" #name)));
+        #define CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(ret, name, params, args)                                                              \
+            CPPFASTBOX_LIBC_OVERRIDE_RESOLVER(name, SHUFFLE_DISPATCH)                                                                  \
+            ret CPPFASTBOX_CDECL name params __attribute__((ifunc("cppfastbox_resolve_" #name)));
+    #else
+        #define CPPFASTBOX_LIBC_OVERRIDE(ret, name, params, args)                                                                      \
+            ret CPPFASTBOX_CDECL name params { return CPPFASTBOX_LIBC_OVERRIDE_DISPATCH(name)::call args; }
+        #define CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(ret, name, params, args)                                                              \
+            ret CPPFASTBOX_CDECL name params { return CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE_DISPATCH(name)::call args; }
+    #endif
+#else
+    #define CPPFASTBOX_LIBC_OVERRIDE(ret, name, params, args)                                                                          \
+        ret CPPFASTBOX_CDECL name params { return ::cppfastbox::libc::detail::name##_override<::cppfastbox::libc::detail::override_vector_size> args; }
+    #define CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(ret, name, params, args)                                                                  \
+        ret CPPFASTBOX_CDECL name params                                                                                               \
+        {                                                                                                                              \
+            return ::cppfastbox::libc::detail::name##_override<::cppfastbox::libc::detail::scan_shuffle_vector_size,                   \
+                                                               ::cppfastbox::libc::detail::scan_shuffle_vbmi> args;                    \
+        }
+#endif
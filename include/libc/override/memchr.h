@@ -0,0 +1,21 @@
+/**
+ * @file memchr.h
+ * @brief 声明C风格的memchr、memrchr、rawmemchr和wmemchr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../memchr.h"
+
+extern "C"
+{
+    void* CPPFASTBOX_CDECL memchr(const void* ptr, int ch, ::std::size_t count);
+
+    void* CPPFASTBOX_CDECL memrchr(const void* ptr, int ch, ::std::size_t count);
+
+    void* CPPFASTBOX_CDECL rawmemchr(const void* ptr, int ch);
+
+    wchar_t* CPPFASTBOX_CDECL wmemchr(const wchar_t* ptr, wchar_t ch, ::std::size_t count);
+}
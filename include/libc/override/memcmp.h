@@ -0,0 +1,17 @@
+/**
+ * @file memcmp.h
+ * @brief 声明C风格的memcmp和bcmp
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../memcmp.h"
+
+extern "C"
+{
+    int CPPFASTBOX_CDECL memcmp(const void* a, const void* b, ::std::size_t count);
+
+    int CPPFASTBOX_CDECL bcmp(const void* a, const void* b, ::std::size_t count);
+}
@@ -0,0 +1,21 @@
+/**
+ * @file memcpy.h
+ * @brief 声明C风格的memcpy、memmove、wmemcpy和wmemmove
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../memcpy.h"
+
+extern "C"
+{
+    void* CPPFASTBOX_CDECL memcpy(void* dest, const void* src, ::std::size_t count);
+
+    void* CPPFASTBOX_CDECL memmove(void* dest, const void* src, ::std::size_t count);
+
+    wchar_t* CPPFASTBOX_CDECL wmemcpy(wchar_t* dest, const wchar_t* src, ::std::size_t count);
+
+    wchar_t* CPPFASTBOX_CDECL wmemmove(wchar_t* dest, const wchar_t* src, ::std::size_t count);
+}
@@ -0,0 +1,19 @@
+/**
+ * @file memmem.h
+ * @brief 声明C风格的memmem、strstr和wcsstr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../memmem.h"
+
+extern "C"
+{
+    void* CPPFASTBOX_CDECL memmem(const void* str, ::std::size_t count, const void* needle, ::std::size_t needle_count);
+
+    char* CPPFASTBOX_CDECL strstr(const char* str, const char* needle);
+
+    wchar_t* CPPFASTBOX_CDECL wcsstr(const wchar_t* str, const wchar_t* needle);
+}
@@ -0,0 +1,19 @@
+/**
+ * @file memset.h
+ * @brief 声明C风格的memset、bzero和explicit_bzero
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../memset.h"
+
+extern "C"
+{
+    void* CPPFASTBOX_CDECL memset(void* dest, int ch, ::std::size_t count);
+
+    void CPPFASTBOX_CDECL bzero(void* dest, ::std::size_t count);
+
+    void CPPFASTBOX_CDECL explicit_bzero(void* dest, ::std::size_t count);
+}
@@ -0,0 +1,21 @@
+/**
+ * @file strchr.h
+ * @brief 声明C风格的strchr、strrchr、wcschr和wcsrchr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../strchr.h"
+
+extern "C"
+{
+    char* CPPFASTBOX_CDECL strchr(const char* str, int ch);
+
+    char* CPPFASTBOX_CDECL strrchr(const char* str, int ch);
+
+    wchar_t* CPPFASTBOX_CDECL wcschr(const wchar_t* str, wchar_t ch);
+
+    wchar_t* CPPFASTBOX_CDECL wcsrchr(const wchar_t* str, wchar_t ch);
+}
@@ -0,0 +1,21 @@
+/**
+ * @file strcmp.h
+ * @brief 声明C风格的strcmp、strncmp、wcscmp和wcsncmp
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../strcmp.h"
+
+extern "C"
+{
+    int CPPFASTBOX_CDECL strcmp(const char* a, const char* b);
+
+    int CPPFASTBOX_CDECL strncmp(const char* a, const char* b, ::std::size_t count);
+
+    int CPPFASTBOX_CDECL wcscmp(const wchar_t* a, const wchar_t* b);
+
+    int CPPFASTBOX_CDECL wcsncmp(const wchar_t* a, const wchar_t* b, ::std::size_t count);
+}
@@ -0,0 +1,29 @@
+/**
+ * @file strcpy.h
+ * @brief 声明C风格的strcpy、stpcpy、strncpy、strlcpy及其宽字符版本
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../strcpy.h"
+
+extern "C"
+{
+    char* CPPFASTBOX_CDECL strcpy(char* dest, const char* src);
+
+    char* CPPFASTBOX_CDECL stpcpy(char* dest, const char* src);
+
+    char* CPPFASTBOX_CDECL strncpy(char* dest, const char* src, ::std::size_t count);
+
+    ::std::size_t CPPFASTBOX_CDECL strlcpy(char* dest, const char* src, ::std::size_t size);
+
+    wchar_t* CPPFASTBOX_CDECL wcscpy(wchar_t* dest, const wchar_t* src);
+
+    wchar_t* CPPFASTBOX_CDECL wcpcpy(wchar_t* dest, const wchar_t* src);
+
+    wchar_t* CPPFASTBOX_CDECL wcsncpy(wchar_t* dest, const wchar_t* src, ::std::size_t count);
+
+    ::std::size_t CPPFASTBOX_CDECL wcslcpy(wchar_t* dest, const wchar_t* src, ::std::size_t size);
+}
@@ -1,6 +1,6 @@
 /**
  * @file strlen.h
- * @brief 声明C风格的strlen和wcslen
+ * @brief 声明C风格的strlen、wcslen、strnlen和wcsnlen
  *
  * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
  *
@@ -14,4 +14,8 @@ extern "C"
     ::std::size_t CPPFASTBOX_CDECL strlen(const char* str);
 
     ::std::size_t CPPFASTBOX_CDECL wcslen(const wchar_t* str);
+
+    ::std::size_t CPPFASTBOX_CDECL strnlen(const char* str, ::std::size_t maxlen);
+
+    ::std::size_t CPPFASTBOX_CDECL wcsnlen(const wchar_t* str, ::std::size_t maxlen);
 }
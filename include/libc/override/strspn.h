@@ -0,0 +1,19 @@
+/**
+ * @file strspn.h
+ * @brief 声明C风格的strspn、strcspn和strpbrk
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "../../base/platform.h"
+#include "../strspn.h"
+
+extern "C"
+{
+    ::std::size_t CPPFASTBOX_CDECL strspn(const char* str, const char* accept);
+
+    ::std::size_t CPPFASTBOX_CDECL strcspn(const char* str, const char* reject);
+
+    char* CPPFASTBOX_CDECL strpbrk(const char* str, const char* accept);
+}
@@ -0,0 +1,296 @@
+/**
+ * @file scan.h
+ * @brief 向量化扫描的公共支持
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <bit>
+#include <cstdint>
+#include "../base/utility.h"
+
+namespace cppfastbox::libc::detail
+{
+    // 最小页大小，不跨越该边界的读取不会引发访问异常
+    constexpr inline auto min_page_size{4096zu};
+
+    // 向量化扫描使用的向量大小，若硬件不支持向量化扫描则为0
+    constexpr inline auto scan_vector_size{
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+        64zu
+#elifdef __AVX2__
+        32zu
+#elifdef __SSE2__
+        16zu
+#else
+        0zu
+#endif
+    };
+    // 是否支持向量化扫描
+    constexpr inline auto support_scan_simd{::cppfastbox::libc::detail::scan_vector_size != 0};
+
+    /**
+     * @brief 以字节混洗(pshufb)查表时使用的向量大小，若硬件不支持则为0
+     *
+     * @note pshufb需要ssse3，因此只支持sse2时不查表
+     */
+    constexpr inline auto scan_shuffle_vector_size{
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+        64zu
+#elifdef __AVX2__
+        32zu
+#elifdef __SSSE3__
+        16zu
+#else
+        0zu
+#endif
+    };
+    // 64字节的向量是否可以使用avx512vbmi的vpermb查128项的表
+    constexpr inline auto scan_shuffle_vbmi{
+#ifdef __AVX512VBMI__
+        ::cppfastbox::libc::detail::scan_shuffle_vector_size == 64
+#else
+        false
+#endif
+    };
+
+    // 与char_type同宽的定长字符类型
+    template <typename char_type>
+    using scan_char_t = ::cppfastbox::fixed_size_character_t<sizeof(char_type)>;
+    // 向量化扫描使用的向量元素类型
+    template <typename char_type>
+    using scan_element_t = decltype(::cppfastbox::detail::get_simd_integral_impl<true, sizeof(char_type)>());
+    // 向量化扫描使用的向量类型
+    template <::std::size_t vector_size, typename char_type>
+    using scan_vector_t [[__gnu__::__vector_size__(vector_size)]] = ::cppfastbox::libc::detail::scan_element_t<char_type>;
+    // 比较结果的掩码类型
+    template <::std::size_t vector_size>
+    using scan_mask_t = ::std::conditional_t<vector_size == 64, ::std::uint64_t, ::std::uint32_t>;
+    /**
+     * @brief 掩码中每个元素占用的位数
+     *
+     * @note avx512的比较结果每个元素占1位，sse2和avx2的pmovmskb每个字节占1位
+     */
+    template <::std::size_t vector_size, typename char_type>
+    constexpr inline auto scan_mask_bits{vector_size == 64 ? 1zu : sizeof(char_type)};
+    // 每个向量包含的元素数
+    template <::std::size_t vector_size, typename char_type>
+    constexpr inline auto scan_lanes{vector_size / sizeof(char_type)};
+
+    /**
+     * @brief 非对齐地读取一个向量
+     *
+     * @param ptr 要读取的地址
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_load(const char_type* ptr) noexcept
+    {
+        ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> v;
+        __builtin_memcpy(&v, ptr, vector_size);
+        return v;
+    }
+
+    /**
+     * @brief 对齐地读取一个向量
+     *
+     * @param ptr 要读取的地址，必须对齐到vector_size
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_load_aligned(const char_type* ptr) noexcept
+    {
+        ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> v;
+        __builtin_memcpy(&v, __builtin_assume_aligned(ptr, vector_size), vector_size);
+        return v;
+    }
+
+    /**
+     * @brief 将ch广播到向量的所有元素
+     *
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_broadcast(char_type ch) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        return vector{} + static_cast<::cppfastbox::libc::detail::scan_element_t<char_type>>(ch);
+    }
+
+    /**
+     * @brief 逐元素比较两个向量是否相等并返回掩码
+     *
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::scan_mask_t<vector_size>
+        scan_equal(::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> a,
+                   ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> b) noexcept
+    {
+        if constexpr(vector_size == 64)
+        {
+            // 内建函数要求的向量类型
+            using vi [[__gnu__::__vector_size__(64)]] =
+                ::std::conditional_t<sizeof(char_type) == 1, char, ::std::conditional_t<sizeof(char_type) == 2, short, int>>;
+            auto va{::std::bit_cast<vi>(a)};
+            auto vb{::std::bit_cast<vi>(b)};
+            if constexpr(sizeof(char_type) == 1) { return __builtin_ia32_cmpb512_mask(va, vb, 0, -1); }       //< avx512bw
+            else if constexpr(sizeof(char_type) == 2) { return __builtin_ia32_cmpw512_mask(va, vb, 0, -1); }  //< avx512bw
+            else { return __builtin_ia32_cmpd512_mask(va, vb, 0, -1); }                                       //< avx512f
+        }
+        else
+        {
+            using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
+            auto result{::std::bit_cast<vi8>(a == b)};                                                                  //< sse2 or avx2
+            if constexpr(vector_size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb256(result)); }  //< avx2
+            else { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb128(result)); }                            //< sse2
+        }
+    }
+
+    /**
+     * @brief 获取逐元素比较的结果中为真的元素的掩码
+     *
+     * @param result 逐元素比较的结果，每个元素为全1或全0
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::scan_mask_t<vector_size>
+        scan_true_mask(::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> result) noexcept
+    {
+        if constexpr(vector_size == 64)
+        {
+            constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+            constexpr auto full{lanes == 64 ? ~::std::uint64_t{} : (::std::uint64_t{1} << lanes) - 1};
+            using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+            return ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(result, vector{}) ^ full;
+        }
+        else
+        {
+            using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
+            auto v{::std::bit_cast<vi8>(result)};
+            if constexpr(vector_size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb256(v)); }  //< avx2
+            else { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb128(v)); }                            //< sse2
+        }
+    }
+
+    /**
+     * @brief 获取每个字节的最高位组成的掩码
+     *
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::scan_mask_t<vector_size>
+        scan_high_bit_mask(::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> v) noexcept
+    {
+        using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
+        auto vc{::std::bit_cast<vi8>(v)};
+        if constexpr(vector_size == 64) { return __builtin_ia32_cvtb2mask512(vc); }                                   //< avx512bw
+        else if constexpr(vector_size == 32) { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb256(vc)); }  //< avx2
+        else { return static_cast<::std::uint32_t>(__builtin_ia32_pmovmskb128(vc)); }                                  //< sse2
+    }
+
+    /**
+     * @brief 在每个16字节的通道内以index的低4位查表
+     *
+     * @param table 每个通道内的16项表
+     * @param index 下标，最高位为1的元素的结果为0
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_shuffle(::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> table,
+                                                      ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> index) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        // 内建函数要求的向量类型
+        using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
+        auto vt{::std::bit_cast<vi8>(table)};
+        auto vi{::std::bit_cast<vi8>(index)};
+        if constexpr(vector_size == 64) { return ::std::bit_cast<vector>(__builtin_ia32_pshufb512_mask(vt, vi, vi8{}, -1)); }  //< avx512bw
+        else if constexpr(vector_size == 32) { return ::std::bit_cast<vector>(__builtin_ia32_pshufb256(vt, vi)); }             //< avx2
+        else { return ::std::bit_cast<vector>(__builtin_ia32_pshufb128(vt, vi)); }                                             //< ssse3
+    }
+
+    /**
+     * @brief 以index的低7位在low和high拼接成的128项表中查表
+     *
+     * @note 需要avx512vbmi，vector_size只能为64
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_permute128(::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> low,
+                                                         ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> high,
+                                                         ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> index) noexcept
+    {
+        static_assert(vector_size == 64);
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
+        return ::std::bit_cast<vector>(
+            __builtin_ia32_vpermt2varqi512_mask(::std::bit_cast<vi8>(index), ::std::bit_cast<vi8>(low), ::std::bit_cast<vi8>(high), -1));
+    }
+
+    // 获取掩码中第一个元素的下标
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t scan_first_index(::cppfastbox::libc::detail::scan_mask_t<vector_size> mask) noexcept
+    {
+        return static_cast<::std::size_t>(::std::countr_zero(mask)) / ::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>;
+    }
+
+    // 获取掩码中最后一个元素的下标
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t scan_last_index(::cppfastbox::libc::detail::scan_mask_t<vector_size> mask) noexcept
+    {
+        return static_cast<::std::size_t>(::std::bit_width(mask) - 1) / ::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>;
+    }
+
+    /**
+     * @brief 获取str所在的对齐向量块
+     *
+     * @param str 字符串
+     * @return 对齐向量块的起始地址，以及str在块中的偏移对应的掩码位数
+     * @note 对齐的读取不会跨页，因此可以安全地读取str之前和字符串结尾之后的数据
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_align_down(const char_type* str) noexcept
+    {
+        struct result
+        {
+            const char_type* block;
+            ::std::size_t shift;
+        };
+
+        auto address{reinterpret_cast<::std::uintptr_t>(str)};
+        auto offset{address % vector_size};
+        return result{reinterpret_cast<const char_type*>(address - offset),
+                      offset / sizeof(char_type) * ::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>};
+    }
+
+    /**
+     * @brief 比较不足一个向量的元素并返回掩码
+     *
+     * @param str 要比较的数据
+     * @param vch 广播后的ch
+     * @param ch 要比较的字符
+     * @param count 元素数，必须小于一个向量包含的元素数
+     * @note 读取不跨页时读取整个向量并屏蔽多余的位，否则逐元素比较
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::cppfastbox::libc::detail::scan_mask_t<vector_size>
+        scan_partial_equal(const char_type* str,
+                           ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> vch,
+                           char_type ch,
+                           ::std::size_t count) noexcept
+    {
+        using mask_t = ::cppfastbox::libc::detail::scan_mask_t<vector_size>;
+        constexpr auto bits{::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>};
+        constexpr auto page_size{::cppfastbox::libc::detail::min_page_size};
+        if((reinterpret_cast<::std::uintptr_t>(str) & (page_size - 1)) <= page_size - vector_size)
+        {
+            auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(
+                ::cppfastbox::libc::detail::scan_load<vector_size>(str),
+                vch)};
+            return mask & ((mask_t{1} << (count * bits)) - 1);
+        }
+        else
+        {
+            mask_t mask{};
+            for(auto i{0zu}; i < count; i++)
+            {
+                if(str[i] == ch) { mask |= mask_t{1} << (i * bits); }
+            }
+            return mask;
+        }
+    }
+}  // namespace cppfastbox::libc::detail
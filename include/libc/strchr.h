@@ -0,0 +1,152 @@
+/**
+ * @file strchr.h
+ * @brief 实现strchr和strrchr
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "memchr.h"
+
+/**
+ * @brief strchr标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strchr_scalar(const char_type* str, char_type ch) noexcept
+    {
+        while(true)
+        {
+            if(*str == ch) { return str; }
+            if(*str == char_type{}) { return nullptr; }
+            str++;
+        }
+    }
+
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strrchr_scalar(const char_type* str, char_type ch) noexcept
+    {
+        const char_type* result{};
+        while(true)
+        {
+            if(*str == ch) { result = str; }
+            if(*str == char_type{}) { return result; }
+            str++;
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief strchr向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* strchr_simd(const char_type* str, char_type ch) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        const auto vch{::cppfastbox::libc::detail::scan_broadcast<vector_size>(ch)};
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        auto base{str};
+        auto v{::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block)};
+        // 同时检测ch和结束符，屏蔽str之前的元素
+        auto mask{(::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vch) |
+                   ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vector{})) >>
+                  shift};
+        while(mask == 0)
+        {
+            block += lanes;
+            base = block;
+            v = ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block);
+            mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vch) |
+                   ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vector{});
+        }
+        auto result{base + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask)};
+        return *result == ch ? result : nullptr;
+    }
+
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline const char_type* strrchr_simd(const char_type* str, char_type ch) noexcept
+    {
+        // 查找结束符本身
+        if(ch == char_type{}) { return ::cppfastbox::libc::detail::rawmemchr_simd<vector_size>(str, ch); }
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        const auto vch{::cppfastbox::libc::detail::scan_broadcast<vector_size>(ch)};
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        auto base{str};
+        const char_type* result{};
+        auto v{::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block)};
+        // 屏蔽str之前的元素
+        auto match{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vch) >> shift};
+        auto zero{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vector{}) >> shift};
+        while(zero == 0)
+        {
+            if(match != 0) { result = base + ::cppfastbox::libc::detail::scan_last_index<vector_size, char_type>(match); }
+            block += lanes;
+            base = block;
+            v = ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block);
+            match = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vch);
+            zero = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(v, vector{});
+        }
+        // 只保留结束符之前的匹配
+        match &= zero ^ (zero - 1);
+        if(match != 0) { result = base + ::cppfastbox::libc::detail::scan_last_index<vector_size, char_type>(match); }
+        return result;
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 在以\0结尾的字符串str中查找第一个ch
+     *
+     * @param str 要查找的字符串
+     * @param ch 要查找的字符，可以为\0
+     * @return 指向第一个ch的指针，若找不到则为nullptr
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strchr(const char_type* str, char_type ch) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::strchr_scalar(str, ch); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strchr_simd(ptr, fixed_ch));
+            }
+            else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strchr_scalar(ptr, fixed_ch)); }
+        }
+    }
+
+    /**
+     * @brief 在以\0结尾的字符串str中查找最后一个ch
+     *
+     * @param str 要查找的字符串
+     * @param ch 要查找的字符，可以为\0
+     * @return 指向最后一个ch的指针，若找不到则为nullptr
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strrchr(const char_type* str, char_type ch) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::strrchr_scalar(str, ch); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strrchr_simd(ptr, fixed_ch));
+            }
+            else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strrchr_scalar(ptr, fixed_ch)); }
+        }
+    }
+}  // namespace cppfastbox::libc
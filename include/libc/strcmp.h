@@ -0,0 +1,197 @@
+/**
+ * @file strcmp.h
+ * @brief 实现strcmp和strncmp
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "scan.h"
+
+/**
+ * @brief strcmp标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 查找两个字符串中第一个不同的字符或a的结束符
+     *
+     * @return 该字符的下标
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t strcmp_index_scalar(const char_type* a, const char_type* b) noexcept
+    {
+        auto i{0zu};
+        while(a[i] == b[i] && a[i] != char_type{}) { i++; }
+        return i;
+    }
+
+    /**
+     * @brief 在前count个字符中查找两个字符串中第一个不同的字符或a的结束符
+     *
+     * @return 该字符的下标，若不存在则为count
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t strncmp_index_scalar(const char_type* a, const char_type* b, ::std::size_t count) noexcept
+    {
+        for(auto i{0zu}; i < count; i++)
+        {
+            if(a[i] != b[i] || a[i] == char_type{}) { return i; }
+        }
+        return count;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief strcmp向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 比较a和b处的一个向量，返回不同的元素和a中结束符的掩码
+     *
+     * @note 相等的元素保留a的值，不同的元素置0，只需与0比较一次即可同时检测两者
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline auto scan_compare_stop(const char_type* a, const char_type* b) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        auto va{::cppfastbox::libc::detail::scan_load<vector_size>(a)};
+        auto vb{::cppfastbox::libc::detail::scan_load<vector_size>(b)};
+        return ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::std::bit_cast<vector>(va == vb) & va, vector{});
+    }
+
+    /**
+     * @brief 判断从a或b开始读取一个向量是否会跨页
+     *
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline bool scan_may_cross_page(const char_type* a, const char_type* b) noexcept
+    {
+        constexpr auto page_size{::cppfastbox::libc::detail::min_page_size};
+        auto offset_a{reinterpret_cast<::std::uintptr_t>(a) & (page_size - 1)};
+        auto offset_b{reinterpret_cast<::std::uintptr_t>(b) & (page_size - 1)};
+        return (offset_a > page_size - vector_size) | (offset_b > page_size - vector_size);
+    }
+
+    /**
+     * @brief 以向量查找两个字符串中第一个不同的字符或a的结束符
+     *
+     * @note 两个字符串无法同时对齐，因此使用非对齐读取；可能跨页时逐字符比较一个向量的元素
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline ::std::size_t strcmp_index_simd(const char_type* a, const char_type* b) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        for(auto i{0zu};; i += lanes)
+        {
+            if(::cppfastbox::libc::detail::scan_may_cross_page<vector_size>(a + i, b + i)) [[unlikely]]
+            {
+                auto index{::cppfastbox::libc::detail::strncmp_index_scalar(a + i, b + i, lanes)};
+                if(index != lanes) { return i + index; }
+                continue;
+            }
+            auto mask{::cppfastbox::libc::detail::scan_compare_stop<vector_size>(a + i, b + i)};
+            if(mask != 0) { return i + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        }
+    }
+
+    /**
+     * @brief 以向量在前count个字符中查找两个字符串中第一个不同的字符或a的结束符
+     *
+     * @note 最后一个向量中超出count的元素被屏蔽
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline ::std::size_t strncmp_index_simd(const char_type* a, const char_type* b, ::std::size_t count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        constexpr auto bits{::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>};
+        using mask_t = ::cppfastbox::libc::detail::scan_mask_t<vector_size>;
+        for(auto i{0zu}; i < count; i += lanes)
+        {
+            auto rest{count - i};
+            if(::cppfastbox::libc::detail::scan_may_cross_page<vector_size>(a + i, b + i)) [[unlikely]]
+            {
+                auto n{rest < lanes ? rest : lanes};
+                auto index{::cppfastbox::libc::detail::strncmp_index_scalar(a + i, b + i, n)};
+                if(index != n) { return i + index; }
+                continue;
+            }
+            auto mask{::cppfastbox::libc::detail::scan_compare_stop<vector_size>(a + i, b + i)};
+            if(rest < lanes) { mask &= (mask_t{1} << (rest * bits)) - 1; }
+            if(mask != 0) { return i + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        }
+        return count;
+    }
+
+    /**
+     * @brief 根据第一个不同的字符计算比较结果
+     *
+     * @note 单字节字符按unsigned char比较，宽字符按char_type本身的符号比较
+     */
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline int strcmp_result(char_type a, char_type b) noexcept
+    {
+        if constexpr(sizeof(char_type) == 1)
+        {
+            return static_cast<int>(static_cast<unsigned char>(a)) - static_cast<int>(static_cast<unsigned char>(b));
+        }
+        else { return a < b ? -1 : (a == b ? 0 : 1); }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 按字典序比较两个以\0结尾的字符串
+     *
+     * @param a 第一个字符串
+     * @param b 第二个字符串
+     * @return 小于0表示a < b，等于0表示a == b，大于0表示a > b
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline int strcmp(const char_type* a, const char_type* b) noexcept
+    {
+        ::std::size_t index;
+        if consteval { index = ::cppfastbox::libc::detail::strcmp_index_scalar(a, b); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* pa{reinterpret_cast<const fixed_char*>(a)};
+            auto* pb{reinterpret_cast<const fixed_char*>(b)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd) { index = ::cppfastbox::libc::detail::strcmp_index_simd(pa, pb); }
+            else { index = ::cppfastbox::libc::detail::strcmp_index_scalar(pa, pb); }
+        }
+        return ::cppfastbox::libc::detail::strcmp_result(a[index], b[index]);
+    }
+
+    /**
+     * @brief 按字典序比较两个字符串的前count个字符
+     *
+     * @param a 第一个字符串
+     * @param b 第二个字符串
+     * @param count 最多比较的字符数，字符串较短时在结束符处停止
+     * @return 小于0表示a < b，等于0表示a == b，大于0表示a > b
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline int strncmp(const char_type* a, const char_type* b, ::std::size_t count) noexcept
+    {
+        ::std::size_t index;
+        if consteval { index = ::cppfastbox::libc::detail::strncmp_index_scalar(a, b, count); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* pa{reinterpret_cast<const fixed_char*>(a)};
+            auto* pb{reinterpret_cast<const fixed_char*>(b)};
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                index = ::cppfastbox::libc::detail::strncmp_index_simd(pa, pb, count);
+            }
+            else { index = ::cppfastbox::libc::detail::strncmp_index_scalar(pa, pb, count); }
+        }
+        if(index == count) { return 0; }
+        return ::cppfastbox::libc::detail::strcmp_result(a[index], b[index]);
+    }
+}  // namespace cppfastbox::libc
@@ -0,0 +1,226 @@
+/**
+ * @file strcpy.h
+ * @brief 实现strcpy、stpcpy、strncpy和strlcpy
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include "memcpy.h"
+#include "memset.h"
+#include "strlen.h"
+
+/**
+ * @brief strcpy标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 逐字符拷贝字符串，最多拷贝count个字符
+     *
+     * @return 结束符之前的字符数，前count个字符中没有结束符时为count
+     * @note 找到结束符时同时拷贝结束符
+     */
+    template <typename char_type>
+    constexpr inline ::std::size_t strcpy_scalar(char_type* dest, const char_type* src, ::std::size_t count) noexcept
+    {
+        for(auto i{0zu}; i < count; i++)
+        {
+            dest[i] = src[i];
+            if(src[i] == char_type{}) { return i; }
+        }
+        return count;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief x86 strcpy向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 拷贝结束符位于前两个对齐向量中的字符串
+     *
+     * @param position 结束符的下标，不在前count个字符中时不小于count
+     * @note 拷贝的字符数不超过2 * lanes
+     */
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t
+        strcpy_small(char_type* dest, const char_type* src, ::std::size_t position, ::std::size_t count) noexcept
+    {
+        auto copied{position < count ? position + 1 : count};
+        ::cppfastbox::libc::detail::copy_small<vector_size>(reinterpret_cast<char*>(dest),
+                                                            reinterpret_cast<const char*>(src),
+                                                            copied * sizeof(char_type));
+        return position < count ? position : count;
+    }
+
+    /**
+     * @brief 以对齐的向量查找结束符，同时拷贝已确认不含结束符的向量，最多拷贝count个字符
+     *
+     * @return 结束符之前的字符数，前count个字符中没有结束符时为count
+     * @note 找到结束符时同时拷贝结束符；读取方式同strnlen_simd，不会跨页；写入不会越过dest + count
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline ::std::size_t strcpy_simd(char_type* dest, const char_type* src, ::std::size_t count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        if(count == 0) { return 0; }
+        if constexpr(sizeof(char_type) != 1)
+        {
+            if(reinterpret_cast<::std::uintptr_t>(src) % sizeof(char_type) != 0) [[unlikely]]
+            {
+                return ::cppfastbox::libc::detail::strcpy_scalar(dest, src, count);
+            }
+        }
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(src)};
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                 vector{}) >>
+                  shift};
+        // 已确认不含结束符的字符数
+        ::std::size_t checked{static_cast<::std::size_t>(block + lanes - src)};
+        if(mask != 0 || checked >= count)
+        {
+            auto position{mask != 0 ? ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask) : count};
+            return ::cppfastbox::libc::detail::strcpy_small<vector_size>(dest, src, position, count);
+        }
+        block += lanes;
+        mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                              vector{});
+        if(mask != 0 || checked + lanes >= count)
+        {
+            auto position{mask != 0 ? checked + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask) : count};
+            return ::cppfastbox::libc::detail::strcpy_small<vector_size>(dest, src, position, count);
+        }
+        // 前两个对齐的向量不含结束符，因此可以读取src开头的向量
+        ::cppfastbox::libc::detail::store_lane<vector_size>(dest, ::cppfastbox::libc::detail::load_lane<vector_size>(src));
+        ::cppfastbox::libc::detail::store_lane<vector_size>(dest + checked, ::cppfastbox::libc::detail::load_lane<vector_size>(block));
+        checked += lanes;
+        while(true)
+        {
+            block += lanes;
+            mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                  vector{});
+            if(mask != 0 || checked + lanes >= count)
+            {
+                auto position{mask != 0 ? checked + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask) : count};
+                auto copied{position < count ? position + 1 : count};
+                // 以结尾处的向量拷贝剩余的字符，与已写入的部分重叠
+                ::cppfastbox::libc::detail::store_lane<vector_size>(dest + copied - lanes,
+                                                                    ::cppfastbox::libc::detail::load_lane<vector_size>(src + copied - lanes));
+                return position < count ? position : count;
+            }
+            ::cppfastbox::libc::detail::store_lane<vector_size>(dest + checked, ::cppfastbox::libc::detail::load_lane<vector_size>(block));
+            checked += lanes;
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 拷贝字符串
+     *
+     * @param dest 目标地址，至少需要容纳strlen(src) + 1个字符
+     * @param src 以0结尾的字符串
+     * @return dest中结束符的地址
+     * @note 查找结束符的同时拷贝，不需要先计算长度
+     */
+    template <typename char_type>
+    constexpr inline char_type* stpcpy(char_type* dest, const char_type* src) noexcept
+    {
+        constexpr auto unbounded{static_cast<::std::size_t>(-1)};
+        if consteval { return dest + ::cppfastbox::libc::detail::strcpy_scalar(dest, src, unbounded); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* dest_ptr{reinterpret_cast<fixed_char*>(dest)};
+            auto* src_ptr{reinterpret_cast<const fixed_char*>(src)};
+            if constexpr(::cppfastbox::libc::detail::support_strlen_simd)
+            {
+                return dest + ::cppfastbox::libc::detail::strcpy_simd(dest_ptr, src_ptr, unbounded);
+            }
+            else { return dest + ::cppfastbox::libc::detail::strcpy_scalar(dest_ptr, src_ptr, unbounded); }
+        }
+    }
+
+    /**
+     * @brief 拷贝字符串
+     *
+     * @param dest 目标地址，至少需要容纳strlen(src) + 1个字符
+     * @param src 以0结尾的字符串
+     * @return dest
+     */
+    template <typename char_type>
+    constexpr inline char_type* strcpy(char_type* dest, const char_type* src) noexcept
+    {
+        ::cppfastbox::libc::stpcpy(dest, src);
+        return dest;
+    }
+
+    /**
+     * @brief 拷贝字符串的前count个字符，不足count个字符时以0填充剩余部分
+     *
+     * @param dest 目标地址，至少需要容纳count个字符
+     * @param src 字符串，不必以0结尾
+     * @return dest
+     * @note 前count个字符中没有结束符时dest不以0结尾
+     */
+    template <typename char_type>
+    constexpr inline char_type* strncpy(char_type* dest, const char_type* src, ::std::size_t count) noexcept
+    {
+        if consteval
+        {
+            auto length{::cppfastbox::libc::detail::strcpy_scalar(dest, src, count)};
+            for(auto i{length}; i < count; i++) { dest[i] = char_type{}; }
+        }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* dest_ptr{reinterpret_cast<fixed_char*>(dest)};
+            auto* src_ptr{reinterpret_cast<const fixed_char*>(src)};
+            ::std::size_t length;
+            if constexpr(::cppfastbox::libc::detail::support_strlen_simd)
+            {
+                length = ::cppfastbox::libc::detail::strcpy_simd(dest_ptr, src_ptr, count);
+            }
+            else { length = ::cppfastbox::libc::detail::strcpy_scalar(dest_ptr, src_ptr, count); }
+            // 结束符已被拷贝，一并覆盖
+            ::cppfastbox::libc::detail::memset_impl(reinterpret_cast<char*>(dest + length), 0, (count - length) * sizeof(char_type));
+        }
+        return dest;
+    }
+
+    /**
+     * @brief 拷贝字符串，最多拷贝size - 1个字符，size不为0时dest总是以0结尾
+     *
+     * @param dest 目标地址，至少需要容纳size个字符
+     * @param src 以0结尾的字符串
+     * @return strlen(src)，不小于size时表示发生了截断
+     */
+    template <typename char_type>
+    constexpr inline ::std::size_t strlcpy(char_type* dest, const char_type* src, ::std::size_t size) noexcept
+    {
+        if(size == 0) { return ::cppfastbox::libc::strlen(src); }
+        ::std::size_t length;
+        if consteval { length = ::cppfastbox::libc::detail::strcpy_scalar(dest, src, size - 1); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* dest_ptr{reinterpret_cast<fixed_char*>(dest)};
+            auto* src_ptr{reinterpret_cast<const fixed_char*>(src)};
+            if constexpr(::cppfastbox::libc::detail::support_strlen_simd)
+            {
+                length = ::cppfastbox::libc::detail::strcpy_simd(dest_ptr, src_ptr, size - 1);
+            }
+            else { length = ::cppfastbox::libc::detail::strcpy_scalar(dest_ptr, src_ptr, size - 1); }
+        }
+        if(length != size - 1) { return length; }
+        // 发生截断，继续计算剩余部分的长度
+        dest[length] = char_type{};
+        return length + ::cppfastbox::libc::strlen(src + length);
+    }
+}  // namespace cppfastbox::libc
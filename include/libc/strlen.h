@@ -7,9 +7,11 @@
  */
 #pragma once
 #include <bit>
-#include <cstring>
-#include <cwchar>
-#include <memory>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "scan.h"
 
 /**
  * @brief strlen标量支持
@@ -17,161 +19,64 @@
  */
 namespace cppfastbox::libc::detail
 {
-    constexpr auto ad_mask = []() consteval noexcept
-    {
-        constexpr ::std::uint_least64_t mask64l{0x7efefefe'fefefeffu};
-        constexpr ::std::uint_least32_t mask32l{0x7efefeffu};
-        constexpr ::std::uint_least64_t mask64b{0xfffefefe'fefefe7eu};
-        constexpr ::std::uint_least32_t mask32b{0xfffefe7eu};
-        if constexpr(::std::endian::native == ::std::endian::little)
-        {
-            if constexpr(sizeof(::std::size_t) == 4) { return mask32l; }
-            else { return mask64l; }
-        }
-        else
-        {
-            if constexpr(sizeof(::std::size_t) == 4) { return mask32b; }
-            else { return mask64b; }
-        }
-    }();
-    constexpr auto eos_mask = []() consteval noexcept
+    /**
+     * @brief 获取字中值为0的元素
+     *
+     * @tparam char_type 元素类型
+     * @return 值为0的元素的最高位为1，其余位均为0
+     * @note 先屏蔽各元素的最高位再相加，进位不会跨越元素，因此不会误判
+     */
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t word_zero_mask(::std::size_t word) noexcept
     {
-        constexpr ::std::uint_least64_t mask64l{0x81010101'01010100u};
-        constexpr ::std::uint_least32_t mask32l{0x81010100u};
-        constexpr ::std::uint_least64_t mask64b{0x00010101'01010181u};
-        constexpr ::std::uint_least32_t mask32b{0x00010181u};
-        if constexpr(::std::endian::native == ::std::endian::little)
-        {
-            if constexpr(sizeof(::std::size_t) == 4) { return mask32l; }
-            else { return mask64l; }
-        }
-        else
-        {
-            if constexpr(sizeof(::std::size_t) == 4) { return mask32b; }
-            else { return mask64b; }
-        }
-    }();
+        constexpr auto element_max{static_cast<::std::size_t>(static_cast<char_type>(-1))};
+        // 每个元素除最高位外均为1
+        constexpr auto low_bits{static_cast<::std::size_t>(-1) / element_max * (element_max >> 1)};
+        return ~(((word & low_bits) + low_bits) | word | low_bits);
+    }
 
-    [[nodiscard]] inline ::std::size_t strlen_scalar(const char8_t* str) noexcept
+    // 获取word_zero_mask返回的掩码中第一个元素的下标
+    template <typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t word_zero_index(::std::size_t mask) noexcept
     {
-        auto* const copy = str;
-        auto* eos = reinterpret_cast<const ::std::size_t*>(str);
-        while(true)
-        {
-            auto val{*eos};
-            auto ad{val + ::cppfastbox::libc::detail::ad_mask};
-            val = ~val;
-            val ^= ad;
-            if(!(val & ::cppfastbox::libc::detail::eos_mask))
-            {
-                eos++;
-                continue;
-            }
-            // val中存在\0
-            val = *eos;
-            auto* ptr = reinterpret_cast<const char8_t*>(eos);
-
-            if constexpr(::std::endian::native == ::std::endian::little)
-            {
-                if((val & 0x000000ffu) == 0) { return ptr - copy; }
-                if((val & 0x0000ff00u) == 0) { return ptr - copy + 1; }
-                if((val & 0x00ff0000u) == 0) { return ptr - copy + 2; }
-                if((val & 0xff000000u) == 0) { return ptr - copy + 3; }
-                if constexpr(sizeof(::std::size_t) == 8)
-                {
-                    if((val & 0x000000ff'00000000u) == 0) { return ptr - copy + 4; }
-                    if((val & 0x0000ff00'00000000u) == 0) { return ptr - copy + 5; }
-                    if((val & 0x00ff0000'00000000u) == 0) { return ptr - copy + 6; }
-                    if((val & 0xff000000'00000000u) == 0) { return ptr - copy + 7; }
-                }
-            }
-            else
-            {
-                if constexpr(sizeof(::std::size_t) == 8)
-                {
-                    if((val & 0xff000000'00000000u) == 0) { return ptr - copy; }
-                    if((val & 0x00ff0000'00000000u) == 0) { return ptr - copy + 1; }
-                    if((val & 0x0000ff00'00000000u) == 0) { return ptr - copy + 2; }
-                    if((val & 0x000000ff'00000000u) == 0) { return ptr - copy + 3; }
-                }
-                if((val & 0xff000000u) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 4 : 0; }
-                if((val & 0x00ff0000u) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 5 : 1; }
-                if((val & 0x0000ff00u) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 6 : 2; }
-                if((val & 0x000000ffu) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 7 : 3; }
-            }
-        }
+        constexpr auto bits{sizeof(char_type) * 8};
+        if constexpr(::std::endian::native == ::std::endian::little) { return static_cast<::std::size_t>(::std::countr_zero(mask)) / bits; }
+        else { return static_cast<::std::size_t>(::std::countl_zero(mask)) / bits; }
     }
 
-    [[nodiscard]] inline ::std::size_t strlen_scalar(const char16_t* str) noexcept
+    /**
+     * @brief 逐字查找结束符
+     *
+     * @note 先逐字符比较到字对齐，对齐的读取不会跨页
+     */
+    template <typename char_type>
+    [[nodiscard]] inline ::std::size_t strlen_scalar(const char_type* str) noexcept
     {
-        auto* const copy = str;
-        auto* eos = reinterpret_cast<const ::std::size_t*>(str);
+        constexpr auto word_size{sizeof(::std::size_t)};
+        const auto copy{str};
+        while(reinterpret_cast<::std::uintptr_t>(str) % word_size != 0)
+        {
+            if(*str == 0) { return str - copy; }
+            str++;
+        }
         while(true)
         {
-            auto val{*eos};
-            auto ad{val + ::cppfastbox::libc::detail::ad_mask};
-            val = ~val;
-            val ^= ad;
-            if(!(val & ::cppfastbox::libc::detail::eos_mask))
-            {
-                eos++;
-                continue;
-            }
-            // val中存在\0
-            val = *eos;
-            auto* ptr = reinterpret_cast<const char16_t*>(eos);
-
-            if constexpr(::std::endian::native == ::std::endian::little)
-            {
-                if((val & 0x0000'ffffu) == 0) { return ptr - copy; }
-                if((val & 0xffff'0000u) == 0) { return ptr - copy + 1; }
-                if constexpr(sizeof(::std::size_t) == 8)
-                {
-                    if((val & 0x0000'ffff'0000'0000u) == 0) { return ptr - copy + 2; }
-                    if((val & 0xffff'0000'0000'0000u) == 0) { return ptr - copy + 3; }
-                }
-            }
-            else
-            {
-                if constexpr(sizeof(::std::size_t) == 8)
-                {
-                    if((val & 0xffff'0000'0000'0000u) == 0) { return ptr - copy; }
-                    if((val & 0x0000'ffff'0000'0000u) == 0) { return ptr - copy + 1; }
-                }
-                if((val & 0xffff'0000u) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 2 : 0; }
-                if((val & 0x0000'ffffu) == 0) { return ptr - copy + sizeof(::std::size_t) == 8 ? 3 : 1; }
-            }
+            ::std::size_t word;
+            __builtin_memcpy(&word, __builtin_assume_aligned(str, word_size), word_size);
+            auto mask{::cppfastbox::libc::detail::word_zero_mask<char_type>(word)};
+            if(mask != 0) { return str - copy + ::cppfastbox::libc::detail::word_zero_index<char_type>(mask); }
+            str += word_size / sizeof(char_type);
         }
     }
 
-    [[nodiscard]] inline ::std::size_t strlen_scalar(const char32_t* str) noexcept
+    template <typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t strnlen_scalar(const char_type* str, ::std::size_t maxlen) noexcept
     {
-        auto* const copy = str;
-        if constexpr(sizeof(::std::size_t) == 4)
+        for(auto i{0zu}; i < maxlen; i++)
         {
-            while(*str++);
-            return str - copy - 1;
-        }
-        else
-        {
-            auto* eos = reinterpret_cast<const ::std::size_t*>(str);
-            while(true)
-            {
-                auto val{*eos};
-                auto* ptr = reinterpret_cast<const char32_t*>(eos);
-                if constexpr(::std::endian::native == ::std::endian::little)
-                {
-                    if(val << 32 == 0) { return ptr - copy; }
-                    if(val >> 32 == 0) { return ptr - copy + 1; }
-                }
-                else
-                {
-                    if(val >> 32 == 0) { return ptr - copy; }
-                    if(val << 32 == 0) { return ptr - copy + 1; }
-                }
-                eos++;
-            }
+            if(str[i] == 0) { return i; }
         }
+        return maxlen;
     }
 }  // namespace cppfastbox::libc::detail
 
@@ -189,100 +94,124 @@ namespace cppfastbox::libc::detail
 #endif
     };
 
-    template <typename char_type>
+    /**
+     * @brief 以对齐的向量查找结束符
+     *
+     * @note 第一个对齐的向量中屏蔽str之前的元素，对齐的读取不会跨页
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
     [[nodiscard]] inline ::std::size_t strlen_simd(const char_type* str) noexcept
     {
-        const auto copy{str};
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-        while(true)
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        // 未按元素对齐时向量中的元素与字符串错位
+        if constexpr(sizeof(char_type) != 1)
         {
-            using v64i8 [[__gnu__::__vector_size__(64)]] = char;
-            v64i8 vc{};
-            __builtin_memcpy(&vc, str, 64);
-            ::std::uint_least64_t result{};
-            if constexpr(sizeof(char_type) == 1)
-            {
-    #ifndef __clang__
-                result = __builtin_ia32_ptestnmb512(vc, vc, -1);  //< avx512bw
-    #else
-                result = __builtin_ia32_cmpb512_mask(vc & vc, v64i8{}, 0, -1);  //< avx512bw
-    #endif
-            }
-            else if constexpr(sizeof(char_type) == 2)
-            {
-                using v32i16 [[__gnu__::__vector_size__(64)]] = short;
-    #ifndef __clang__
-                result = __builtin_ia32_ptestnmw512(::std::bit_cast<v32i16>(vc), ::std::bit_cast<v32i16>(vc), -1);  //< avx512bw
-    #else
-                result = __builtin_ia32_cmpb512_mask(::std::bit_cast<v32i16>(vc & vc), v32i16{}, 0, -1);  //< avx512bw
-    #endif
-            }
-            else
+            if(reinterpret_cast<::std::uintptr_t>(str) % sizeof(char_type) != 0) [[unlikely]]
             {
-                using v16i32 [[__gnu__::__vector_size__(64)]] = int;
-    #ifndef __clang__
-                result = __builtin_ia32_ptestnmd512(::std::bit_cast<v16i32>(vc), ::std::bit_cast<v16i32>(vc), -1);  //< avx512f
-    #else
-                result = __builtin_ia32_cmpb512_mask(::std::bit_cast<v16i32>(vc & vc), v16i32{}, 0, -1);  //< avx512bw
-    #endif
+                return ::cppfastbox::libc::detail::strlen_scalar(str);
             }
-            // 没有结束符
-            if(result == 0)
+        }
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                 vector{}) >>
+                  shift};
+        if(mask != 0) { return ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        while(true)
+        {
+            block += lanes;
+            mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                  vector{});
+            if(mask != 0) { return block - str + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask); }
+        }
+    }
+
+    /**
+     * @brief 以对齐的向量在前maxlen个字符中查找结束符
+     *
+     * @note 只读取起始于str + maxlen之前的对齐向量，它们与某个可读的字符位于同一页
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename char_type>
+    [[nodiscard]] inline ::std::size_t strnlen_simd(const char_type* str, ::std::size_t maxlen) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char_type>};
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type>;
+        if(maxlen == 0) { return 0; }
+        if constexpr(sizeof(char_type) != 1)
+        {
+            if(reinterpret_cast<::std::uintptr_t>(str) % sizeof(char_type) != 0) [[unlikely]]
             {
-                str += 64 / sizeof(char_type);
-                continue;
+                return ::cppfastbox::libc::detail::strnlen_scalar(str, maxlen);
             }
-            // 有结束符
-            return str - copy + ::std::countr_zero(result);
         }
-#elifdef __SSE2__
-        while(true)
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        auto mask{::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                 vector{}) >>
+                  shift};
+        if(mask != 0)
+        {
+            auto index{::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask)};
+            return index < maxlen ? index : maxlen;
+        }
+        // 已检查的字符数
+        ::std::size_t checked{static_cast<::std::size_t>(block + lanes - str)};
+        while(checked < maxlen)
         {
-    #ifdef __AVX2__
-            constexpr auto vector_size{32zu};
-    #else
-            constexpr auto vector_size{16zu};
-    #endif
-            using vi [[__gnu__::__vector_size__(vector_size)]] =
-                ::std::conditional_t<::std::same_as<char_type, char8_t>, char, ::std::conditional_t<::std::same_as<char_type, char16_t>, short, int>>;
-            using vi8 [[__gnu__::__vector_size__(vector_size)]] = char;
-            vi vc{};
-            __builtin_memcpy(&vc, str, vector_size);  //< sse or avx
-            vc = vc == vi{};                          //< sse2 or avx2
-    #ifdef __AVX2__
-            unsigned int result{static_cast<unsigned int>(__builtin_ia32_pmovmskb256(::std::bit_cast<vi8>(vc)))};  //< avx2
-    #else
-            unsigned int result{static_cast<unsigned int>(__builtin_ia32_pmovmskb128(::std::bit_cast<vi8>(vc)))};  //< sse2
-    #endif
-            if(result == 0)
+            block += lanes;
+            mask = ::cppfastbox::libc::detail::scan_equal<vector_size, char_type>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+                                                                                  vector{});
+            if(mask != 0)
             {
-                str += vector_size / sizeof(char_type);
-                continue;
+                auto index{checked + ::cppfastbox::libc::detail::scan_first_index<vector_size, char_type>(mask)};
+                return index < maxlen ? index : maxlen;
             }
-            return str - copy + ::std::countr_zero(result) / sizeof(char_type);
+            checked += lanes;
         }
-#endif
+        return maxlen;
     }
 }  // namespace cppfastbox::libc::detail
 
 namespace cppfastbox::libc
 {
+    /**
+     * @brief 获取字符串的长度
+     *
+     * @param str 以0结尾的字符串
+     * @return 结束符之前的字符数
+     */
     template <typename char_type>
     constexpr inline ::std::size_t strlen(const char_type* str) noexcept
     {
         if consteval
         {
             const auto copy{str};
-            while(*str++);
+            while(*str) { str++; }
             return str - copy;
         }
         else
         {
-            using pointer =
-                ::std::conditional_t<sizeof(char_type) == 1, const char8_t*, ::std::conditional_t<sizeof(char_type) == 2, const char16_t*, const char32_t*>>;
-            auto* ptr{reinterpret_cast<pointer>(str)};
+            auto* ptr{reinterpret_cast<const ::cppfastbox::libc::detail::scan_char_t<char_type>*>(str)};
             if constexpr(::cppfastbox::libc::detail::support_strlen_simd) { return ::cppfastbox::libc::detail::strlen_simd(ptr); }
             else { return ::cppfastbox::libc::detail::strlen_scalar(ptr); }
         }
     }
+
+    /**
+     * @brief 获取字符串的长度，最多检查maxlen个字符
+     *
+     * @param str 字符串，不必以0结尾
+     * @param maxlen 最多检查的字符数
+     * @return 结束符之前的字符数，前maxlen个字符中没有结束符时为maxlen
+     */
+    template <typename char_type>
+    constexpr inline ::std::size_t strnlen(const char_type* str, ::std::size_t maxlen) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::strnlen_scalar(str, maxlen); }
+        else
+        {
+            auto* ptr{reinterpret_cast<const ::cppfastbox::libc::detail::scan_char_t<char_type>*>(str)};
+            if constexpr(::cppfastbox::libc::detail::support_strlen_simd) { return ::cppfastbox::libc::detail::strnlen_simd(ptr, maxlen); }
+            else { return ::cppfastbox::libc::detail::strnlen_scalar(ptr, maxlen); }
+        }
+    }
 }  // namespace cppfastbox::libc
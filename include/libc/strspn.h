@@ -0,0 +1,358 @@
+/**
+ * @file strspn.h
+ * @brief 实现strspn、strcspn和strpbrk
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <type_traits>
+#include "memcmp.h"
+#include "strlen.h"
+
+/**
+ * @brief strspn标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 字符集，小于256的字符使用位图判断
+     *
+     * @note 宽字符集中不小于256的字符逐个比较
+     */
+    template <typename char_type>
+    struct charset_bitmap
+    {
+        using unsigned_char = ::std::make_unsigned_t<char_type>;
+
+        ::std::uint64_t bits[4]{};
+        const char_type* set;
+        bool wide{};
+
+        /**
+         * @brief 构造字符集
+         *
+         * @param set 以\0结尾的字符集
+         * @param with_null 字符集是否包含\0
+         */
+        constexpr inline charset_bitmap(const char_type* set, bool with_null) noexcept : set{set}
+        {
+            if(with_null) { bits[0] = 1; }
+            for(auto* ptr{set}; *ptr != char_type{}; ptr++)
+            {
+                auto value{static_cast<unsigned_char>(*ptr)};
+                if constexpr(sizeof(char_type) != 1)
+                {
+                    if(value >= 256)
+                    {
+                        wide = true;
+                        continue;
+                    }
+                }
+                bits[value / 64] |= ::std::uint64_t{1} << (value % 64);
+            }
+        }
+
+        [[nodiscard]] constexpr inline bool contains(char_type ch) const noexcept
+        {
+            auto value{static_cast<unsigned_char>(ch)};
+            if constexpr(sizeof(char_type) != 1)
+            {
+                if(value >= 256)
+                {
+                    if(!wide) { return false; }
+                    for(auto* ptr{set}; *ptr != char_type{}; ptr++)
+                    {
+                        if(*ptr == ch) { return true; }
+                    }
+                    return false;
+                }
+            }
+            return (bits[value / 64] >> (value % 64)) & 1;
+        }
+    };
+
+    /**
+     * @brief 查找第一个是否属于字符集与stop_in_set相同的字符
+     *
+     * @return 该字符的下标
+     */
+    template <bool stop_in_set, typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t charset_span_scalar(const char_type* str,
+                                                                     const ::cppfastbox::libc::detail::charset_bitmap<char_type>& set) noexcept
+    {
+        auto i{0zu};
+        while(set.contains(str[i]) != stop_in_set) { i++; }
+        return i;
+    }
+
+    template <typename char_type>
+    [[nodiscard, gnu::noinline]] constexpr inline ::std::size_t strspn_scalar(const char_type* str, const char_type* accept) noexcept
+    {
+        // accept不包含\0，因此在结束符处停止
+        return ::cppfastbox::libc::detail::charset_span_scalar<false>(str, ::cppfastbox::libc::detail::charset_bitmap{accept, false});
+    }
+
+    template <typename char_type>
+    [[nodiscard, gnu::noinline]] constexpr inline ::std::size_t strcspn_scalar(const char_type* str, const char_type* reject) noexcept
+    {
+        return ::cppfastbox::libc::detail::charset_span_scalar<true>(str, ::cppfastbox::libc::detail::charset_bitmap{reject, true});
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief strspn向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    /**
+     * @brief 半字节查找表
+     *
+     * @note 字符c属于字符集当且仅当low[c & 0xf] & high[c >> 4]不为0。高半字节相同的16个字符为一行，
+     * 低半字节的集合相同的行共用一位，因此最多支持8种不同的行；表在每个16字节的通道内重复
+     */
+    struct charset_nibble_table
+    {
+        alignas(64)::std::uint8_t low[64];
+        alignas(64)::std::uint8_t high[64];
+
+        /**
+         * @brief 构造查找表
+         *
+         * @param set 以\0结尾的字符集
+         * @param with_null 字符集是否包含\0
+         * @return 字符集中不同的行超过8种时无法表示，返回false
+         */
+        [[nodiscard]] inline bool assign(const char8_t* set, bool with_null) noexcept
+        {
+            // 每一行中包含的低半字节
+            ::std::uint16_t rows[16]{};
+            if(with_null) { rows[0] = 1; }
+            for(auto* ptr{set}; *ptr != char8_t{}; ptr++) { rows[*ptr >> 4] |= static_cast<::std::uint16_t>(1u << (*ptr & 0xf)); }
+            ::std::uint16_t patterns[8];
+            auto pattern_num{0zu};
+            ::std::uint8_t low_table[16]{};
+            ::std::uint8_t high_table[16]{};
+            for(auto row{0zu}; row < 16; row++)
+            {
+                if(rows[row] == 0) { continue; }
+                auto bit{0zu};
+                while(bit < pattern_num && patterns[bit] != rows[row]) { bit++; }
+                if(bit == pattern_num)
+                {
+                    if(pattern_num == 8) { return false; }
+                    patterns[pattern_num++] = rows[row];
+                    for(auto nibble{0zu}; nibble < 16; nibble++)
+                    {
+                        if((rows[row] >> nibble) & 1) { low_table[nibble] |= static_cast<::std::uint8_t>(1u << bit); }
+                    }
+                }
+                high_table[row] = static_cast<::std::uint8_t>(1u << bit);
+            }
+            for(auto i{0zu}; i < 64; i += 16)
+            {
+                __builtin_memcpy(low + i, low_table, 16);
+                __builtin_memcpy(high + i, high_table, 16);
+            }
+            return true;
+        }
+    };
+
+    /**
+     * @brief 以字符为下标的256项查找表，供avx512vbmi使用
+     *
+     * @note 属于字符集的字符对应的项为0xff，可以表示任意字符集
+     */
+    struct charset_byte_table
+    {
+        alignas(64)::std::uint8_t table[256];
+
+        [[nodiscard]] inline bool assign(const char8_t* set, bool with_null) noexcept
+        {
+            __builtin_memset(table, 0, sizeof(table));
+            if(with_null) { table[0] = 0xff; }
+            for(auto* ptr{set}; *ptr != char8_t{}; ptr++) { table[*ptr] = 0xff; }
+            return true;
+        }
+    };
+
+    template <bool use_vbmi>
+    using charset_table_t = ::std::conditional_t<use_vbmi, ::cppfastbox::libc::detail::charset_byte_table,
+                                                 ::cppfastbox::libc::detail::charset_nibble_table>;
+
+    /**
+     * @brief 对一个向量中的字符分类，返回不属于字符集的字符的掩码
+     *
+     */
+    template <::std::size_t vector_size, bool use_vbmi>
+    CPPFASTBOX_ALWAYS_INLINE inline auto charset_absent_mask(::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t> v,
+                                                             const ::cppfastbox::libc::detail::charset_table_t<use_vbmi>& table) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        if constexpr(use_vbmi)
+        {
+            // 以低7位分别在前128项和后128项中查表，再按最高位选择
+            auto ascii{::cppfastbox::libc::detail::scan_permute128<vector_size>(
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.table),
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.table + 64),
+                v)};
+            auto extended{::cppfastbox::libc::detail::scan_permute128<vector_size>(
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.table + 128),
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.table + 192),
+                v)};
+            auto high_bit{::cppfastbox::libc::detail::scan_high_bit_mask<vector_size>(v)};
+            return (::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(ascii, vector{}) & ~high_bit) |
+                   (::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(extended, vector{}) & high_bit);
+        }
+        else
+        {
+            auto low{::cppfastbox::libc::detail::scan_shuffle<vector_size>(
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.low),
+                v & 0xf)};
+            auto high{::cppfastbox::libc::detail::scan_shuffle<vector_size>(
+                ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(table.high),
+                (v >> 4) & 0xf)};
+            return ::cppfastbox::libc::detail::scan_equal<vector_size, char8_t>(low & high, vector{});
+        }
+    }
+
+    /**
+     * @brief 读取对齐的向量，返回是否属于字符集与stop_in_set相同的字符的掩码
+     *
+     */
+    template <::std::size_t vector_size, bool use_vbmi, bool stop_in_set>
+    CPPFASTBOX_ALWAYS_INLINE inline auto charset_stop_mask(const char8_t* block,
+                                                           const ::cppfastbox::libc::detail::charset_table_t<use_vbmi>& table) noexcept
+    {
+        auto mask{::cppfastbox::libc::detail::charset_absent_mask<vector_size, use_vbmi>(
+            ::cppfastbox::libc::detail::scan_load_aligned<vector_size>(block),
+            table)};
+        if constexpr(stop_in_set) { return mask ^ ::cppfastbox::libc::detail::scan_full_mask<vector_size>; }
+        else { return mask; }
+    }
+
+    /**
+     * @brief 以对齐的向量查找第一个是否属于字符集与stop_in_set相同的字符
+     *
+     * @note 结束符总是停止扫描，因此不会读取结束符所在的对齐向量之后的数据
+     */
+    template <::std::size_t vector_size, bool use_vbmi, bool stop_in_set>
+    [[nodiscard]] inline ::std::size_t charset_span_simd(const char8_t* str,
+                                                         const ::cppfastbox::libc::detail::charset_table_t<use_vbmi>& table) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, char8_t>};
+        auto [block, shift]{::cppfastbox::libc::detail::scan_align_down<vector_size>(str)};
+        // 屏蔽str之前的元素
+        auto mask{::cppfastbox::libc::detail::charset_stop_mask<vector_size, use_vbmi, stop_in_set>(block, table) >> shift};
+        if(mask != 0) { return ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(mask); }
+        while(true)
+        {
+            block += lanes;
+            mask = ::cppfastbox::libc::detail::charset_stop_mask<vector_size, use_vbmi, stop_in_set>(block, table);
+            if(mask != 0) { return block - str + ::cppfastbox::libc::detail::scan_first_index<vector_size, char8_t>(mask); }
+        }
+    }
+
+    /**
+     * @brief 以查表分类字符实现strspn
+     *
+     * @tparam vector_size 查表使用的向量大小，为0时使用标量实现
+     * @tparam use_vbmi 是否使用avx512vbmi
+     * @note 字符集无法以半字节查找表表示时使用标量实现
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_shuffle_vector_size,
+              bool use_vbmi = ::cppfastbox::libc::detail::scan_shuffle_vbmi>
+    [[nodiscard]] CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strspn_impl(const char8_t* str, const char8_t* accept) noexcept
+    {
+        if constexpr(vector_size == 0) { return ::cppfastbox::libc::detail::strspn_scalar(str, accept); }
+        else
+        {
+            if(*accept == char8_t{}) { return 0; }
+            ::cppfastbox::libc::detail::charset_table_t<use_vbmi> table;
+            if(!table.assign(accept, false)) [[unlikely]] { return ::cppfastbox::libc::detail::strspn_scalar(str, accept); }
+            return ::cppfastbox::libc::detail::charset_span_simd<vector_size, use_vbmi, false>(str, table);
+        }
+    }
+
+    /**
+     * @brief 以查表分类字符实现strcspn
+     *
+     * @tparam vector_size 查表使用的向量大小，为0时使用标量实现
+     * @tparam use_vbmi 是否使用avx512vbmi
+     * @note \0加入字符集，使查表同时检测结束符
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_shuffle_vector_size,
+              bool use_vbmi = ::cppfastbox::libc::detail::scan_shuffle_vbmi>
+    [[nodiscard]] CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strcspn_impl(const char8_t* str, const char8_t* reject) noexcept
+    {
+        if constexpr(vector_size == 0) { return ::cppfastbox::libc::detail::strcspn_scalar(str, reject); }
+        else
+        {
+            if(*reject == char8_t{}) { return ::cppfastbox::libc::detail::strlen_simd<vector_size>(str); }
+            ::cppfastbox::libc::detail::charset_table_t<use_vbmi> table;
+            if(!table.assign(reject, true)) [[unlikely]] { return ::cppfastbox::libc::detail::strcspn_scalar(str, reject); }
+            return ::cppfastbox::libc::detail::charset_span_simd<vector_size, use_vbmi, true>(str, table);
+        }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 计算str开头只由accept中的字符组成的最长前缀的长度
+     *
+     * @param str 以\0结尾的字符串
+     * @param accept 以\0结尾的字符集
+     * @note 单字节字符以向量查表分类，宽字符使用标量实现
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t strspn(const char_type* str, const char_type* accept) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::strspn_scalar(str, accept); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto* accept_ptr{reinterpret_cast<const fixed_char*>(accept)};
+            if constexpr(sizeof(char_type) == 1) { return ::cppfastbox::libc::detail::strspn_impl(ptr, accept_ptr); }
+            else { return ::cppfastbox::libc::detail::strspn_scalar(ptr, accept_ptr); }
+        }
+    }
+
+    /**
+     * @brief 计算str开头不含reject中的字符的最长前缀的长度
+     *
+     * @param str 以\0结尾的字符串
+     * @param reject 以\0结尾的字符集
+     * @note 单字节字符以向量查表分类，宽字符使用标量实现
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline ::std::size_t strcspn(const char_type* str, const char_type* reject) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::strcspn_scalar(str, reject); }
+        else
+        {
+            using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+            auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+            auto* reject_ptr{reinterpret_cast<const fixed_char*>(reject)};
+            if constexpr(sizeof(char_type) == 1) { return ::cppfastbox::libc::detail::strcspn_impl(ptr, reject_ptr); }
+            else { return ::cppfastbox::libc::detail::strcspn_scalar(ptr, reject_ptr); }
+        }
+    }
+
+    /**
+     * @brief 查找str中第一个属于accept的字符
+     *
+     * @param str 以\0结尾的字符串
+     * @param accept 以\0结尾的字符集
+     * @return 指向该字符的指针，若不存在则为nullptr
+     */
+    template <typename char_type>
+    [[nodiscard]] constexpr inline const char_type* strpbrk(const char_type* str, const char_type* accept) noexcept
+    {
+        auto* result{str + ::cppfastbox::libc::strcspn(str, accept)};
+        return *result == char_type{} ? nullptr : result;
+    }
+}  // namespace cppfastbox::libc
@@ -0,0 +1,722 @@
+/**
+ * @file utf.h
+ * @brief 实现utf-8、utf-16和utf-32的校验、相互转换以及转换后长度的计算
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <type_traits>
+#include <utility>
+#include "scan.h"
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 校验或转换unicode字符串的结果
+     *
+     */
+    struct utf_result
+    {
+        // 输入是否为合法的编码
+        bool valid;
+        // 合法时为输出的编码单元数(只校验时为输入的编码单元数)，否则为第一个非法码点的起始下标
+        ::std::size_t count;
+    };
+}  // namespace cppfastbox::libc
+
+/**
+ * @brief unicode标量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    // 解码一个码点的结果
+    struct utf_decode_result
+    {
+        char32_t code_point;
+        // 码点占用的编码单元数，非法时为0
+        ::std::size_t length;
+    };
+
+    // 判断是否为utf-8的后续字节
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline bool utf8_is_continuation(char8_t ch) noexcept { return (ch & 0xc0) == 0x80; }
+
+    /**
+     * @brief 解码并校验src开头的一个utf-8码点
+     *
+     * @param count src中剩余的编码单元数，不能为0
+     * @note 拒绝过长的编码、代理码点和超过U+10FFFF的码点
+     */
+    constexpr inline ::cppfastbox::libc::detail::utf_decode_result utf_decode(const char8_t* src, ::std::size_t count) noexcept
+    {
+        char32_t lead{src[0]};
+        if(lead < 0x80) { return {lead, 1}; }
+        // 后续字节、C0和C1(过长的2字节编码)以及F5及以上的字节不能作为首字节
+        if(lead < 0xc2 || lead > 0xf4) { return {0, 0}; }
+        if(lead < 0xe0)
+        {
+            if(count < 2 || !::cppfastbox::libc::detail::utf8_is_continuation(src[1])) { return {0, 0}; }
+            return {((lead & 0x1f) << 6) | (src[1] & 0x3fu), 2};
+        }
+        // 第二个字节的范围，排除过长的编码、代理码点和超过U+10FFFF的码点
+        char8_t low{0x80};
+        char8_t high{0xbf};
+        if(lead == 0xe0) { low = 0xa0; }
+        else if(lead == 0xed) { high = 0x9f; }
+        else if(lead == 0xf0) { low = 0x90; }
+        else if(lead == 0xf4) { high = 0x8f; }
+        if(lead < 0xf0)
+        {
+            if(count < 3 || src[1] < low || src[1] > high || !::cppfastbox::libc::detail::utf8_is_continuation(src[2])) { return {0, 0}; }
+            return {((lead & 0x0f) << 12) | ((src[1] & 0x3fu) << 6) | (src[2] & 0x3fu), 3};
+        }
+        if(count < 4 || src[1] < low || src[1] > high || !::cppfastbox::libc::detail::utf8_is_continuation(src[2]) ||
+           !::cppfastbox::libc::detail::utf8_is_continuation(src[3]))
+        {
+            return {0, 0};
+        }
+        return {((lead & 0x07) << 18) | ((src[1] & 0x3fu) << 12) | ((src[2] & 0x3fu) << 6) | (src[3] & 0x3fu), 4};
+    }
+
+    /**
+     * @brief 解码并校验src开头的一个utf-16码点
+     *
+     * @param count src中剩余的编码单元数，不能为0
+     */
+    constexpr inline ::cppfastbox::libc::detail::utf_decode_result utf_decode(const char16_t* src, ::std::size_t count) noexcept
+    {
+        char32_t unit{src[0]};
+        if((unit & 0xf800) != 0xd800) { return {unit, 1}; }
+        // 低代理不能单独出现，高代理之后必须是低代理
+        if(unit >= 0xdc00 || count < 2 || (src[1] & 0xfc00) != 0xdc00) { return {0, 0}; }
+        return {0x10000 + ((unit - 0xd800) << 10) + (src[1] - 0xdc00u), 2};
+    }
+
+    // 校验src开头的一个utf-32码点
+    constexpr inline ::cppfastbox::libc::detail::utf_decode_result utf_decode(const char32_t* src, ::std::size_t) noexcept
+    {
+        char32_t unit{src[0]};
+        if(unit > 0x10ffff || (unit & 0xfffff800) == 0xd800) { return {0, 0}; }
+        return {unit, 1};
+    }
+
+    // 解码src开头的一个合法的utf-8码点
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::cppfastbox::libc::detail::utf_decode_result utf8_decode_valid(const char8_t* src) noexcept
+    {
+        char32_t lead{src[0]};
+        if(lead < 0x80) { return {lead, 1}; }
+        if(lead < 0xe0) { return {((lead & 0x1f) << 6) | (src[1] & 0x3fu), 2}; }
+        if(lead < 0xf0) { return {((lead & 0x0f) << 12) | ((src[1] & 0x3fu) << 6) | (src[2] & 0x3fu), 3}; }
+        return {((lead & 0x07) << 18) | ((src[1] & 0x3fu) << 12) | ((src[2] & 0x3fu) << 6) | (src[3] & 0x3fu), 4};
+    }
+
+    /**
+     * @brief 将码点以utf-8编码写入dest
+     *
+     * @return 写入的编码单元数
+     */
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t utf_encode(char32_t code_point, char8_t* dest) noexcept
+    {
+        if(code_point < 0x80)
+        {
+            dest[0] = static_cast<char8_t>(code_point);
+            return 1;
+        }
+        if(code_point < 0x800)
+        {
+            dest[0] = static_cast<char8_t>(0xc0 | (code_point >> 6));
+            dest[1] = static_cast<char8_t>(0x80 | (code_point & 0x3f));
+            return 2;
+        }
+        if(code_point < 0x10000)
+        {
+            dest[0] = static_cast<char8_t>(0xe0 | (code_point >> 12));
+            dest[1] = static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3f));
+            dest[2] = static_cast<char8_t>(0x80 | (code_point & 0x3f));
+            return 3;
+        }
+        dest[0] = static_cast<char8_t>(0xf0 | (code_point >> 18));
+        dest[1] = static_cast<char8_t>(0x80 | ((code_point >> 12) & 0x3f));
+        dest[2] = static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3f));
+        dest[3] = static_cast<char8_t>(0x80 | (code_point & 0x3f));
+        return 4;
+    }
+
+    // 将码点以utf-16编码写入dest，返回写入的编码单元数
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t utf_encode(char32_t code_point, char16_t* dest) noexcept
+    {
+        if(code_point < 0x10000)
+        {
+            dest[0] = static_cast<char16_t>(code_point);
+            return 1;
+        }
+        code_point -= 0x10000;
+        dest[0] = static_cast<char16_t>(0xd800 + (code_point >> 10));
+        dest[1] = static_cast<char16_t>(0xdc00 + (code_point & 0x3ff));
+        return 2;
+    }
+
+    // 将码点以utf-32编码写入dest，返回写入的编码单元数
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t utf_encode(char32_t code_point, char32_t* dest) noexcept
+    {
+        dest[0] = code_point;
+        return 1;
+    }
+
+    /**
+     * @brief 转换起始于[read, limit)的码点
+     *
+     * @param read 输入的位置，返回时为下一个码点的位置，非法时为非法码点的位置
+     * @param written 输出的位置
+     * @return 输入是否合法
+     * @note 最后一个码点可以越过limit，但不会越过count；dest_char为void时只校验
+     */
+    template <typename src_char, typename dest_char>
+    constexpr inline bool utf_convert_range(const src_char* src,
+                                            ::std::size_t count,
+                                            ::std::size_t& read,
+                                            ::std::size_t limit,
+                                            dest_char* dest,
+                                            ::std::size_t& written) noexcept
+    {
+        while(read < limit)
+        {
+            auto [code_point, length]{::cppfastbox::libc::detail::utf_decode(src + read, count - read)};
+            if(length == 0) { return false; }
+            if constexpr(!::std::is_void_v<dest_char>) { written += ::cppfastbox::libc::detail::utf_encode(code_point, dest + written); }
+            read += length;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 逐码点校验并转换
+     *
+     * @note dest_char为void时只校验
+     */
+    template <typename src_char, typename dest_char>
+    [[nodiscard, gnu::noinline]] constexpr inline ::cppfastbox::libc::utf_result
+        utf_convert_scalar(const src_char* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        auto read{0zu};
+        auto written{0zu};
+        if(!::cppfastbox::libc::detail::utf_convert_range(src, count, read, count, dest, written)) { return {false, read}; }
+        if constexpr(::std::is_void_v<dest_char>) { return {true, count}; }
+        else { return {true, written}; }
+    }
+
+    /**
+     * @brief 合法的输入中一个编码单元对应的输出编码单元数
+     *
+     * @note 码点的输出计入utf-8的首字节或utf-16的每个代理中
+     */
+    template <typename dest_char, typename src_char>
+    CPPFASTBOX_ALWAYS_INLINE constexpr inline ::std::size_t utf_length_unit(src_char ch) noexcept
+    {
+        if constexpr(sizeof(src_char) == sizeof(dest_char)) { return 1; }
+        else if constexpr(sizeof(src_char) == 1)
+        {
+            if(::cppfastbox::libc::detail::utf8_is_continuation(ch)) { return 0; }
+            if constexpr(sizeof(dest_char) == 2) { return ch >= 0xf0 ? 2 : 1; }
+            else { return 1; }
+        }
+        else if constexpr(sizeof(src_char) == 2)
+        {
+            // 代理对中的每个代理对应2字节
+            if constexpr(sizeof(dest_char) == 1) { return ch < 0x80 ? 1 : (ch < 0x800 || (ch & 0xf800) == 0xd800 ? 2 : 3); }
+            else { return (ch & 0xfc00) == 0xdc00 ? 0 : 1; }
+        }
+        else
+        {
+            if constexpr(sizeof(dest_char) == 1) { return ch < 0x80 ? 1 : (ch < 0x800 ? 2 : (ch < 0x10000 ? 3 : 4)); }
+            else { return ch < 0x10000 ? 1 : 2; }
+        }
+    }
+
+    template <typename dest_char, typename src_char>
+    [[nodiscard]] constexpr inline ::std::size_t utf_length_scalar(const src_char* src, ::std::size_t count) noexcept
+    {
+        auto length{0zu};
+        for(auto i{0zu}; i < count; i++) { length += ::cppfastbox::libc::detail::utf_length_unit<dest_char>(src[i]); }
+        return length;
+    }
+}  // namespace cppfastbox::libc::detail
+
+/**
+ * @brief unicode向量支持
+ *
+ */
+namespace cppfastbox::libc::detail
+{
+    // 与char_type同宽的无符号向量元素类型
+    template <typename char_type>
+    using utf_unsigned_t = decltype(::cppfastbox::detail::get_simd_integral_impl<false, sizeof(char_type)>());
+    // 与scan_vector_t对应的无符号向量类型
+    template <::std::size_t vector_size, typename char_type>
+    using utf_unsigned_vector_t [[__gnu__::__vector_size__(vector_size)]] = ::cppfastbox::libc::detail::utf_unsigned_t<char_type>;
+
+    // 统计逐元素比较的结果中为真的元素数
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t utf_count(::cppfastbox::libc::detail::scan_vector_t<vector_size, char_type> result) noexcept
+    {
+        return static_cast<::std::size_t>(::std::popcount(::cppfastbox::libc::detail::scan_true_mask<vector_size, char_type>(result))) /
+               ::cppfastbox::libc::detail::scan_mask_bits<vector_size, char_type>;
+    }
+
+    // 合法的输入中一个向量的编码单元对应的输出编码单元数，同utf_length_unit
+    template <typename dest_char, ::std::size_t vector_size, typename src_char>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t utf_length_vector(const src_char* src) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, src_char>};
+        auto v{::std::bit_cast<::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, src_char>>(
+            ::cppfastbox::libc::detail::scan_load<vector_size>(src))};
+        if constexpr(sizeof(src_char) == sizeof(dest_char)) { return lanes; }
+        else if constexpr(sizeof(src_char) == 1)
+        {
+            auto length{lanes - ::cppfastbox::libc::detail::utf_count<vector_size, src_char>((v & 0xc0) == 0x80)};
+            if constexpr(sizeof(dest_char) == 2) { length += ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0xf0); }
+            return length;
+        }
+        else if constexpr(sizeof(src_char) == 2)
+        {
+            if constexpr(sizeof(dest_char) == 1)
+            {
+                return lanes + ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0x80) +
+                       ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0x800) -
+                       ::cppfastbox::libc::detail::utf_count<vector_size, src_char>((v & 0xf800) == 0xd800);
+            }
+            else { return lanes - ::cppfastbox::libc::detail::utf_count<vector_size, src_char>((v & 0xfc00) == 0xdc00); }
+        }
+        else
+        {
+            auto length{lanes + ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0x10000)};
+            if constexpr(sizeof(dest_char) == 1)
+            {
+                length += ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0x80) +
+                          ::cppfastbox::libc::detail::utf_count<vector_size, src_char>(v >= 0x800);
+            }
+            return length;
+        }
+    }
+
+    template <typename dest_char, ::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename src_char>
+    [[nodiscard]] inline ::std::size_t utf_length_simd(const src_char* src, ::std::size_t count) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, src_char>};
+        auto length{0zu};
+        auto i{0zu};
+        for(; count - i >= lanes; i += lanes) { length += ::cppfastbox::libc::detail::utf_length_vector<dest_char, vector_size>(src + i); }
+        return length + ::cppfastbox::libc::detail::utf_length_scalar<dest_char>(src + i, count - i);
+    }
+
+    /**
+     * @brief 判断一个向量中的编码单元是否都是合法的码点，且可以直接作为dest_char的编码单元
+     *
+     * @note dest_char为void时只校验
+     */
+    template <typename dest_char, ::std::size_t vector_size, typename src_char>
+    CPPFASTBOX_ALWAYS_INLINE inline bool utf_is_direct(::cppfastbox::libc::detail::scan_vector_t<vector_size, src_char> v) noexcept
+    {
+        using target_char = ::std::conditional_t<::std::is_void_v<dest_char>, src_char, dest_char>;
+        auto u{::std::bit_cast<::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, src_char>>(v)};
+        if constexpr(sizeof(src_char) == 1) { return ::cppfastbox::libc::detail::scan_high_bit_mask<vector_size>(v) == 0; }
+        else if constexpr(sizeof(target_char) == 1) { return ::cppfastbox::libc::detail::scan_true_mask<vector_size, src_char>(u >= 0x80) == 0; }
+        else if constexpr(sizeof(src_char) == 2)
+        {
+            return ::cppfastbox::libc::detail::scan_true_mask<vector_size, src_char>((u & 0xf800) == 0xd800) == 0;
+        }
+        else
+        {
+            constexpr char32_t max{sizeof(target_char) == 2 ? 0xffff : 0x10ffff};
+            return ::cppfastbox::libc::detail::scan_true_mask<vector_size, src_char>((u > max) | ((u & 0xfffff800) == 0xd800)) == 0;
+        }
+    }
+
+    /**
+     * @brief 将一个向量中的编码单元逐个转换为dest_char并写入dest
+     *
+     * @note 每个编码单元都必须可以直接作为dest_char的编码单元，见utf_is_direct
+     */
+    template <::std::size_t vector_size, typename src_char, typename dest_char>
+    CPPFASTBOX_ALWAYS_INLINE inline void utf_store_direct(dest_char* dest,
+                                                          ::cppfastbox::libc::detail::scan_vector_t<vector_size, src_char> v) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, src_char>};
+        using target [[__gnu__::__vector_size__(lanes * sizeof(dest_char))]] = ::cppfastbox::libc::detail::utf_unsigned_t<dest_char>;
+        using source = ::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, src_char>;
+        auto units{__builtin_convertvector(::std::bit_cast<source>(v), target)};
+        __builtin_memcpy(dest, &units, sizeof(units));
+    }
+
+    /**
+     * @brief 以向量校验并转换utf-16或utf-32
+     *
+     * @note 向量中的编码单元都可以直接转换时整体转换，否则逐码点转换这些编码单元
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_vector_size, typename src_char, typename dest_char>
+    [[nodiscard]] inline ::cppfastbox::libc::utf_result utf_convert_wide_simd(const src_char* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        constexpr auto lanes{::cppfastbox::libc::detail::scan_lanes<vector_size, src_char>};
+        auto read{0zu};
+        auto written{0zu};
+        while(read != count)
+        {
+            auto limit{count};
+            if(count - read >= lanes)
+            {
+                auto v{::cppfastbox::libc::detail::scan_load<vector_size>(src + read)};
+                if(::cppfastbox::libc::detail::utf_is_direct<dest_char, vector_size, src_char>(v))
+                {
+                    if constexpr(!::std::is_void_v<dest_char>)
+                    {
+                        ::cppfastbox::libc::detail::utf_store_direct<vector_size, src_char>(dest + written, v);
+                    }
+                    read += lanes;
+                    written += lanes;
+                    continue;
+                }
+                limit = read + lanes;
+            }
+            if(!::cppfastbox::libc::detail::utf_convert_range(src, count, read, limit, dest, written)) { return {false, read}; }
+        }
+        if constexpr(::std::is_void_v<dest_char>) { return {true, count}; }
+        else { return {true, written}; }
+    }
+
+    // 以向量校验utf-8时每块的字节数，块在码点的边界结束，校验通过后再转换
+    constexpr inline auto utf8_chunk_size{1024zu};
+
+    template <::std::size_t shift, typename vector, ::std::size_t... index>
+    CPPFASTBOX_ALWAYS_INLINE inline vector utf8_previous_impl(vector previous, vector current, ::std::index_sequence<index...>) noexcept
+    {
+        return __builtin_shufflevector(previous, current, (sizeof(vector) - shift + index)...);
+    }
+
+    /**
+     * @brief 获取current中每个字节之前第shift个字节组成的向量
+     *
+     * @param previous 上一个向量
+     */
+    template <::std::size_t shift, typename vector>
+    CPPFASTBOX_ALWAYS_INLINE inline vector utf8_previous(vector previous, vector current) noexcept
+    {
+        return ::cppfastbox::libc::detail::utf8_previous_impl<shift>(previous, current, ::std::make_index_sequence<sizeof(vector)>{});
+    }
+
+    // 以向量查表时使用的表
+    template <::std::size_t size>
+    struct utf8_table_t
+    {
+        ::std::uint8_t data[size];
+    };
+
+    // 将16项的表复制到向量的每个16字节的通道中
+    template <::std::size_t vector_size>
+    consteval inline ::cppfastbox::libc::detail::utf8_table_t<vector_size>
+        utf8_table(::cppfastbox::libc::detail::utf8_table_t<16> table) noexcept
+    {
+        ::cppfastbox::libc::detail::utf8_table_t<vector_size> result{};
+        for(auto i{0zu}; i < vector_size; i++) { result.data[i] = table.data[i % 16]; }
+        return result;
+    }
+
+    // 在每个16字节的通道内以index的低4位查表
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto utf8_lookup(const ::cppfastbox::libc::detail::utf8_table_t<vector_size>& table,
+                                                     ::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t> index) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        using uvector = ::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t>;
+        return ::std::bit_cast<uvector>(
+            ::cppfastbox::libc::detail::scan_shuffle<vector_size>(::cppfastbox::libc::detail::scan_load<vector_size>(table.data),
+                                                                  ::std::bit_cast<vector>(index)));
+    }
+
+    /**
+     * @brief 检查一个向量中的每个字节与之前的字节能否组成合法的utf-8
+     *
+     * @return 错误的向量，全0表示合法
+     * @note 以前一字节的高、低半字节和当前字节的高半字节分别查表，每种错误占用一位，三者的交集即为错误；
+     * 见Keiser和Lemire的"Validating UTF-8 In Less Than One Instruction Per Byte"
+     */
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto utf8_check_block(::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t> input,
+                                                          decltype(input) previous) noexcept
+    {
+        using uvector = decltype(input);
+        constexpr ::std::uint8_t too_short{1 << 0};       //< 11______ 0_______或11______ 11______
+        constexpr ::std::uint8_t too_long{1 << 1};        //< 0_______ 10______
+        constexpr ::std::uint8_t overlong_3{1 << 2};      //< 11100000 100_____
+        constexpr ::std::uint8_t too_large{1 << 3};       //< 11110100 1001____、11110100 101_____或11110101及以上 10______
+        constexpr ::std::uint8_t surrogate{1 << 4};       //< 11101101 101_____
+        constexpr ::std::uint8_t overlong_2{1 << 5};      //< 1100000_ 10______
+        constexpr ::std::uint8_t too_large_1000{1 << 6};  //< 11110101及以上 1000____
+        constexpr ::std::uint8_t overlong_4{1 << 6};      //< 11110000 1000____
+        constexpr ::std::uint8_t two_conts{1 << 7};       //< 10______ 10______
+        constexpr ::std::uint8_t carry{too_short | too_long | two_conts};
+        static constexpr auto byte_1_high{::cppfastbox::libc::detail::utf8_table<vector_size>({
+            // 0_______ ________
+            too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+            // 10______ ________
+            two_conts, two_conts, two_conts, two_conts,
+            // 1100____ ________
+            too_short | overlong_2,
+            // 1101____ ________
+            too_short,
+            // 1110____ ________
+            too_short | overlong_3 | surrogate,
+            // 1111____ ________
+            too_short | too_large | too_large_1000 | overlong_4})};
+        static constexpr auto byte_1_low{::cppfastbox::libc::detail::utf8_table<vector_size>({
+            // ____0000 ________
+            carry | overlong_3 | overlong_2 | overlong_4,
+            // ____0001 ________
+            carry | overlong_2,
+            // ____001_ ________
+            carry, carry,
+            // ____0100 ________
+            carry | too_large,
+            // ____0101 ________至____1111 ________
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            // ____1101 ________
+            carry | too_large | too_large_1000 | surrogate,
+            // ____1110 ________至____1111 ________
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000})};
+        static constexpr auto byte_2_high{::cppfastbox::libc::detail::utf8_table<vector_size>({
+            // ________ 0_______
+            too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+            // ________ 1000____
+            too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+            // ________ 1001____
+            too_long | overlong_2 | two_conts | overlong_3 | too_large,
+            // ________ 101_____
+            too_long | overlong_2 | two_conts | surrogate | too_large, too_long | overlong_2 | two_conts | surrogate | too_large,
+            // ________ 11______
+            too_short, too_short, too_short, too_short})};
+        auto prev1{::cppfastbox::libc::detail::utf8_previous<1>(previous, input)};
+        auto special{::cppfastbox::libc::detail::utf8_lookup<vector_size>(byte_1_high, prev1 >> 4) &
+                     ::cppfastbox::libc::detail::utf8_lookup<vector_size>(byte_1_low, prev1 & 0xf) &
+                     ::cppfastbox::libc::detail::utf8_lookup<vector_size>(byte_2_high, input >> 4)};
+        // 3字节码点的第3个字节和4字节码点的第3、4个字节必须是后续字节，此时two_conts不是错误
+        auto prev2{::cppfastbox::libc::detail::utf8_previous<2>(previous, input)};
+        auto prev3{::cppfastbox::libc::detail::utf8_previous<3>(previous, input)};
+        auto must_be_continuation{::std::bit_cast<uvector>((prev2 >= 0xe0) | (prev3 >= 0xf0)) & 0x80};
+        return must_be_continuation ^ special;
+    }
+
+    // 向量结尾处需要与之后的向量一起检查的各字节的最大值
+    template <::std::size_t vector_size>
+    consteval inline ::cppfastbox::libc::detail::utf8_table_t<vector_size> utf8_incomplete_table() noexcept
+    {
+        ::cppfastbox::libc::detail::utf8_table_t<vector_size> result{};
+        for(auto i{0zu}; i < vector_size - 3; i++) { result.data[i] = 0xff; }
+        result.data[vector_size - 3] = 0xef;
+        result.data[vector_size - 2] = 0xdf;
+        result.data[vector_size - 1] = 0xbf;
+        return result;
+    }
+
+    // 向量结尾处缺少后续字节的首字节，需要与下一个向量一起检查
+    template <::std::size_t vector_size>
+    CPPFASTBOX_ALWAYS_INLINE inline auto utf8_incomplete(::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t> input) noexcept
+    {
+        using uvector = ::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t>;
+        static constexpr auto max{::cppfastbox::libc::detail::utf8_incomplete_table<vector_size>()};
+        return ::std::bit_cast<uvector>(input > ::std::bit_cast<uvector>(::cppfastbox::libc::detail::scan_load<vector_size>(max.data)));
+    }
+
+    /**
+     * @brief 以向量校验utf-8
+     *
+     * @note 只在结尾处判断是否合法；全为ascii的向量不查表，只检查之前的向量是否以不完整的码点结尾
+     */
+    template <::std::size_t vector_size>
+    [[nodiscard]] inline bool utf8_validate_simd(const char8_t* src, ::std::size_t count) noexcept
+    {
+        using vector = ::cppfastbox::libc::detail::scan_vector_t<vector_size, char8_t>;
+        using uvector = ::cppfastbox::libc::detail::utf_unsigned_vector_t<vector_size, char8_t>;
+        uvector error{};
+        uvector previous{};
+        uvector incomplete{};
+        auto i{0zu};
+        for(; count - i >= vector_size; i += vector_size)
+        {
+            auto input{::cppfastbox::libc::detail::scan_load<vector_size>(src + i)};
+            auto uinput{::std::bit_cast<uvector>(input)};
+            if(::cppfastbox::libc::detail::scan_high_bit_mask<vector_size>(input) == 0) { error |= incomplete; }
+            else
+            {
+                error |= ::cppfastbox::libc::detail::utf8_check_block<vector_size>(uinput, previous);
+                incomplete = ::cppfastbox::libc::detail::utf8_incomplete<vector_size>(uinput);
+            }
+            previous = uinput;
+        }
+        if(i != count)
+        {
+            // 以0填充不足一个向量的结尾，不完整的码点之后为ascii
+            alignas(vector_size)::std::uint8_t buffer[vector_size]{};
+            __builtin_memcpy(buffer, src + i, count - i);
+            error |= ::cppfastbox::libc::detail::utf8_check_block<vector_size>(
+                ::std::bit_cast<uvector>(::cppfastbox::libc::detail::scan_load_aligned<vector_size>(buffer)),
+                previous);
+        }
+        else { error |= incomplete; }
+        return ::cppfastbox::libc::detail::scan_true_mask<vector_size, char8_t>(::std::bit_cast<vector>(error != 0)) == 0;
+    }
+
+    /**
+     * @brief 转换合法的utf-8
+     *
+     * @return 写入的编码单元数
+     * @note 全为ascii的向量直接扩展后写入，否则逐码点转换这些字节
+     */
+    template <::std::size_t vector_size, typename dest_char>
+    [[nodiscard]] inline ::std::size_t utf8_convert_valid(const char8_t* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        auto read{0zu};
+        auto written{0zu};
+        while(read != count)
+        {
+            auto limit{count};
+            if(count - read >= vector_size)
+            {
+                auto v{::cppfastbox::libc::detail::scan_load<vector_size>(src + read)};
+                if(::cppfastbox::libc::detail::scan_high_bit_mask<vector_size>(v) == 0)
+                {
+                    ::cppfastbox::libc::detail::utf_store_direct<vector_size, char8_t>(dest + written, v);
+                    read += vector_size;
+                    written += vector_size;
+                    continue;
+                }
+                limit = read + vector_size;
+            }
+            while(read < limit)
+            {
+                auto [code_point, length]{::cppfastbox::libc::detail::utf8_decode_valid(src + read)};
+                written += ::cppfastbox::libc::detail::utf_encode(code_point, dest + written);
+                read += length;
+            }
+        }
+        return written;
+    }
+
+    /**
+     * @brief 以向量校验并转换utf-8
+     *
+     * @note 按块先校验再转换，某一块非法时从该块开始逐码点转换以确定非法的位置；dest_char为void时只校验
+     */
+    template <::std::size_t vector_size = ::cppfastbox::libc::detail::scan_shuffle_vector_size, typename dest_char>
+    [[nodiscard]] inline ::cppfastbox::libc::utf_result utf8_convert_simd(const char8_t* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        auto read{0zu};
+        auto written{0zu};
+        while(read != count)
+        {
+            auto end{count};
+            if(count - read > ::cppfastbox::libc::detail::utf8_chunk_size)
+            {
+                // 合法的码点最多有3个后续字节
+                end = read + ::cppfastbox::libc::detail::utf8_chunk_size;
+                for(auto i{0zu}; i < 3 && ::cppfastbox::libc::detail::utf8_is_continuation(src[end]); i++) { end--; }
+            }
+            if(!::cppfastbox::libc::detail::utf8_validate_simd<vector_size>(src + read, end - read)) [[unlikely]]
+            {
+                if constexpr(::std::is_void_v<dest_char>)
+                {
+                    auto result{::cppfastbox::libc::detail::utf_convert_scalar(src + read, count - read, dest)};
+                    return {result.valid, read + result.count};
+                }
+                else
+                {
+                    auto result{::cppfastbox::libc::detail::utf_convert_scalar(src + read, count - read, dest + written)};
+                    return {result.valid, (result.valid ? written : read) + result.count};
+                }
+            }
+            if constexpr(!::std::is_void_v<dest_char>)
+            {
+                written += ::cppfastbox::libc::detail::utf8_convert_valid<vector_size>(src + read, end - read, dest + written);
+            }
+            read = end;
+        }
+        if constexpr(::std::is_void_v<dest_char>) { return {true, count}; }
+        else { return {true, written}; }
+    }
+
+    /**
+     * @brief 选择校验和转换的实现
+     *
+     * @note utf-8的校验需要pshufb，不支持时使用标量实现；dest_char为void时只校验
+     */
+    template <typename src_char, typename dest_char>
+    [[nodiscard]] inline ::cppfastbox::libc::utf_result utf_convert_impl(const src_char* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        if constexpr(sizeof(src_char) == 1)
+        {
+            if constexpr(::cppfastbox::libc::detail::scan_shuffle_vector_size != 0)
+            {
+                return ::cppfastbox::libc::detail::utf8_convert_simd(src, count, dest);
+            }
+            else { return ::cppfastbox::libc::detail::utf_convert_scalar(src, count, dest); }
+        }
+        else if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+        {
+            return ::cppfastbox::libc::detail::utf_convert_wide_simd(src, count, dest);
+        }
+        else { return ::cppfastbox::libc::detail::utf_convert_scalar(src, count, dest); }
+    }
+}  // namespace cppfastbox::libc::detail
+
+namespace cppfastbox::libc
+{
+    /**
+     * @brief 校验unicode字符串
+     *
+     * @param src 以char8_t、char16_t或char32_t表示的utf-8、utf-16或utf-32字符串
+     * @param count 编码单元数
+     * @note 拒绝过长的utf-8编码、不成对的代理和超过U+10FFFF的码点
+     */
+    template <::cppfastbox::fixed_size_character char_type>
+    [[nodiscard]] constexpr inline ::cppfastbox::libc::utf_result utf_validate(const char_type* src, ::std::size_t count) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::utf_convert_scalar(src, count, static_cast<void*>(nullptr)); }
+        else { return ::cppfastbox::libc::detail::utf_convert_impl(src, count, static_cast<void*>(nullptr)); }
+    }
+
+    /**
+     * @brief 校验unicode字符串并转换为另一种编码
+     *
+     * @param src 以char8_t、char16_t或char32_t表示的utf-8、utf-16或utf-32字符串
+     * @param count 编码单元数
+     * @param dest 输出，至少需要容纳utf_convert_length<dest_char>(src, count)个编码单元
+     * @note 输入非法时dest中已写入的内容未指定
+     */
+    template <::cppfastbox::fixed_size_character src_char, ::cppfastbox::fixed_size_character dest_char>
+    [[nodiscard]] constexpr inline ::cppfastbox::libc::utf_result utf_convert(const src_char* src, ::std::size_t count, dest_char* dest) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::utf_convert_scalar(src, count, dest); }
+        else { return ::cppfastbox::libc::detail::utf_convert_impl(src, count, dest); }
+    }
+
+    /**
+     * @brief 计算合法的unicode字符串转换为dest_char表示的编码后的编码单元数
+     *
+     * @param src 以char8_t、char16_t或char32_t表示的utf-8、utf-16或utf-32字符串，必须合法
+     * @param count 编码单元数
+     */
+    template <::cppfastbox::fixed_size_character dest_char, ::cppfastbox::fixed_size_character src_char>
+    [[nodiscard]] constexpr inline ::std::size_t utf_convert_length(const src_char* src, ::std::size_t count) noexcept
+    {
+        if consteval { return ::cppfastbox::libc::detail::utf_length_scalar<dest_char>(src, count); }
+        else
+        {
+            if constexpr(::cppfastbox::libc::detail::support_scan_simd)
+            {
+                return ::cppfastbox::libc::detail::utf_length_simd<dest_char>(src, count);
+            }
+            else { return ::cppfastbox::libc::detail::utf_length_scalar<dest_char>(src, count); }
+        }
+    }
+}  // namespace cppfastbox::libc
@@ -1,20 +1,467 @@
 /**
  * @file libc_override.cpp
- * @brief 在独立的翻译单元中覆盖strlen和wcslen
+ * @brief 在独立的翻译单元中覆盖libc函数
  *
  * @copyright Copyright (c) 2024
  *
  */
+// 分派的内核均内联到以对应指令集编译的函数中，不存在以向量为参数或返回值的调用；必须先于包含内核的实现
+#pragma GCC diagnostic ignored "-Wpsabi"
+// 必须先于实现包含，见dispatch.h
+#include "../../include/libc/override/dispatch.h"
 #include "../../include/libc/override.h"
 
-extern "C"
+/**
+ * @brief 被覆盖函数的实现
+ *
+ * @tparam vector_size 使用的向量大小，为0时使用标量实现
+ */
+namespace cppfastbox::libc::detail
 {
-    ::std::size_t CPPFASTBOX_CDECL strlen(const char* str)
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strlen_override_impl(const char_type* str) noexcept
+    {
+        auto* ptr{reinterpret_cast<const ::cppfastbox::libc::detail::scan_char_t<char_type>*>(str)};
+        if constexpr(vector_size == 0) { return ::cppfastbox::libc::detail::strlen_scalar(ptr); }
+        else { return ::cppfastbox::libc::detail::strlen_simd<vector_size>(ptr); }
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strnlen_override_impl(const char_type* str, ::std::size_t maxlen) noexcept
+    {
+        auto* ptr{reinterpret_cast<const ::cppfastbox::libc::detail::scan_char_t<char_type>*>(str)};
+        if constexpr(vector_size == 0) { return ::cppfastbox::libc::detail::strnlen_scalar(ptr, maxlen); }
+        else { return ::cppfastbox::libc::detail::strnlen_simd<vector_size>(ptr, maxlen); }
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strcpy_override_impl(char_type* dest, const char_type* src, ::std::size_t count) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* dest_ptr{reinterpret_cast<fixed_char*>(dest)};
+        auto* src_ptr{reinterpret_cast<const fixed_char*>(src)};
+        if constexpr(vector_size == 0) { return ::cppfastbox::libc::detail::strcpy_scalar(dest_ptr, src_ptr, count); }
+        else { return ::cppfastbox::libc::detail::strcpy_simd<vector_size>(dest_ptr, src_ptr, count); }
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline char_type* strncpy_override_impl(char_type* dest, const char_type* src, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        auto length{::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, count)};
+        // 结束符已被拷贝，一并覆盖
+        ::cppfastbox::libc::detail::memset_impl<lane>(reinterpret_cast<char*>(dest + length), 0, (count - length) * sizeof(char_type));
+        return dest;
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strlcpy_override_impl(char_type* dest, const char_type* src, ::std::size_t size) noexcept
+    {
+        if(size == 0) { return ::cppfastbox::libc::detail::strlen_override_impl<vector_size>(src); }
+        auto length{::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, size - 1)};
+        if(length != size - 1) { return length; }
+        // 发生截断，继续计算剩余部分的长度
+        dest[length] = char_type{};
+        return length + ::cppfastbox::libc::detail::strlen_override_impl<vector_size>(src + length);
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline int strcmp_override_impl(const char_type* a, const char_type* b) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* pa{reinterpret_cast<const fixed_char*>(a)};
+        auto* pb{reinterpret_cast<const fixed_char*>(b)};
+        ::std::size_t index;
+        if constexpr(vector_size == 0) { index = ::cppfastbox::libc::detail::strcmp_index_scalar(pa, pb); }
+        else { index = ::cppfastbox::libc::detail::strcmp_index_simd<vector_size>(pa, pb); }
+        return ::cppfastbox::libc::detail::strcmp_result(a[index], b[index]);
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline int strncmp_override_impl(const char_type* a, const char_type* b, ::std::size_t count) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* pa{reinterpret_cast<const fixed_char*>(a)};
+        auto* pb{reinterpret_cast<const fixed_char*>(b)};
+        ::std::size_t index;
+        if constexpr(vector_size == 0) { index = ::cppfastbox::libc::detail::strncmp_index_scalar(pa, pb, count); }
+        else { index = ::cppfastbox::libc::detail::strncmp_index_simd<vector_size>(pa, pb, count); }
+        if(index == count) { return 0; }
+        return ::cppfastbox::libc::detail::strcmp_result(a[index], b[index]);
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline const char_type*
+        memmem_override_impl(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+        auto* needle_ptr{reinterpret_cast<const fixed_char*>(needle)};
+        return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memmem_impl<vector_size>(ptr, count, needle_ptr, needle_count));
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline const char_type* strstr_override_impl(const char_type* str, const char_type* needle) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+        auto* needle_ptr{reinterpret_cast<const fixed_char*>(needle)};
+        return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strstr_impl<vector_size>(ptr, needle_ptr));
+    }
+
+    template <::std::size_t vector_size, bool use_vbmi>
+    CPPFASTBOX_ALWAYS_INLINE inline ::std::size_t strcspn_override_impl(const char* str, const char* reject) noexcept
+    {
+        return ::cppfastbox::libc::detail::strcspn_impl<vector_size, use_vbmi>(reinterpret_cast<const char8_t*>(str),
+                                                                               reinterpret_cast<const char8_t*>(reject));
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline const char_type* memchr_override_impl(const char_type* str, char_type ch, ::std::size_t count) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+        auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+        if constexpr(vector_size == 0) { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memchr_scalar(ptr, fixed_ch, count)); }
+        else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::memchr_simd<vector_size>(ptr, fixed_ch, count)); }
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline const char_type* strchr_override_impl(const char_type* str, char_type ch) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+        auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+        if constexpr(vector_size == 0) { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strchr_scalar(ptr, fixed_ch)); }
+        else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strchr_simd<vector_size>(ptr, fixed_ch)); }
+    }
+
+    template <::std::size_t vector_size, typename char_type>
+    CPPFASTBOX_ALWAYS_INLINE inline const char_type* strrchr_override_impl(const char_type* str, char_type ch) noexcept
+    {
+        using fixed_char = ::cppfastbox::libc::detail::scan_char_t<char_type>;
+        auto* ptr{reinterpret_cast<const fixed_char*>(str)};
+        auto fixed_ch{::std::bit_cast<fixed_char>(ch)};
+        if constexpr(vector_size == 0) { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strrchr_scalar(ptr, fixed_ch)); }
+        else { return reinterpret_cast<const char_type*>(::cppfastbox::libc::detail::strrchr_simd<vector_size>(ptr, fixed_ch)); }
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t strlen_override(const char* str) noexcept
+    {
+        return ::cppfastbox::libc::detail::strlen_override_impl<vector_size>(str);
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t wcslen_override(const wchar_t* str) noexcept
+    {
+        return ::cppfastbox::libc::detail::strlen_override_impl<vector_size>(str);
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t strnlen_override(const char* str, ::std::size_t maxlen) noexcept
+    {
+        return ::cppfastbox::libc::detail::strnlen_override_impl<vector_size>(str, maxlen);
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t wcsnlen_override(const wchar_t* str, ::std::size_t maxlen) noexcept
+    {
+        return ::cppfastbox::libc::detail::strnlen_override_impl<vector_size>(str, maxlen);
+    }
+
+    template <::std::size_t vector_size>
+    inline char* strcpy_override(char* dest, const char* src) noexcept
+    {
+        ::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, static_cast<::std::size_t>(-1));
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline char* stpcpy_override(char* dest, const char* src) noexcept
+    {
+        return dest + ::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, static_cast<::std::size_t>(-1));
+    }
+
+    template <::std::size_t vector_size>
+    inline char* strncpy_override(char* dest, const char* src, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::strncpy_override_impl<vector_size>(dest, src, count);
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t strlcpy_override(char* dest, const char* src, ::std::size_t size) noexcept
+    {
+        return ::cppfastbox::libc::detail::strlcpy_override_impl<vector_size>(dest, src, size);
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcscpy_override(wchar_t* dest, const wchar_t* src) noexcept
     {
-        return ::cppfastbox::libc::strlen(str);
+        ::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, static_cast<::std::size_t>(-1));
+        return dest;
     }
-    ::std::size_t CPPFASTBOX_CDECL wcslen(const wchar_t* str)
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcpcpy_override(wchar_t* dest, const wchar_t* src) noexcept
+    {
+        return dest + ::cppfastbox::libc::detail::strcpy_override_impl<vector_size>(dest, src, static_cast<::std::size_t>(-1));
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcsncpy_override(wchar_t* dest, const wchar_t* src, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::strncpy_override_impl<vector_size>(dest, src, count);
+    }
+
+    template <::std::size_t vector_size>
+    inline ::std::size_t wcslcpy_override(wchar_t* dest, const wchar_t* src, ::std::size_t size) noexcept
     {
-        return ::cppfastbox::libc::strlen(str);
+        return ::cppfastbox::libc::detail::strlcpy_override_impl<vector_size>(dest, src, size);
     }
+
+    template <::std::size_t vector_size>
+    inline int strcmp_override(const char* a, const char* b) noexcept
+    {
+        return ::cppfastbox::libc::detail::strcmp_override_impl<vector_size>(a, b);
+    }
+
+    template <::std::size_t vector_size>
+    inline int strncmp_override(const char* a, const char* b, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::strncmp_override_impl<vector_size>(a, b, count);
+    }
+
+    template <::std::size_t vector_size>
+    inline int wcscmp_override(const wchar_t* a, const wchar_t* b) noexcept
+    {
+        return ::cppfastbox::libc::detail::strcmp_override_impl<vector_size>(a, b);
+    }
+
+    template <::std::size_t vector_size>
+    inline int wcsncmp_override(const wchar_t* a, const wchar_t* b, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::strncmp_override_impl<vector_size>(a, b, count);
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memmem_override(const void* str, ::std::size_t count, const void* needle, ::std::size_t needle_count) noexcept
+    {
+        return const_cast<char*>(::cppfastbox::libc::detail::memmem_override_impl<vector_size>(static_cast<const char*>(str),
+                                                                                             count,
+                                                                                             static_cast<const char*>(needle),
+                                                                                             needle_count));
+    }
+
+    template <::std::size_t vector_size>
+    inline char* strstr_override(const char* str, const char* needle) noexcept
+    {
+        return const_cast<char*>(::cppfastbox::libc::detail::strstr_override_impl<vector_size>(str, needle));
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcsstr_override(const wchar_t* str, const wchar_t* needle) noexcept
+    {
+        return const_cast<wchar_t*>(::cppfastbox::libc::detail::strstr_override_impl<vector_size>(str, needle));
+    }
+
+    template <::std::size_t vector_size, bool use_vbmi = false>
+    inline ::std::size_t strspn_override(const char* str, const char* accept) noexcept
+    {
+        return ::cppfastbox::libc::detail::strspn_impl<vector_size, use_vbmi>(reinterpret_cast<const char8_t*>(str),
+                                                                              reinterpret_cast<const char8_t*>(accept));
+    }
+
+    template <::std::size_t vector_size, bool use_vbmi = false>
+    inline ::std::size_t strcspn_override(const char* str, const char* reject) noexcept
+    {
+        return ::cppfastbox::libc::detail::strcspn_override_impl<vector_size, use_vbmi>(str, reject);
+    }
+
+    template <::std::size_t vector_size, bool use_vbmi = false>
+    inline char* strpbrk_override(const char* str, const char* accept) noexcept
+    {
+        auto* result{str + ::cppfastbox::libc::detail::strcspn_override_impl<vector_size, use_vbmi>(str, accept)};
+        return *result == '\0' ? nullptr : const_cast<char*>(result);
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memchr_override(const void* ptr, int ch, ::std::size_t count) noexcept
+    {
+        return const_cast<char*>(
+            ::cppfastbox::libc::detail::memchr_override_impl<vector_size>(static_cast<const char*>(ptr), static_cast<char>(ch), count));
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memrchr_override(const void* ptr, int ch, ::std::size_t count) noexcept
+    {
+        auto* str{static_cast<const char8_t*>(ptr)};
+        auto fixed_ch{static_cast<char8_t>(ch)};
+        if constexpr(vector_size == 0) { return const_cast<char8_t*>(::cppfastbox::libc::detail::memrchr_scalar(str, fixed_ch, count)); }
+        else { return const_cast<char8_t*>(::cppfastbox::libc::detail::memrchr_simd<vector_size>(str, fixed_ch, count)); }
+    }
+
+    template <::std::size_t vector_size>
+    inline void* rawmemchr_override(const void* ptr, int ch) noexcept
+    {
+        auto* str{static_cast<const char8_t*>(ptr)};
+        auto fixed_ch{static_cast<char8_t>(ch)};
+        if constexpr(vector_size == 0) { return const_cast<char8_t*>(::cppfastbox::libc::detail::rawmemchr_scalar(str, fixed_ch)); }
+        else { return const_cast<char8_t*>(::cppfastbox::libc::detail::rawmemchr_simd<vector_size>(str, fixed_ch)); }
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wmemchr_override(const wchar_t* ptr, wchar_t ch, ::std::size_t count) noexcept
+    {
+        return const_cast<wchar_t*>(::cppfastbox::libc::detail::memchr_override_impl<vector_size>(ptr, ch, count));
+    }
+
+    template <::std::size_t vector_size>
+    inline char* strchr_override(const char* str, int ch) noexcept
+    {
+        return const_cast<char*>(::cppfastbox::libc::detail::strchr_override_impl<vector_size>(str, static_cast<char>(ch)));
+    }
+
+    template <::std::size_t vector_size>
+    inline char* strrchr_override(const char* str, int ch) noexcept
+    {
+        return const_cast<char*>(::cppfastbox::libc::detail::strrchr_override_impl<vector_size>(str, static_cast<char>(ch)));
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcschr_override(const wchar_t* str, wchar_t ch) noexcept
+    {
+        return const_cast<wchar_t*>(::cppfastbox::libc::detail::strchr_override_impl<vector_size>(str, ch));
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wcsrchr_override(const wchar_t* str, wchar_t ch) noexcept
+    {
+        return const_cast<wchar_t*>(::cppfastbox::libc::detail::strrchr_override_impl<vector_size>(str, ch));
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memcpy_override(void* dest, const void* src, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        ::cppfastbox::libc::detail::memcpy_impl<lane>(static_cast<char*>(dest), static_cast<const char*>(src), count);
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memmove_override(void* dest, const void* src, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        ::cppfastbox::libc::detail::memmove_impl<lane>(static_cast<char*>(dest), static_cast<const char*>(src), count);
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wmemcpy_override(wchar_t* dest, const wchar_t* src, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memcpy_override<vector_size>(dest, src, count * sizeof(wchar_t));
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline wchar_t* wmemmove_override(wchar_t* dest, const wchar_t* src, ::std::size_t count) noexcept
+    {
+        ::cppfastbox::libc::detail::memmove_override<vector_size>(dest, src, count * sizeof(wchar_t));
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline void* memset_override(void* dest, int ch, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        ::cppfastbox::libc::detail::memset_impl<lane>(static_cast<char*>(dest), static_cast<::std::uint8_t>(ch), count);
+        return dest;
+    }
+
+    template <::std::size_t vector_size>
+    inline void bzero_override(void* dest, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        ::cppfastbox::libc::detail::memset_impl<lane>(static_cast<char*>(dest), 0, count);
+    }
+
+    template <::std::size_t vector_size>
+    inline void explicit_bzero_override(void* dest, ::std::size_t count) noexcept
+    {
+        constexpr auto lane{::cppfastbox::libc::detail::override_lane_size<vector_size>};
+        ::cppfastbox::libc::detail::memset_impl<lane>(static_cast<char*>(dest), 0, count);
+        // 使编译器认为清零后的内存会被读取
+        __asm__ __volatile__("" : : "r"(dest) : "memory");
+    }
+
+    template <::std::size_t vector_size>
+    inline int memcmp_override(const void* a, const void* b, ::std::size_t count) noexcept
+    {
+        auto* pa{static_cast<const char*>(a)};
+        auto* pb{static_cast<const char*>(b)};
+        auto index{::cppfastbox::libc::detail::mismatch_index_impl<vector_size>(pa, pb, count)};
+        if(index == count) { return 0; }
+        return static_cast<int>(static_cast<unsigned char>(pa[index])) - static_cast<int>(static_cast<unsigned char>(pb[index]));
+    }
+
+    template <::std::size_t vector_size>
+    inline int bcmp_override(const void* a, const void* b, ::std::size_t count) noexcept
+    {
+        return ::cppfastbox::libc::detail::bcmp_impl<vector_size>(static_cast<const char*>(a), static_cast<const char*>(b), count);
+    }
+}  // namespace cppfastbox::libc::detail
+
+extern "C"
+{
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, strlen, (const char* str), (str))
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, wcslen, (const wchar_t* str), (str))
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, strnlen, (const char* str, ::std::size_t maxlen), (str, maxlen))
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, wcsnlen, (const wchar_t* str, ::std::size_t maxlen), (str, maxlen))
+
+    CPPFASTBOX_LIBC_OVERRIDE(char*, strcpy, (char* dest, const char* src), (dest, src))
+    CPPFASTBOX_LIBC_OVERRIDE(char*, stpcpy, (char* dest, const char* src), (dest, src))
+    CPPFASTBOX_LIBC_OVERRIDE(char*, strncpy, (char* dest, const char* src, ::std::size_t count), (dest, src, count))
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, strlcpy, (char* dest, const char* src, ::std::size_t size), (dest, src, size))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcscpy, (wchar_t* dest, const wchar_t* src), (dest, src))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcpcpy, (wchar_t* dest, const wchar_t* src), (dest, src))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcsncpy, (wchar_t* dest, const wchar_t* src, ::std::size_t count), (dest, src, count))
+    CPPFASTBOX_LIBC_OVERRIDE(::std::size_t, wcslcpy, (wchar_t* dest, const wchar_t* src, ::std::size_t size), (dest, src, size))
+
+    CPPFASTBOX_LIBC_OVERRIDE(void*, memchr, (const void* ptr, int ch, ::std::size_t count), (ptr, ch, count))
+    CPPFASTBOX_LIBC_OVERRIDE(void*, memrchr, (const void* ptr, int ch, ::std::size_t count), (ptr, ch, count))
+    CPPFASTBOX_LIBC_OVERRIDE(void*, rawmemchr, (const void* ptr, int ch), (ptr, ch))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wmemchr, (const wchar_t* ptr, wchar_t ch, ::std::size_t count), (ptr, ch, count))
+
+    CPPFASTBOX_LIBC_OVERRIDE(char*, strchr, (const char* str, int ch), (str, ch))
+    CPPFASTBOX_LIBC_OVERRIDE(char*, strrchr, (const char* str, int ch), (str, ch))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcschr, (const wchar_t* str, wchar_t ch), (str, ch))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcsrchr, (const wchar_t* str, wchar_t ch), (str, ch))
+
+    CPPFASTBOX_LIBC_OVERRIDE(void*, memcpy, (void* dest, const void* src, ::std::size_t count), (dest, src, count))
+    CPPFASTBOX_LIBC_OVERRIDE(void*, memmove, (void* dest, const void* src, ::std::size_t count), (dest, src, count))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wmemcpy, (wchar_t* dest, const wchar_t* src, ::std::size_t count), (dest, src, count))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wmemmove, (wchar_t* dest, const wchar_t* src, ::std::size_t count), (dest, src, count))
+
+    CPPFASTBOX_LIBC_OVERRIDE(void*, memset, (void* dest, int ch, ::std::size_t count), (dest, ch, count))
+    CPPFASTBOX_LIBC_OVERRIDE(void, bzero, (void* dest, ::std::size_t count), (dest, count))
+    CPPFASTBOX_LIBC_OVERRIDE(void, explicit_bzero, (void* dest, ::std::size_t count), (dest, count))
+
+    CPPFASTBOX_LIBC_OVERRIDE(int, memcmp, (const void* a, const void* b, ::std::size_t count), (a, b, count))
+    CPPFASTBOX_LIBC_OVERRIDE(int, bcmp, (const void* a, const void* b, ::std::size_t count), (a, b, count))
+
+    CPPFASTBOX_LIBC_OVERRIDE(int, strcmp, (const char* a, const char* b), (a, b))
+    CPPFASTBOX_LIBC_OVERRIDE(int, strncmp, (const char* a, const char* b, ::std::size_t count), (a, b, count))
+    CPPFASTBOX_LIBC_OVERRIDE(int, wcscmp, (const wchar_t* a, const wchar_t* b), (a, b))
+    CPPFASTBOX_LIBC_OVERRIDE(int, wcsncmp, (const wchar_t* a, const wchar_t* b, ::std::size_t count), (a, b, count))
+
+    CPPFASTBOX_LIBC_OVERRIDE(void*,
+                             memmem,
+                             (const void* str, ::std::size_t count, const void* needle, ::std::size_t needle_count),
+                             (str, count, needle, needle_count))
+    CPPFASTBOX_LIBC_OVERRIDE(char*, strstr, (const char* str, const char* needle), (str, needle))
+    CPPFASTBOX_LIBC_OVERRIDE(wchar_t*, wcsstr, (const wchar_t* str, const wchar_t* needle), (str, needle))
+
+    CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(::std::size_t, strspn, (const char* str, const char* accept), (str, accept))
+    CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(::std::size_t, strcspn, (const char* str, const char* reject), (str, reject))
+    CPPFASTBOX_LIBC_OVERRIDE_SHUFFLE(char*, strpbrk, (const char* str, const char* accept), (str, accept))
 }
@@ -5,4 +5,6 @@ target("libc-lib")
     set_basename("override")
     set_prefixname(is_config("style", "gnu") and "lib" or "")
     set_extension(is_config("style", "gnu") and ".a" or ".lib")
+    -- 防止编译器将拷贝和填充循环替换为对被覆盖函数自身的调用
+    add_cxflags("-fno-builtin", "-fno-tree-loop-distribute-patterns")
 target_end()
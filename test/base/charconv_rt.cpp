@@ -0,0 +1,528 @@
+/**
+ * @file charconv_rt.cpp
+ * @brief 整数和浮点数的to_chars、to_chars_length和from_chars运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/base/charconv.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 逐位转换的参考实现
+ *
+ * @return 写入的字符数
+ */
+template <typename char_type, typename type>
+constexpr ::std::size_t reference_to_chars(char_type* dest, type value) noexcept
+{
+    using unsigned_type = detail::charconv_unsigned_t<type>;
+    char_type digits[64]{};
+    auto count{0zu};
+    auto size{0zu};
+    auto magnitude{static_cast<unsigned_type>(value)};
+    if(value < 0)
+    {
+        dest[size++] = static_cast<char_type>('-');
+        magnitude = static_cast<unsigned_type>(0 - magnitude);
+    }
+    do {
+        digits[count++] = static_cast<char_type>('0' + magnitude % 10);
+        magnitude /= 10;
+    }
+    while(magnitude != 0);
+    while(count != 0) { dest[size++] = digits[--count]; }
+    return size;
+}
+
+// 比较to_chars与参考实现，并检查有界版本在空间不足时不写入
+template <typename char_type, typename type>
+[[gnu::noinline]] bool check_value(type value) noexcept
+{
+    char_type expected[64]{};
+    char_type output[64]{};
+    auto size{reference_to_chars(expected, value)};
+    if(to_chars_length(value) != size || size > to_chars_max_length<type>) { return false; }
+    for(auto& i : output) { i = static_cast<char_type>('#'); }
+    if(to_chars(output, value) != output + size) { return false; }
+    for(auto i{0zu}; i < size; i++)
+    {
+        if(output[i] != expected[i]) { return false; }
+    }
+    if(output[size] != static_cast<char_type>('#')) { return false; }
+    for(auto& i : output) { i = static_cast<char_type>('#'); }
+    if(to_chars(output, output + size - 1, value) != nullptr || output[0] != static_cast<char_type>('#')) { return false; }
+    return to_chars(output, output + size, value) == output + size && output[size - 1] == expected[size - 1];
+}
+
+/**
+ * @brief 检查0、最值、10的幂附近的值和随机值
+ *
+ */
+template <typename char_type, typename type>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    using unsigned_type = detail::charconv_unsigned_t<type>;
+    constexpr auto max{static_cast<type>(static_cast<unsigned_type>(-1) >> (signed_integral<type> ? 1 : 0))};
+    constexpr auto min{static_cast<type>(signed_integral<type> ? -max - 1 : 0)};
+    for(auto value : {type{}, static_cast<type>(1), max, min, static_cast<type>(max - 1), static_cast<type>(min + 1)})
+    {
+        if(!check_value<char_type>(value)) { return false; }
+    }
+    unsigned_type power{1};
+    for(auto i{0zu}; i < detail::max_digits<unsigned_type>; i++)
+    {
+        for(auto value : {static_cast<unsigned_type>(power - 1), power, static_cast<unsigned_type>(power + 1)})
+        {
+            if(!check_value<char_type>(static_cast<type>(value))) { return false; }
+            if(!check_value<char_type>(static_cast<type>(0 - value))) { return false; }
+        }
+        power *= 10;
+    }
+    test_random next{};
+    for(auto i{0zu}; i < 20000; i++)
+    {
+        unsigned_type value{static_cast<unsigned_type>(next())};
+        if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { value = value << 64 | next(); }
+        // 随机截断高位使各种位数均被覆盖
+        value >>= next() % (sizeof(type) * 8);
+        if(!check_value<char_type>(static_cast<type>(value)) || !check_value<char_type>(static_cast<type>(0 - value))) { return false; }
+    }
+    return true;
+}
+
+template <typename type>
+bool test_all_char_impl() noexcept
+{
+    return test_impl<char, type>() && test_impl<char8_t, type>() && test_impl<char16_t, type>() && test_impl<char32_t, type>() &&
+           test_impl<wchar_t, type>();
+}
+
+/**
+ * @brief 检查from_chars解析[first, last)的结果
+ *
+ * @param expected_size 期望解析的字符数，0表示非法
+ */
+template <typename type, typename char_type>
+[[gnu::noinline]] bool check_parse(const char_type* first, const char_type* last, from_chars_error expected_error, ::std::size_t expected_size,
+                                   type expected_value) noexcept
+{
+    auto value{static_cast<type>(42)};
+    auto [ptr, error]{from_chars(first, last, value)};
+    if(error != expected_error || ptr != first + expected_size) { return false; }
+    return value == (error == from_chars_error::ok ? expected_value : static_cast<type>(42));
+}
+
+/**
+ * @brief 以to_chars的输出检查from_chars，覆盖前导0、结尾的非数字、负号、超出范围和非法输入
+ *
+ * @note 数字串放在缓冲区不同偏移处使16位与8位的分组落在不同位置
+ */
+template <typename char_type, typename type>
+[[gnu::noinline]] bool test_from_chars_impl() noexcept
+{
+    using unsigned_type = detail::charconv_unsigned_t<type>;
+    constexpr auto max{static_cast<type>(static_cast<unsigned_type>(-1) >> (signed_integral<type> ? 1 : 0))};
+    constexpr auto min{static_cast<type>(signed_integral<type> ? -max - 1 : 0)};
+    char_type buffer[128]{};
+    test_random next{};
+    for(auto i{0zu}; i < 20000; i++)
+    {
+        unsigned_type random{static_cast<unsigned_type>(next())};
+        if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { random = random << 64 | next(); }
+        random >>= next() % (sizeof(type) * 8);
+        auto value{static_cast<type>(i % 2 == 0 ? random : static_cast<unsigned_type>(0 - random))};
+        if(i < 4) { value = i == 0 ? max : (i == 1 ? min : static_cast<type>(i - 2)); }
+        auto* begin{buffer + next() % 20};
+        auto* end{begin};
+        if(value < 0) { *end++ = static_cast<char_type>('-'); }
+        for(auto zeros{next() % 4 == 0 ? next() % 24 : 0}; zeros != 0; zeros--) { *end++ = static_cast<char_type>('0'); }
+        auto magnitude{value < 0 ? static_cast<unsigned_type>(0 - static_cast<unsigned_type>(value)) : static_cast<unsigned_type>(value)};
+        end = to_chars(end, magnitude);
+        auto size{static_cast<::std::size_t>(end - begin)};
+        // 结尾为非数字或紧贴last
+        *end = static_cast<char_type>(next() % 2 == 0 ? '/' : ':');
+        auto* last{next() % 2 == 0 ? end : end + 1 + next() % 20};
+        if(!check_parse(begin, last, from_chars_error::ok, size, value)) { return false; }
+        // 追加一位数字使绝对值大于最大值时必定溢出
+        if(magnitude > static_cast<unsigned_type>(max) / 10 + 1)
+        {
+            *end = static_cast<char_type>('0' + next() % 10);
+            if(!check_parse<type>(begin, end + 1, from_chars_error::overflow, size + 1, value)) { return false; }
+        }
+    }
+    // 最值加1
+    for(auto negative : {false, true})
+    {
+        if(negative && !signed_integral<type>) { continue; }
+        auto* end{buffer};
+        if(negative) { *end++ = static_cast<char_type>('-'); }
+        end = to_chars(end, static_cast<unsigned_type>(static_cast<unsigned_type>(max) + negative));
+        auto* digit{end - 1};
+        while(*digit == static_cast<char_type>('9')) { *digit-- = static_cast<char_type>('0'); }
+        *digit = static_cast<char_type>(*digit + 1);
+        if(!check_parse<type>(buffer, end, from_chars_error::overflow, static_cast<::std::size_t>(end - buffer), type{})) { return false; }
+    }
+    // 非法输入
+    constexpr char_type plus[]{'+', '1'};
+    constexpr char_type minus[]{'-', '1'};
+    constexpr char_type only_minus[]{'-'};
+    constexpr char_type space[]{' ', '1'};
+    if(!check_parse<type>(plus, plus + 2, from_chars_error::invalid, 0, type{}) ||
+       !check_parse<type>(space, space + 2, from_chars_error::invalid, 0, type{}) ||
+       !check_parse<type>(only_minus, only_minus + 1, from_chars_error::invalid, 0, type{}) ||
+       !check_parse<type>(buffer, buffer, from_chars_error::invalid, 0, type{}))
+    {
+        return false;
+    }
+    if constexpr(signed_integral<type>) { return check_parse<type>(minus, minus + 2, from_chars_error::ok, 2, static_cast<type>(-1)); }
+    else { return check_parse<type>(minus, minus + 2, from_chars_error::invalid, 0, type{}); }
+}
+
+template <typename type>
+bool test_from_chars_all_char_impl() noexcept
+{
+    return test_from_chars_impl<char, type>() && test_from_chars_impl<char8_t, type>() && test_from_chars_impl<char16_t, type>() &&
+           test_from_chars_impl<char32_t, type>() && test_from_chars_impl<wchar_t, type>();
+}
+
+// 比较[first, last)与以0结尾的expected
+template <typename char_type>
+constexpr bool equal_text(const char_type* first, const char_type* last, const char* expected) noexcept
+{
+    for(; first != last; first++, expected++)
+    {
+        if(*expected == '\0' || *first != static_cast<char_type>(*expected)) { return false; }
+    }
+    return *expected == '\0';
+}
+
+// 检查浮点数的输出，并检查有界版本在空间不足时返回nullptr
+template <typename char_type, typename type>
+constexpr bool check_float_text(type value, const char* expected) noexcept
+{
+    char_type output[64]{};
+    auto* end{to_chars(output, value)};
+    if(!equal_text(output, end, expected) || end - output > static_cast<::std::ptrdiff_t>(to_chars_max_length<type>)) { return false; }
+    return to_chars(output, end - 1, value) == nullptr && to_chars(output, end, value) == end;
+}
+
+/**
+ * @brief 检查浮点数from_chars解析以0结尾的text的结果
+ *
+ * @param expected_size 期望解析的字符数
+ * @note 以位表示比较，区分-0和0；失败时value不应被修改
+ */
+template <typename type, typename char_type = char>
+constexpr bool check_float_parse(const char* text, from_chars_error expected_error, ::std::size_t expected_size, type expected_value) noexcept
+{
+    using bits_type = detail::charconv_unsigned_t<type>;
+    char_type input[128]{};
+    auto length{0zu};
+    for(; text[length] != '\0'; length++) { input[length] = static_cast<char_type>(text[length]); }
+    auto value{static_cast<type>(42)};
+    auto [ptr, error]{from_chars(input, input + length, value)};
+    if(error != expected_error || ptr != input + expected_size) { return false; }
+    if(error != from_chars_error::ok) { expected_value = static_cast<type>(42); }
+    return ::std::bit_cast<bits_type>(value) == ::std::bit_cast<bits_type>(expected_value);
+}
+
+/**
+ * @brief 随机位表示的浮点数经to_chars和from_chars后不变
+ *
+ * @note 半数的指数限制在1附近，覆盖定点表示
+ */
+template <typename char_type, typename type>
+[[gnu::noinline]] bool test_float_round_trip_impl() noexcept
+{
+    using format = detail::float_format<type>;
+    using bits_type = typename format::bits_type;
+    constexpr auto explicit_bits{format::precision - 1};
+    constexpr auto exponent_mask{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << explicit_bits)};
+    char_type output[64]{};
+    test_random next{};
+    for(auto i{0zu}; i < 20000; i++)
+    {
+        auto bits{static_cast<bits_type>(next())};
+        if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { bits = bits << 64 | next(); }
+        if(i % 2 == 0)
+        {
+            auto exponent{static_cast<bits_type>(format::bias + static_cast<int>(next() % 128) - 64)};
+            bits = static_cast<bits_type>((bits & ~exponent_mask) | exponent << explicit_bits);
+        }
+        if(i % 5 == 0) { bits &= static_cast<bits_type>(~exponent_mask); }
+        auto value{::std::bit_cast<type>(bits)};
+        // NaN的载荷不会被保留
+        if(value != value) { continue; }
+        auto* end{to_chars(output, value)};
+        type parsed{};
+        auto [ptr, error]{from_chars(output, end, parsed)};
+        if(ptr != end || error != from_chars_error::ok || ::std::bit_cast<bits_type>(parsed) != bits) { return false; }
+        if(to_chars(output, end - 1, value) != nullptr) { return false; }
+    }
+    return true;
+}
+
+// Schubfach算法的结果与大整数精确计算的最短表示相同
+template <typename type>
+[[gnu::noinline]] bool test_schubfach_impl() noexcept
+{
+    using format = detail::float_format<type>;
+    using bits_type = typename format::bits_type;
+    constexpr auto explicit_bits{format::precision - 1};
+    constexpr auto max_biased_exponent{(1 << format::exponent_bits) - 1};
+    test_random next{};
+    for(auto i{0zu}; i < 20000; i++)
+    {
+        auto bits{static_cast<bits_type>(next())};
+        auto significand{static_cast<bits_type>(bits & ((bits_type{1} << explicit_bits) - 1))};
+        auto biased_exponent{static_cast<int>(bits >> explicit_bits) & max_biased_exponent};
+        // 有效数字为0时覆盖区间不对称的情况
+        if(i % 8 == 0) { significand = 0; }
+        if(biased_exponent == max_biased_exponent || (biased_exponent == 0 && significand == 0)) { continue; }
+        auto fast{detail::schubfach_to_decimal<type>(significand, biased_exponent)};
+        auto exact{detail::exact_to_decimal<type>(significand, biased_exponent)};
+        for(auto* decimal : {&fast, &exact})
+        {
+            while(decimal->significand % 10 == 0)
+            {
+                decimal->significand /= 10;
+                decimal->exponent++;
+            }
+        }
+        if(fast.significand != exact.significand || fast.exponent != exact.exponent) { return false; }
+    }
+    return true;
+}
+
+/**
+ * @brief 随机的有效数字和指数经Clinger快速路径或Eisel-Lemire算法解析的结果与大整数精确计算相同
+ *
+ * @note 指数覆盖上溢和下溢的边界，有效数字覆盖截断的情况
+ */
+template <typename type>
+[[gnu::noinline]] bool test_float_parse_impl() noexcept
+{
+    using format = detail::float_format<type>;
+    using bits_type = typename format::bits_type;
+    constexpr auto infinity{static_cast<bits_type>(static_cast<bits_type>((1 << format::exponent_bits) - 1) << (format::precision - 1))};
+    constexpr auto min_exponent{detail::floor_log10_pow2(format::min_exponent - format::precision) - 40};
+    constexpr auto max_exponent{detail::floor_log10_pow2(format::max_exponent) + 2};
+    char text[128]{};
+    test_random next{};
+    for(auto i{0zu}; i < 20000; i++)
+    {
+        auto digits{1 + next() % 45};
+        for(auto j{0zu}; j < digits; j++) { text[j] = static_cast<char>('0' + next() % 10); }
+        // 少量的非0数字之后跟随大量的0或9，接近两个浮点数的中间
+        if(i % 4 == 0)
+        {
+            auto fill{static_cast<char>(next() % 2 == 0 ? '0' : '9')};
+            for(auto j{next() % 18}; j < digits; j++) { text[j] = fill; }
+        }
+        text[0] = static_cast<char>('1' + next() % 9);
+        auto exponent{static_cast<int>(next() % static_cast<::std::uint64_t>(max_exponent - min_exponent)) + min_exponent};
+        auto* end{to_chars(text + digits + 1, exponent)};
+        text[digits] = 'e';
+        auto expected{detail::exact_from_decimal<type>(text, text + digits, text + digits, text + digits, exponent)};
+        type value{};
+        auto [ptr, error]{from_chars(text, end, value)};
+        if(ptr != end) { return false; }
+        if(expected == 0 || expected == infinity)
+        {
+            if(error != from_chars_error::overflow) { return false; }
+        }
+        else if(error != from_chars_error::ok || ::std::bit_cast<bits_type>(value) != expected) { return false; }
+    }
+    return true;
+}
+
+template <typename type>
+bool test_float_all_char_impl() noexcept
+{
+    return test_float_round_trip_impl<char, type>() && test_float_round_trip_impl<char8_t, type>() &&
+           test_float_round_trip_impl<char16_t, type>() && test_float_round_trip_impl<char32_t, type>() &&
+           test_float_round_trip_impl<wchar_t, type>();
+}
+
+// 与std::to_chars的输出相同
+template <typename char_type>
+[[gnu::noinline]] bool test_float_text_impl() noexcept
+{
+    constexpr auto infinity{__builtin_inf()};
+    constexpr auto nan{__builtin_nan("")};
+    return check_float_text<char_type>(0.0, "0") && check_float_text<char_type>(-0.0, "-0") && check_float_text<char_type>(1.0, "1") &&
+           check_float_text<char_type>(100.0, "100") && check_float_text<char_type>(9007199254740992.0, "9007199254740992") &&
+           check_float_text<char_type>(1e16, "1e+16") && check_float_text<char_type>(1e21, "1e+21") &&
+           check_float_text<char_type>(1.23e22, "1.23e+22") && check_float_text<char_type>(1.5e-5, "1.5e-05") &&
+           check_float_text<char_type>(0.001, "0.001") && check_float_text<char_type>(1e-4, "1e-04") &&
+           check_float_text<char_type>(0.1, "0.1") && check_float_text<char_type>(123.456, "123.456") &&
+           check_float_text<char_type>(-5088143117563431000.0, "-5088143117563430912") && check_float_text<char_type>(5e-324, "5e-324") &&
+           check_float_text<char_type>(1.7976931348623157e308, "1.7976931348623157e+308") &&
+           check_float_text<char_type>(2.2250738585072014e-308, "2.2250738585072014e-308") &&
+           check_float_text<char_type>(infinity, "inf") && check_float_text<char_type>(-infinity, "-inf") &&
+           check_float_text<char_type>(nan, "nan") && check_float_text<char_type>(-nan, "-nan") &&
+           check_float_text<char_type>(1e-45f, "1e-45") && check_float_text<char_type>(3.4028235e38f, "3.4028235e+38") &&
+           check_float_text<char_type>(1.1754944e-38f, "1.1754944e-38") && check_float_text<char_type>(0.3f, "0.3") &&
+           check_float_text<char_type>(16777216.0f, "16777216") && check_float_text<char_type>(397605984.0f, "397605984");
+}
+
+// 特殊值、不完整的输入、恰好位于中间的值和范围的边界
+template <typename char_type>
+[[gnu::noinline]] bool test_float_special_parse_impl() noexcept
+{
+    constexpr auto infinity{__builtin_inf()};
+    constexpr auto ok{from_chars_error::ok};
+    constexpr auto invalid{from_chars_error::invalid};
+    constexpr auto overflow{from_chars_error::overflow};
+    double nan{};
+    auto nan_ok{from_chars(u8"-nan(ind_0)x", u8"-nan(ind_0)x" + 12, nan).ptr == u8"-nan(ind_0)x" + 11 && nan != nan};
+    return nan_ok && check_float_parse<double, char_type>("inf", ok, 3, infinity) &&
+           check_float_parse<double, char_type>("-Infinity", ok, 9, -infinity) &&
+           check_float_parse<double, char_type>("infinit", ok, 3, infinity) &&
+           check_float_parse<double, char_type>("-0", ok, 2, -0.0) && check_float_parse<double, char_type>("1e", ok, 1, 1.0) &&
+           check_float_parse<double, char_type>("1e+", ok, 1, 1.0) && check_float_parse<double, char_type>("1.e5", ok, 4, 1e5) &&
+           check_float_parse<double, char_type>(".5", ok, 2, 0.5) && check_float_parse<double, char_type>("5.", ok, 2, 5.0) &&
+           check_float_parse<double, char_type>("0x10", ok, 1, 0.0) && check_float_parse<double, char_type>("00000.0000e5", ok, 12, 0.0) &&
+           check_float_parse<double, char_type>("-.e1", invalid, 0, 0.0) && check_float_parse<double, char_type>("+1", invalid, 0, 0.0) &&
+           check_float_parse<double, char_type>(" 1", invalid, 0, 0.0) && check_float_parse<double, char_type>(".", invalid, 0, 0.0) &&
+           check_float_parse<double, char_type>("1e-400", overflow, 6, 0.0) && check_float_parse<double, char_type>("1e400", overflow, 5, 0.0) &&
+           check_float_parse<double, char_type>("1e99999999999999999999", overflow, 22, 0.0) &&
+           check_float_parse<double, char_type>("1e-310", ok, 6, 1e-310) &&
+           check_float_parse<double, char_type>("9007199254740993", ok, 16, 9007199254740992.0) &&
+           check_float_parse<double, char_type>("9007199254740993.0000000000000000000000001", ok, 42, 9007199254740994.0) &&
+           check_float_parse<double, char_type>("0.1000000000000000055511151231257827021181583404541015625", ok, 57, 0.1) &&
+           check_float_parse<double, char_type>("2.4703282292062327e-324", overflow, 23, 0.0) &&
+           check_float_parse<double, char_type>("2.4703282292062328e-324", ok, 23, 5e-324) &&
+           check_float_parse<double, char_type>("1.7976931348623158e308", ok, 22, 1.7976931348623157e308) &&
+           check_float_parse<double, char_type>("1.7976931348623159e308", overflow, 22, 0.0) &&
+           check_float_parse<float, char_type>("7e-46", overflow, 5, 0.0f) && check_float_parse<float, char_type>("7.1e-46", ok, 7, 1e-45f) &&
+           check_float_parse<float, char_type>("16777217", ok, 8, 16777216.0f) &&
+           check_float_parse<float, char_type>("3.4028235e38", ok, 12, 3.4028235e38f);
+}
+
+consteval bool test_constexpr() noexcept
+{
+    char8_t buffer[48]{};
+    auto* end{to_chars(buffer, -1234567)};
+    auto ok{end == buffer + 8 && buffer[0] == u8'-' && buffer[7] == u8'7'};
+    ok = ok && to_chars_length(0u) == 1 && to_chars_length(static_cast<::std::int8_t>(-128)) == 4;
+    ok = ok && to_chars_length(static_cast<::std::uint64_t>(-1)) == 20 && to_chars_max_length<::std::int64_t> == 20;
+    ok = ok && to_chars(buffer, buffer + 2, 100) == nullptr;
+    constexpr char8_t text[]{u8"-0012345678901234567890,"};
+    ::std::int64_t value{};
+    auto result{from_chars(text, text + 24, value)};
+    ok = ok && result.error == from_chars_error::overflow && result.ptr == text + 23;
+    ok = ok && from_chars(text, text + 13, value) && value == -1234567890;
+    ::std::uint8_t small{};
+    ok = ok && from_chars(text + 3, text + 8, small).error == from_chars_error::overflow && small == 0;
+#if defined(__SIZEOF_INT128__)
+    end = to_chars(buffer, static_cast<native_uint128_t>(-1));
+    ok = ok && end == buffer + 39 && buffer[0] == u8'3' && buffer[38] == u8'5' && to_chars_max_length<native_int128_t> == 40;
+#endif
+    ok = ok && to_chars_max_length<double> == 24 && to_chars_max_length<float> == 15;
+    ok = ok && check_float_text<char8_t>(-1.5e-5, "-1.5e-05") && check_float_text<char8_t>(0.3f, "0.3");
+    ok = ok && check_float_parse<double>("1.2345678901234567890123e-300", from_chars_error::ok, 29, 1.2345678901234568e-300);
+    ok = ok && check_float_parse<double>("2.4703282292062328e-324", from_chars_error::ok, 23, 5e-324);
+    ok = ok && check_float_parse<float>("0.25", from_chars_error::ok, 4, 0.25f);
+#if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__)
+    ok = ok && check_float_text<char8_t>(static_cast<native_float128_t>(1) / 3, "0.3333333333333333333333333333333333");
+    ok = ok && check_float_parse<native_float128_t>("0.25", from_chars_error::ok, 4, static_cast<native_float128_t>(1) / 4);
+#endif
+    return ok;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_to_chars)
+{
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::int8_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::uint8_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::int16_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::uint16_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::int32_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::uint32_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::int64_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<::std::uint64_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<long long>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<unsigned long long>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<char>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<char32_t>());
+}
+
+#if defined(__SIZEOF_INT128__)
+CPPFASTBOX_TEST(test_to_chars_int128)
+{
+    CPPFASTBOX_ASSERT(test_all_char_impl<native_int128_t>());
+    CPPFASTBOX_ASSERT(test_all_char_impl<native_uint128_t>());
+}
+#endif
+
+CPPFASTBOX_TEST(test_from_chars)
+{
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::int8_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::uint8_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::int16_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::uint16_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::int32_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::uint32_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::int64_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<::std::uint64_t>());
+#if defined(__SIZEOF_INT128__)
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<native_int128_t>());
+    CPPFASTBOX_ASSERT(test_from_chars_all_char_impl<native_uint128_t>());
+#endif
+}
+
+CPPFASTBOX_TEST(test_float_charconv)
+{
+    CPPFASTBOX_ASSERT(test_float_text_impl<char>());
+    CPPFASTBOX_ASSERT(test_float_text_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_float_special_parse_impl<char>());
+    CPPFASTBOX_ASSERT(test_float_special_parse_impl<char32_t>());
+    CPPFASTBOX_ASSERT(test_float_all_char_impl<float>());
+    CPPFASTBOX_ASSERT(test_float_all_char_impl<double>());
+    CPPFASTBOX_ASSERT(test_schubfach_impl<float>());
+    CPPFASTBOX_ASSERT(test_schubfach_impl<double>());
+    CPPFASTBOX_ASSERT(test_float_parse_impl<float>());
+    CPPFASTBOX_ASSERT(test_float_parse_impl<double>());
+}
+
+#if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__)
+CPPFASTBOX_TEST(test_float128_charconv)
+{
+    CPPFASTBOX_ASSERT(test_float_all_char_impl<native_float128_t>());
+    CPPFASTBOX_ASSERT(check_float_text<char>(static_cast<native_float128_t>(2) / 3, "0.6666666666666666666666666666666666"));
+    CPPFASTBOX_ASSERT(check_float_text<char>(static_cast<native_float128_t>(1ull << 57) * (1ull << 56), "10384593717069655257060992658440192"));
+    // 最大的有限值，之后是其与无穷大之间的中点
+    constexpr auto max_value{::std::bit_cast<native_float128_t>(~native_uint128_t{} >> 1 ^ native_uint128_t{1} << 112)};
+    CPPFASTBOX_ASSERT(check_float_parse<native_float128_t>("1.18973149535723176508575932662800707e4932", from_chars_error::ok, 42, max_value));
+    CPPFASTBOX_ASSERT(check_float_parse<native_float128_t>("1.18973149535723176508575932662800708e4932", from_chars_error::overflow, 42, 0));
+}
+#endif
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_to_chars();
+    #if defined(__SIZEOF_INT128__)
+    test_to_chars_int128();
+    #endif
+    test_from_chars();
+    test_float_charconv();
+    #if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__)
+    test_float128_charconv();
+    #endif
+}
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file cpu_runtime_rt.cpp
+ * @brief 测试cpu_runtime.h的运行时查询
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/base/cpu_runtime.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+CPPFASTBOX_TEST(test_runtime_flags)
+{
+    // 程序能够运行，说明编译期启用的指令集在运行时都受支持
+    cpu_flags::runtime::flag_set compile_time{cpu_flags::runtime::detail::compile_time_flag_mask};
+    CPPFASTBOX_ASSERT((cpu_flags::runtime::flags() & compile_time) == compile_time);
+    for(auto i{0zu}; i < cpu_flag_num; i++)
+    {
+        CPPFASTBOX_ASSERT(cpu_flags::runtime::support(static_cast<cpu_flag>(i)) == (((cpu_flags::runtime::flags() >> i) & 1) != 0));
+    }
+    // 缓存结果只探测一次
+    CPPFASTBOX_ASSERT(&cpu_flags::runtime::info() == &cpu_flags::runtime::info());
+}
+
+CPPFASTBOX_TEST(test_runtime_cache)
+{
+    auto line_size{cpu_flags::runtime::cache_line_size()};
+    CPPFASTBOX_ASSERT(line_size != 0 && (line_size & (line_size - 1)) == 0);
+    // 各级缓存大小未知时为0，已知时应不小于一个缓存行
+    for(auto size: {cpu_flags::runtime::l1_cache_size(), cpu_flags::runtime::l2_cache_size(), cpu_flags::runtime::l3_cache_size()})
+    {
+        CPPFASTBOX_ASSERT(size == 0 || size >= line_size);
+    }
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_runtime_flags();
+    test_runtime_cache();
+}
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file dispatch_rt.cpp
+ * @brief 测试dispatch的运行时分派
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/base/dispatch.h"
+#include "../../include/base/cpu_runtime.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 返回分支编号，并求和以检查以不同指令集编译的内核结果一致
+ *
+ */
+template <::std::size_t id>
+::std::size_t kernel(const ::std::uint32_t* data, ::std::size_t size) noexcept
+{
+    ::std::uint32_t sum{};
+    for(auto i{0zu}; i < size; i++) { sum += data[i] * data[i]; }
+    return sum * 4 + id;
+}
+
+using kernel_dispatch = dispatch<dispatch_case<&kernel<3>, cpu_flag::avx512bw>, dispatch_case<&kernel<2>, cpu_flag::avx2>,
+                                 dispatch_case<&kernel<1>, cpu_flag::sse4_1>, dispatch_case<&kernel<0>>>;
+
+// 只使用编译期启用的指令集时选择的分支
+consteval ::std::size_t get_compile_time_id() noexcept
+{
+    if constexpr(cpu_flags::x86::avx512bw_support && cpu_flags::x86::avx512vl_support && cpu_flags::x86::avx512dq_support) { return 3; }
+    else if constexpr(cpu_flags::x86::avx2_support) { return 2; }
+    else if constexpr(cpu_flags::x86::sse4_2_support) { return 1; }
+    else { return 0; }
+}
+
+CPPFASTBOX_TEST(test_dispatch_resolve)
+{
+    ::std::uint32_t data[100]{};
+    for(auto i{0u}; i < 100; i++) { data[i] = i * 2654435761u; }
+    auto sum{kernel<0>(data, 100)};
+    // 编译期启用的指令集总是视为支持
+    CPPFASTBOX_ASSERT(kernel_dispatch::resolve(0)(data, 100) == sum + get_compile_time_id());
+#ifdef CPPFASTBOX_RUNTIME_DISPATCH
+    using enum cpu_flag;
+    CPPFASTBOX_ASSERT(kernel_dispatch::resolve(~0ull)(data, 100) == sum + 3);
+    CPPFASTBOX_ASSERT(kernel_dispatch::resolve(cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx, avx2>)(
+                          data, 100) == sum + max(2zu, get_compile_time_id()));
+    // avx512bw分支同时需要avx512f等指令集
+    constexpr auto avx512bw_mask{cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1, sse4_2, avx, avx2, avx512bw>};
+    CPPFASTBOX_ASSERT(kernel_dispatch::resolve(avx512bw_mask)(data, 100) == sum + max(2zu, get_compile_time_id()));
+    // sse4_1分支以sse4.2级别编译，同时需要sse4_2
+    CPPFASTBOX_ASSERT(kernel_dispatch::resolve(cpu_flags::runtime::detail::make_flag_mask<sse, sse2, sse3, ssse3, sse4_1>)(data, 100) ==
+                      sum + get_compile_time_id());
+    // 编译期已启用的指令集不向上取整到更高的级别
+    if constexpr(cpu_flags::x86::sse2_support)
+    {
+        static_assert(dispatch_case<&kernel<0>, sse2>::target == detail::dispatch_target::baseline);
+        static_assert(dispatch_case<&kernel<0>, sse2>::required_mask == cpu_flags::runtime::detail::make_flag_mask<sse2>);
+    }
+#endif
+}
+
+CPPFASTBOX_TEST(test_dispatch_call)
+{
+    ::std::uint32_t data[100]{};
+    for(auto i{0u}; i < 100; i++) { data[i] = i * 40503u; }
+    auto sum{kernel<0>(data, 100)};
+    ::std::size_t expected{};
+#ifdef CPPFASTBOX_RUNTIME_DISPATCH
+    using enum cpu_flag;
+    if(cpu_flags::runtime::support(avx512bw) && cpu_flags::runtime::support(avx512vl) && cpu_flags::runtime::support(avx512dq)) { expected = 3; }
+    else if(cpu_flags::runtime::support(avx2)) { expected = 2; }
+    else if(cpu_flags::runtime::support(sse4_2)) { expected = 1; }
+#else
+    expected = get_compile_time_id();
+#endif
+    // 首次调用选择实现，之后使用缓存的实现
+    CPPFASTBOX_ASSERT(kernel_dispatch::call(data, 100) == sum + expected);
+    CPPFASTBOX_ASSERT(kernel_dispatch::call(data, 100) == sum + expected);
+    CPPFASTBOX_ASSERT(kernel_dispatch::get() == kernel_dispatch::get());
+    CPPFASTBOX_ASSERT(kernel_dispatch::get()(data, 100) == sum + expected);
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_dispatch_resolve();
+    test_dispatch_call();
+}
+#endif
@@ -0,0 +1,206 @@
+/**
+ * @file divider_rt.cpp
+ * @brief divider运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/base/divider.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 随机的整数
+ *
+ * @note 随机地截断高位，覆盖各种宽度的除数和被除数
+ */
+template <typename type>
+type random_integer(test_random& next) noexcept
+{
+    using unsigned_type = fixed_size_integer_t<false, sizeof(type)>;
+    auto value{static_cast<unsigned_type>(next())};
+    if constexpr(sizeof(type) > sizeof(::std::uint64_t)) { value = value << 64 | next(); }
+    auto width{static_cast<int>(next() % (sizeof(type) * 8 + 1))};
+    value = width == 0 ? unsigned_type{} : static_cast<unsigned_type>(value >> (sizeof(type) * 8 - width));
+    return static_cast<type>(value);
+}
+
+/**
+ * @brief 与内建的除法比较
+ *
+ * @note 排除溢出的最小值除以-1
+ */
+template <typename type>
+bool check_divide(const divider<type>& d, type n) noexcept
+{
+    if constexpr(signed_integral<type>)
+    {
+        if(d.divisor() == -1) { return n / d == static_cast<type>(0 - static_cast<fixed_size_integer_t<false, sizeof(type)>>(n)) && n % d == 0; }
+    }
+    return n / d == static_cast<type>(n / d.divisor()) && n % d == static_cast<type>(n % d.divisor());
+}
+
+/**
+ * @brief 以各种除数和被除数测试标量除法
+ *
+ * @note 除数包括2的幂及其相邻的值和极值，被除数包括除数的倍数及其相邻的值和极值
+ */
+template <typename type>
+[[gnu::noinline]] bool test_scalar_impl(::std::size_t count) noexcept
+{
+    constexpr auto max{::std::numeric_limits<type>::max()};
+    constexpr auto min{::std::numeric_limits<type>::min()};
+    constexpr auto bits{static_cast<int>(sizeof(type) * 8)};
+    using unsigned_type = fixed_size_integer_t<false, sizeof(type)>;
+    test_random next{};
+    for(auto i{0zu}; i < count; i++)
+    {
+        auto divisor{random_integer<type>(next)};
+        if(i < 3 * bits)
+        {
+            auto power{static_cast<type>(static_cast<type>(1) << (i / 3 % (bits - signed_integral<type>)))};
+            divisor = static_cast<type>(power + static_cast<type>(i % 3) - 1);
+            if(signed_integral<type> && i % 2 == 1) { divisor = static_cast<type>(0 - divisor); }
+        }
+        if(divisor == 0) { divisor = i % 2 == 0 || !signed_integral<type> ? max : min; }
+        divider<type> d{divisor};
+        // 最小值除以-1会溢出
+        auto min_multiple{signed_integral<type> && divisor == static_cast<type>(-1) ? min : static_cast<type>(min / divisor * divisor)};
+        // 除数为最大值或最小值时回绕
+        auto before{static_cast<type>(static_cast<unsigned_type>(divisor) - 1u)};
+        auto after{static_cast<type>(static_cast<unsigned_type>(divisor) + 1u)};
+        type dividends[]{0, 1, max, min, static_cast<type>(max - 1), static_cast<type>(min + 1), divisor, before, after,
+                         static_cast<type>(max / divisor * divisor), min_multiple};
+        for(auto n : dividends)
+        {
+            if(!check_divide(d, n)) { return false; }
+        }
+        for(auto j{0zu}; j < 16; j++)
+        {
+            if(!check_divide(d, random_integer<type>(next))) { return false; }
+        }
+    }
+    return true;
+}
+
+// 8位整数的所有除数和被除数
+template <typename type>
+[[gnu::noinline]] bool test_exhaustive_impl() noexcept
+{
+    for(int divisor{::std::numeric_limits<type>::min()}; divisor <= ::std::numeric_limits<type>::max(); divisor++)
+    {
+        if(divisor == 0) { continue; }
+        divider<type> d{static_cast<type>(divisor)};
+        for(int n{::std::numeric_limits<type>::min()}; n <= ::std::numeric_limits<type>::max(); n++)
+        {
+            if(!check_divide(d, static_cast<type>(n))) { return false; }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 向量除法与逐元素的标量除法比较
+ *
+ * @tparam vector_size 向量字节数，8位元素的向量由编译器扩展元素后相乘
+ */
+template <typename element, ::std::size_t vector_size>
+[[gnu::noinline]] bool test_vector_impl(::std::size_t count) noexcept
+{
+    using scalar = fixed_size_integer_t<simd_signed_integral<element>, sizeof(element)>;
+    using vector [[gnu::vector_size(vector_size)]] = element;
+    constexpr auto lanes{vector_size / sizeof(element)};
+    test_random next{};
+    for(auto i{0zu}; i < count; i++)
+    {
+        auto divisor{random_integer<scalar>(next)};
+        if(divisor == 0) { divisor = 1; }
+        divider<scalar> d{divisor};
+        vector n{};
+        for(auto j{0zu}; j < lanes; j++) { n[j] = static_cast<element>(random_integer<scalar>(next)); }
+        if constexpr(signed_integral<scalar>)
+        {
+            if(divisor == -1) { continue; }
+        }
+        auto quotient{n / d};
+        auto remainder{n % d};
+        for(auto j{0zu}; j < lanes; j++)
+        {
+            auto value{static_cast<scalar>(n[j])};
+            if(static_cast<scalar>(quotient[j]) != d.divide(value) || static_cast<scalar>(remainder[j]) != value % d) { return false; }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 测试不超过原生向量大小的各种向量
+ *
+ * @note 以值传递宽于目标指令集的向量会改变调用约定并触发-Wpsabi
+ */
+template <typename element>
+bool test_vector_sizes(::std::size_t count) noexcept
+{
+    constexpr auto native{cpu_flags::native_simd_max_size};
+    auto ok{sizeof(element) > 4 || test_vector_impl<element, 8>(count)};
+    if constexpr(native >= 16) { ok = ok && test_vector_impl<element, 16>(count); }
+    if constexpr(native >= 32) { ok = ok && test_vector_impl<element, 32>(count); }
+    if constexpr(native >= 64) { ok = ok && test_vector_impl<element, 64>(count); }
+    return ok;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    using u8 = ::std::uint8_t;
+    using i8 = ::std::int8_t;
+    using u64 = ::std::uint64_t;
+    using i64 = ::std::int64_t;
+    auto ok{100u / divider<::std::uint32_t>{7} == 14 && 100u % divider<::std::uint32_t>{7} == 2};
+    ok = ok && -100 / divider<::std::int32_t>{7} == -14 && -100 % divider<::std::int32_t>{7} == -2 && 100 / divider<::std::int32_t>{-7} == -14;
+    ok = ok && ~0ull / divider<u64>{1} == ~0ull && ~0ull / divider<u64>{~0ull} == 1 && 5ull / divider<u64>{1ull << 63} == 0;
+    constexpr auto min64{::std::numeric_limits<i64>::min()};
+    ok = ok && min64 / divider<i64>{min64} == 1 && min64 / divider<i64>{-1} == min64 && min64 % divider<i64>{-1} == 0;
+    ok = ok && static_cast<i8>(-128) / divider<i8>{3} == -42 && static_cast<u8>(255) / divider<u8>{255} == 1;
+    return ok;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_divider)
+{
+    CPPFASTBOX_ASSERT(test_exhaustive_impl<::std::uint8_t>());
+    CPPFASTBOX_ASSERT(test_exhaustive_impl<::std::int8_t>());
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::uint16_t>(20000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::int16_t>(20000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::uint32_t>(20000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::int32_t>(20000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::uint64_t>(20000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<::std::int64_t>(20000));
+#ifdef __SIZEOF_INT128__
+    CPPFASTBOX_ASSERT(test_scalar_impl<native_uint128_t>(5000));
+    CPPFASTBOX_ASSERT(test_scalar_impl<native_int128_t>(5000));
+#endif
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_uint8_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_int8_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_uint16_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_int16_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_uint32_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_int32_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_uint64_t>(5000));
+    CPPFASTBOX_ASSERT(test_vector_sizes<simd_int64_t>(5000));
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_divider(); }
+#endif
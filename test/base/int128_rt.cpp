@@ -0,0 +1,131 @@
+/**
+ * @file int128_rt.cpp
+ * @brief uint128_t和int128_t运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/base/utility.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 随机的128位整数
+ *
+ * @note 随机地将高位清零，覆盖除数和被除数为各种宽度的情况
+ */
+inline uint128_t random_uint128(test_random& next) noexcept
+{
+    uint128_t value{next(), next()};
+    auto width{static_cast<int>(next() % 129)};
+    return width == 0 ? uint128_t{} : value >> (128 - width);
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr auto max_uint64{~0ull};
+    auto ok{wide_multiply(max_uint64, max_uint64) == uint128_t{max_uint64 - 1, 1}};
+    auto power{uint128_t{1} << 100};
+    ok = ok && power.hi == 1ull << 36 && power.lo == 0 && countl_zero(power) == 27 && countl_zero(uint128_t{}) == 128;
+    ok = ok && power / 3 == uint128_t{0x5'5555'5555, 0x5555'5555'5555'5555} && power % 3 == 1;
+    ok = ok && (power - 1) >> 64 == (1ull << 36) - 1 && (power | 7) % 10 == 3;
+    ok = ok && int128_t{-7} / 2 == -3 && int128_t{-7} % 2 == -1 && int128_t{7} % -2 == 1 && int128_t{-1} >> 100 == -1;
+    ok = ok && int128_t{-1} < 0 && uint128_t{int128_t{-1}} > 0 && static_cast<int>(int128_t{-5} * 3) == -15;
+    auto value{uint128_t{max_uint64}};
+    ok = ok && ++value == uint128_t{1, 0} && value-- == uint128_t{1, 0} && value == max_uint64 && static_cast<bool>(value);
+    return ok;
+}
+
+static_assert(test_constexpr());
+
+#if __SIZEOF_POINTER__ == 8
+__extension__ using reference_uint128 = unsigned __int128;
+__extension__ using reference_int128 = __int128;
+
+inline reference_uint128 to_reference(uint128_t value) noexcept { return static_cast<reference_uint128>(value.hi) << 64 | value.lo; }
+
+/**
+ * @brief 与编译器内建的128位整数比较所有运算
+ *
+ * @note 编译器总是在64位平台上提供__int128，与__SIZEOF_INT128__是否被定义无关
+ */
+[[gnu::noinline]] bool test_reference_impl() noexcept
+{
+    test_random next{};
+    for(auto i{0zu}; i < 200000; i++)
+    {
+        auto a{random_uint128(next)};
+        auto b{random_uint128(next)};
+        auto shift{static_cast<int>(next() % 128)};
+        auto ra{to_reference(a)};
+        auto rb{to_reference(b)};
+        if(to_reference(a + b) != ra + rb || to_reference(a - b) != ra - rb || to_reference(a * b) != ra * rb) { return false; }
+        if(to_reference(a << shift) != ra << shift || to_reference(a >> shift) != ra >> shift) { return false; }
+        if(to_reference(a & b) != (ra & rb) || to_reference(a | b) != (ra | rb) || to_reference(a ^ b) != (ra ^ rb)) { return false; }
+        if((a < b) != (ra < rb) || (a == b) != (ra == rb) || to_reference(-a) != -ra || to_reference(~a) != ~ra) { return false; }
+        if(to_reference(wide_multiply(a.lo, b.lo)) != static_cast<reference_uint128>(a.lo) * b.lo) { return false; }
+        if(countl_zero(a) != (a.hi != 0 ? __builtin_clzll(a.hi) : a.lo != 0 ? 64 + __builtin_clzll(a.lo) : 128)) { return false; }
+        if(b != 0 && (to_reference(a / b) != ra / rb || to_reference(a % b) != ra % rb)) { return false; }
+        auto sa{int128_t{a}};
+        auto sb{int128_t{b}};
+        auto rsa{static_cast<reference_int128>(ra)};
+        auto rsb{static_cast<reference_int128>(rb)};
+        if(static_cast<reference_int128>(to_reference(uint128_t{sa >> shift})) != rsa >> shift || (sa < sb) != (rsa < rsb)) { return false; }
+        // 除法向0取整，排除溢出的最小值除以-1
+        if(b != 0 && !(sb == -1 && sa == int128_t{1} << 127))
+        {
+            if(static_cast<reference_int128>(to_reference(uint128_t{sa / sb})) != rsa / rsb) { return false; }
+            if(static_cast<reference_int128>(to_reference(uint128_t{sa % sb})) != rsa % rsb) { return false; }
+        }
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief 可移植实现满足除法和乘法的恒等式
+ *
+ * @note 直接测试可移植实现，支持__int128扩展时公开接口不会使用它
+ */
+[[gnu::noinline]] bool test_portable_impl() noexcept
+{
+    test_random next{};
+    for(auto i{0zu}; i < 200000; i++)
+    {
+        auto a{random_uint128(next)};
+        auto b{random_uint128(next)};
+        if(b == 0) { continue; }
+        detail::uint128_storage remainder{};
+        auto quotient{detail::uint128_divide(detail::make_uint128(a.hi, a.lo), detail::make_uint128(b.hi, b.lo), remainder)};
+        if(uint128_t{quotient.hi, quotient.lo} != a / b || uint128_t{remainder.hi, remainder.lo} != a % b) { return false; }
+        auto product{detail::uint128_multiply_64(a.lo, b.lo)};
+        if(uint128_t{product.hi, product.lo} != wide_multiply(a.lo, b.lo)) { return false; }
+        auto shift{static_cast<int>(next() % 128)};
+        auto left{detail::uint128_shift_left(detail::make_uint128(a.hi, a.lo), shift)};
+        auto right{detail::uint128_shift_right<true>(detail::make_uint128(a.hi, a.lo), shift)};
+        if(uint128_t{left.hi, left.lo} != a << shift || uint128_t{right.hi, right.lo} != uint128_t{int128_t{a} >> shift}) { return false; }
+    }
+    return true;
+}
+
+CPPFASTBOX_TEST(test_int128)
+{
+#if __SIZEOF_POINTER__ == 8
+    CPPFASTBOX_ASSERT(test_reference_impl());
+#endif
+    CPPFASTBOX_ASSERT(test_portable_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_int128(); }
+#endif
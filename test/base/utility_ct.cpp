@@ -242,6 +242,12 @@ constexpr void test_simd_integer() noexcept
     static_assert(!simd_integral<__int128_t>, MEET(__int128_t, simd_integral));
     static_assert(!simd_integral<__uint128_t>, MEET(__uint128_t, simd_integral));
 #endif
+
+    // 宽度必须与对应的定长整数相同
+    static_assert(sizeof(cppfastbox::simd_int8_t) == 1 && sizeof(cppfastbox::simd_uint8_t) == 1);
+    static_assert(sizeof(cppfastbox::simd_int16_t) == 2 && sizeof(cppfastbox::simd_uint16_t) == 2);
+    static_assert(sizeof(cppfastbox::simd_int32_t) == 4 && sizeof(cppfastbox::simd_uint32_t) == 4);
+    static_assert(sizeof(cppfastbox::simd_int64_t) == 8 && sizeof(cppfastbox::simd_uint64_t) == 8);
 }
 
 #define ASSERT_SAME(is_signed, size, type)                                                                                                      \
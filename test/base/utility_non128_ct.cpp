@@ -103,4 +103,21 @@ constexpr void test_fixed_size_integer_t() noexcept
     ASSERT_SAME(false, 2, std::uint16_t);
     ASSERT_SAME(false, 4, std::uint32_t);
     ASSERT_SAME(false, 8, std::uint64_t);
-}
\ No newline at end of file
+}
+// 以64位运算实现的uint128_t和int128_t
+constexpr void test_int128() noexcept
+{
+    static_assert(!int128_support, "int128_support is true");
+    static_assert(sizeof(uint128_t) == 16 && sizeof(int128_t) == 16, "The size of int128 is not 16");
+    static_assert(wide_multiply(~0ull, ~0ull) == uint128_t{~0ull - 1, 1}, "wide_multiply(~0ull, ~0ull) is wrong");
+    static_assert((uint128_t{1} << 100) / 3 == uint128_t{0x5'5555'5555, 0x5555'5555'5555'5555}, "2^100 / 3 is wrong");
+    static_assert((uint128_t{1} << 100) % 3 == 1, "2^100 % 3 is not 1");
+    static_assert(uint128_t{0x3'62bb, 0x7d62'1fe8'03e4'1344} / uint128_t{0x3101, 0xaae6'88c9'abe2'e5d1} == 17,
+                  "Division by a 128-bit divisor is wrong");
+    static_assert(uint128_t{12345, 67890} / 1000000007 * 1000000007 + uint128_t{12345, 67890} % 1000000007 == uint128_t{12345, 67890},
+                  "Division by a 64-bit divisor is wrong");
+    static_assert(int128_t{-7} / 2 == -3 && int128_t{-7} % 2 == -1, "Signed division does not round toward zero");
+    static_assert(int128_t{-1} >> 100 == -1 && (uint128_t{~0ull, 0} >> 100) == 0xfff'ffff, "Right shift is wrong");
+    static_assert(int128_t{-1} < 0 && uint128_t{int128_t{-1}} > 0, "Comparison is wrong");
+    static_assert(countl_zero(uint128_t{1}) == 127 && countl_zero(uint128_t{1, 0}) == 63, "countl_zero is wrong");
+}
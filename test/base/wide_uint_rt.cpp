@@ -0,0 +1,164 @@
+/**
+ * @file wide_uint_rt.cpp
+ * @brief wide_uint运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/base/wide_uint.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 随机的大整数
+ *
+ * @note 随机地将部分limb置为0或全1，覆盖进位和借位连续传播的情况
+ */
+template <::std::size_t bits>
+wide_uint<bits> random_wide_uint(test_random& next) noexcept
+{
+    wide_uint<bits> value;
+    auto mode{next() % 4};
+    for(auto& limb : value.limbs)
+    {
+        auto random{next()};
+        limb = mode == 0 ? random : (random % 3 == 0 ? 0 : random % 3 == 1 ? ~0ull : next());
+    }
+    return value;
+}
+
+/**
+ * @brief 以32位为一位的乘法，作为参考实现
+ *
+ * @note 与被测实现使用不同的分解方式
+ */
+template <::std::size_t bits>
+wide_uint<bits * 2> reference_multiply(const wide_uint<bits>& a, const wide_uint<bits>& b) noexcept
+{
+    constexpr auto digits{bits / 32};
+    ::std::uint32_t x[digits]{};
+    ::std::uint32_t y[digits]{};
+    ::std::uint32_t product[digits * 2]{};
+    for(auto i{0zu}; i < digits; i++)
+    {
+        x[i] = static_cast<::std::uint32_t>(a.limbs[i / 2] >> (i % 2 * 32));
+        y[i] = static_cast<::std::uint32_t>(b.limbs[i / 2] >> (i % 2 * 32));
+    }
+    for(auto i{0zu}; i < digits; i++)
+    {
+        ::std::uint64_t carry{};
+        for(auto j{0zu}; j < digits; j++)
+        {
+            auto value{static_cast<::std::uint64_t>(x[j]) * y[i] + product[i + j] + carry};
+            product[i + j] = static_cast<::std::uint32_t>(value);
+            carry = value >> 32;
+        }
+        product[i + digits] = static_cast<::std::uint32_t>(carry);
+    }
+    wide_uint<bits * 2> result;
+    for(auto i{0zu}; i < digits * 2; i++) { result.limbs[i / 2] |= static_cast<::std::uint64_t>(product[i]) << (i % 2 * 32); }
+    return result;
+}
+
+// 从最高的limb开始逐个比较，作为参考实现
+template <::std::size_t bits>
+int reference_compare(const wide_uint<bits>& a, const wide_uint<bits>& b) noexcept
+{
+    for(auto i{wide_uint<bits>::limb_count}; i != 0; i--)
+    {
+        if(a.limbs[i - 1] != b.limbs[i - 1]) { return a.limbs[i - 1] < b.limbs[i - 1] ? -1 : 1; }
+    }
+    return 0;
+}
+
+/**
+ * @brief 随机测试所有运算
+ *
+ * @note 加减法以互逆和与乘法的关系检查，移位以乘以2的幂检查
+ */
+template <::std::size_t bits>
+[[gnu::noinline]] bool test_impl(::std::size_t count) noexcept
+{
+    test_random next{};
+    for(auto i{0zu}; i < count; i++)
+    {
+        auto a{random_wide_uint<bits>(next)};
+        auto b{random_wide_uint<bits>(next)};
+        auto full{wide_multiply(a, b)};
+        if(full != reference_multiply(a, b) || a * b != wide_uint<bits>{full}) { return false; }
+        auto sum{a + b};
+        if(sum - b != a || sum - a != b || a - b != -(b - a) || a + a != a * 2u) { return false; }
+        // 和的进位
+        auto carry{wide_uint<bits * 2>{a} + wide_uint<bits * 2>{b}};
+        if(wide_uint<bits>{carry >> static_cast<int>(bits)} != (sum < a ? 1u : 0u)) { return false; }
+        auto order{reference_compare(a, b)};
+        if((a < b) != (order < 0) || (a == b) != (order == 0) || (a > b) != (order > 0) || a != a || a < a) { return false; }
+        auto shift{static_cast<int>(next() % bits)};
+        if(a << shift != a * (wide_uint<bits>{1u} << shift)) { return false; }
+        auto high{wide_uint<bits>{(wide_uint<bits * 2>{a} << shift) >> static_cast<int>(bits)}};
+        if(shift != 0 && high != a >> (static_cast<int>(bits) - shift)) { return false; }
+        if((a >> shift << shift) != (a & ~((wide_uint<bits>{1u} << shift) - 1u))) { return false; }
+        if((a ^ b) != ((a | b) & ~(a & b))) { return false; }
+        auto zeros{countl_zero(a >> shift)};
+        if(a >> shift != 0 && (zeros < shift || (a >> shift) >> (static_cast<int>(bits) - 1 - zeros) != 1u)) { return false; }
+    }
+    return true;
+}
+
+// 进位和借位贯穿所有limb
+template <::std::size_t bits>
+constexpr bool test_carry_impl() noexcept
+{
+    auto max{~wide_uint<bits>{}};
+    auto value{max};
+    return max + 1u == 0u && ++value == 0u && --value == max && value-- == max && wide_uint<bits>{} - 1u == max && max * max == 1u &&
+           wide_multiply(max, max) == (~wide_uint<bits * 2>{} << static_cast<int>(bits + 1)) + 1u && countl_zero(max) == 0 &&
+           countl_zero(wide_uint<bits>{}) == static_cast<int>(bits) && static_cast<::std::uint64_t>(max) == ~0ull &&
+           wide_uint<bits>{-1} == max;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    // 2^255 - 19
+    auto prime{(uint256_t{1u} << 255) - 19u};
+    auto ok{prime.limbs[3] == 0x7fff'ffff'ffff'ffff && prime.limbs[0] == 0xffff'ffff'ffff'ffed && countl_zero(prime) == 1};
+    ok = ok && prime * prime == 361u && (prime + 19u) * 2u == 0u && prime > uint256_t{~0ull} && uint256_t{1u} < prime;
+    auto square{wide_multiply(prime, prime)};
+    // (2^255 - 19)^2 = (2^254 - 19) * 2^256 + 361
+    ok = ok && square.limbs[0] == 361 && square.limbs[3] == 0 && square.limbs[4] == 0xffff'ffff'ffff'ffed;
+    ok = ok && square.limbs[7] == 0x3fff'ffff'ffff'ffff;
+    ok = ok && test_carry_impl<256>() && test_carry_impl<1024>();
+    ok = ok && static_cast<uint128_t>(uint512_t{uint128_t{3, 5}} << 64) == uint128_t{5, 0};
+    return ok;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_wide_uint)
+{
+    CPPFASTBOX_ASSERT(test_impl<64>(20000));
+    CPPFASTBOX_ASSERT(test_impl<128>(20000));
+    CPPFASTBOX_ASSERT(test_impl<192>(20000));
+    CPPFASTBOX_ASSERT(test_impl<256>(20000));
+    CPPFASTBOX_ASSERT(test_impl<512>(10000));
+    // 使用Karatsuba乘法
+    CPPFASTBOX_ASSERT(test_impl<1024>(2000));
+    CPPFASTBOX_ASSERT(test_impl<2048>(1000));
+    CPPFASTBOX_ASSERT(test_impl<3072>(300));
+    CPPFASTBOX_ASSERT(test_carry_impl<256>());
+    CPPFASTBOX_ASSERT(test_carry_impl<2048>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_wide_uint(); }
+#endif
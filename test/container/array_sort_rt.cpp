@@ -0,0 +1,131 @@
+/**
+ * @file array_sort_rt.cpp
+ * @brief 定长数组的排序网络运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/container/array.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 由0-1原则，排序网络能排序所有0-1序列时能排序任意序列
+ *
+ * @note 对不超过16个元素穷举所有0-1序列
+ */
+template <typename type, ::std::size_t n>
+[[gnu::noinline]] bool test_zero_one_impl() noexcept
+{
+    for(auto bits{0ull}; bits < (1ull << n); bits++)
+    {
+        array<type, n> data{};
+        for(auto i{0zu}; i < n; i++) { data[i] = static_cast<type>(bits >> i & 1); }
+        sort(data);
+        auto ones{static_cast<::std::size_t>(::std::popcount(bits))};
+        for(auto i{0zu}; i < n; i++)
+        {
+            if(data[i] != static_cast<type>(i >= n - ones)) { return false; }
+        }
+    }
+    return true;
+}
+
+// 随机输入排序后有序且元素的和不变
+template <typename type, ::std::size_t n>
+[[gnu::noinline]] bool test_random_impl(::std::size_t rounds) noexcept
+{
+    test_random next{};
+    for(auto round{0zu}; round < rounds; round++)
+    {
+        array<type, n> data{};
+        auto range{round % 2 == 0 ? 5ull : 1000ull};
+        double sum{};
+        for(auto& i : data)
+        {
+            i = static_cast<type>(next() % range);
+            if constexpr(signed_integral<type> || floating_point<type>) { i = static_cast<type>(i - static_cast<type>(range / 2)); }
+            sum += static_cast<double>(i);
+        }
+        sort(data);
+        for(auto i{0zu}; i < n; i++)
+        {
+            sum -= static_cast<double>(data[i]);
+            if(i != 0 && data[i] < data[i - 1]) { return false; }
+        }
+        if(sum != 0.0) { return false; }
+    }
+    return true;
+}
+
+template <typename type>
+bool test_type() noexcept
+{
+    auto ok{test_zero_one_impl<type, 1>() && test_zero_one_impl<type, 2>() && test_zero_one_impl<type, 3>()};
+    ok = ok && test_zero_one_impl<type, 4>() && test_zero_one_impl<type, 5>() && test_zero_one_impl<type, 7>();
+    ok = ok && test_zero_one_impl<type, 8>() && test_zero_one_impl<type, 11>() && test_zero_one_impl<type, 16>();
+    ok = ok && test_random_impl<type, 6>(500) && test_random_impl<type, 16>(500) && test_random_impl<type, 24>(500);
+    return ok && test_random_impl<type, 32>(500) && test_random_impl<type, 64>(200) && test_random_impl<type, 100>(50);
+}
+
+// 正负零不会丢失，不能向量化的元素以<比较
+[[gnu::noinline]] bool test_special_impl() noexcept
+{
+    array<float, 8> f32{0.0f, -0.0f, 1.0f, -0.0f, 0.0f, -1.0f, 0.0f, -0.0f};
+    sort(f32);
+    auto negative_zero{0zu};
+    for(auto i : f32) { negative_zero += i == 0.0f && ::std::bit_cast<::std::uint32_t>(i) != 0; }
+    auto ok{negative_zero == 3 && f32[0] == -1.0f && f32[7] == 1.0f};
+    struct pair
+    {
+        int key;
+        int value;
+
+        constexpr bool operator< (const pair& other) const noexcept { return key < other.key; }
+    };
+    array<pair, 12> pairs{};
+    for(auto i{0}; i < 12; i++) { pairs[i] = {(i * 5) % 12, i}; }
+    sort(pairs);
+    for(auto i{0}; i < 12; i++) { ok = ok && pairs[i].key == i && (pairs[i].value * 5) % 12 == i; }
+    return ok;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    array<int, 10> data{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    sort(data);
+    array<int, 10> expected{1, 1, 2, 3, 3, 4, 5, 5, 6, 9};
+    return data == expected && detail::array_sort_network<4>::comparators == 5 && detail::array_sort_network<8>::comparators == 19;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_array_sort)
+{
+    CPPFASTBOX_ASSERT(test_type<::std::uint8_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::int8_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::uint16_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::int16_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::uint32_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::int32_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::uint64_t>());
+    CPPFASTBOX_ASSERT(test_type<::std::int64_t>());
+    CPPFASTBOX_ASSERT(test_type<float>());
+    CPPFASTBOX_ASSERT(test_type<double>());
+    CPPFASTBOX_ASSERT(test_special_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_array_sort(); }
+#endif
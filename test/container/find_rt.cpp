@@ -0,0 +1,160 @@
+/**
+ * @file find_rt.cpp
+ * @brief find、count、mismatch和equal运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/container/algorithm.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 逐元素查找，作为参考实现
+template <typename type, typename predicate>
+::std::size_t reference_find(const type* data, ::std::size_t count, predicate pred) noexcept
+{
+    for(auto i{0zu}; i < count; i++)
+    {
+        if(pred(data[i])) { return i; }
+    }
+    return count;
+}
+
+// 逐元素统计，作为参考实现
+template <typename type, typename predicate>
+::std::size_t reference_count(const type* data, ::std::size_t count, predicate pred) noexcept
+{
+    ::std::size_t result{};
+    for(auto i{0zu}; i < count; i++) { result += pred(data[i]); }
+    return result;
+}
+
+/**
+ * @brief 以各种长度和起始位置与参考实现比较
+ *
+ * @note 元素取值范围很小，使匹配出现在向量的各个位置
+ */
+template <typename type>
+[[gnu::noinline]] bool test_impl(::std::size_t rounds) noexcept
+{
+    constexpr auto max_count{300zu};
+    type buffer[max_count + 8]{};
+    type other[max_count + 8]{};
+    test_random next{};
+    for(auto round{0zu}; round < rounds; round++)
+    {
+        auto size{static_cast<::std::size_t>(next() % max_count)};
+        auto begin{static_cast<::std::size_t>(next() % 8)};
+        auto range{round % 2 == 0 ? 4ull : 64ull};
+        for(auto& i : buffer) { i = static_cast<type>(next() % range); }
+        auto data{buffer + begin};
+        auto value{static_cast<type>(next() % range)};
+        auto is_equal{[value](type x) { return x == value; }};
+        auto is_less{[value](type x) { return x < value; }};
+        auto is_not_equal{[value](type x) { return x != value; }};
+        if(find(data, data + size, value) != data + reference_find(data, size, is_equal)) { return false; }
+        if(find_if(data, data + size, less_than(value)) != data + reference_find(data, size, is_less)) { return false; }
+        if(find_if(data, data + size, not_equal_to(value)) != data + reference_find(data, size, is_not_equal)) { return false; }
+        if(static_cast<::std::size_t>(count(data, data + size, value)) != reference_count(data, size, is_equal)) { return false; }
+        if(static_cast<::std::size_t>(count_if(data, data + size, less_than(value))) != reference_count(data, size, is_less)) { return false; }
+        auto is_greater{[value](type x) { return x >= value; }};
+        if(static_cast<::std::size_t>(count_if(data, data + size, greater_equal(value))) != reference_count(data, size, is_greater)) { return false; }
+        // 仅在一个随机位置不同
+        for(auto i{0zu}; i < size; i++) { other[i] = data[i]; }
+        auto position{size == 0 ? 0zu : static_cast<::std::size_t>(next() % (size + 1))};
+        if(position < size) { other[position] = static_cast<type>(other[position] + 1); }
+        auto [end_a, end_b]{mismatch(data, data + size, other)};
+        if(end_a != data + position || end_b != other + position) { return false; }
+        if(equal(data, data + size, other, other + size) != (position == size) || equal(data, data + size, other, other + size + 1)) { return false; }
+        if(mismatch(data, data + size, other, other + position).first != data + position) { return false; }
+        // 反向迭代器逐元素比较
+        ::std::reverse_iterator<type*> rbegin{data + size};
+        ::std::reverse_iterator<type*> rend{data};
+        auto last{rend};
+        for(auto i{rbegin}; i != rend; ++i)
+        {
+            if(*i == value)
+            {
+                last = i;
+                break;
+            }
+        }
+        if(::cppfastbox::find(rbegin, rend, value) != last) { return false; }
+    }
+    return true;
+}
+
+// 与元素的类型不同的值按寻常算术转换比较
+[[gnu::noinline]] bool test_convert_impl() noexcept
+{
+    ::std::uint8_t u8[100]{};
+    ::std::int8_t i8[100]{};
+    ::std::uint64_t u64[100]{};
+    float f32[100]{};
+    for(auto i{0zu}; i < 100; i++)
+    {
+        u8[i] = static_cast<::std::uint8_t>(i + 200);
+        i8[i] = static_cast<::std::int8_t>(i - 50);
+        u64[i] = i;
+        f32[i] = static_cast<float>(i) * 0.5f;
+    }
+    u64[70] = ~0ull;
+    auto ok{find(u8, u8 + 100, 300) == u8 + 100 && find(u8, u8 + 100, 255) == u8 + 55 && count(u8, u8 + 100, 44) == 0};
+    ok = ok && find(i8, i8 + 100, -1) == i8 + 49 && find(i8, i8 + 100, 206) == i8 + 100 && find(i8, i8 + 100, 1.0) == i8 + 51;
+    ok = ok && find(u64, u64 + 100, -1) == u64 + 70 && count(u64, u64 + 100, -1ll) == 1 && find(u64, u64 + 100, 2.5) == u64 + 100;
+    ok = ok && find(f32, f32 + 100, 3) == f32 + 6 && find(f32, f32 + 100, 0.1) == f32 + 100 && count(f32, f32 + 100, -0.0f) == 1;
+    constexpr auto nan{::std::numeric_limits<float>::quiet_NaN()};
+    f32[10] = nan;
+    ok = ok && find(f32, f32 + 100, nan) == f32 + 100 && count_if(f32, f32 + 100, not_equal_to(nan)) == 100;
+    ok = ok && count_if(f32, f32 + 100, less_than(nan)) == 0 && find_if(f32, f32 + 100, greater_equal(0.0f)) == f32;
+    ok = ok && mismatch(f32, f32 + 100, f32).first == f32 + 10 && !equal(f32, f32 + 100, f32);
+    int values[4]{};
+    const int* pointers[100]{};
+    pointers[99] = values + 2;
+    ok = ok && find(pointers, pointers + 100, values + 2) == pointers + 99 && count(pointers, pointers + 100, nullptr) == 99;
+    ok = ok && find_if(pointers, pointers + 100, greater_than(static_cast<const int*>(nullptr))) == pointers + 99;
+    return ok;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    int data[]{3, 1, 4, 1, 5, 9, 2, 6};
+    int other[]{3, 1, 4, 1, 5, 8, 2, 6};
+    auto ok{find(data, data + 8, 5) == data + 4 && find(data, data + 8, 7) == data + 8 && count(data, data + 8, 1) == 2};
+    ok = ok && find_if(data, data + 8, greater_than(4)) == data + 4 && count_if(data, data + 8, less_equal(3)) == 4;
+    ok = ok && mismatch(data, data + 8, other).first == data + 5 && !equal(data, data + 8, other) && equal(data, data + 5, other);
+    return ok && equal(data, data + 5, other, other + 5) && !equal(data, data + 5, other, other + 6);
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_find)
+{
+    CPPFASTBOX_ASSERT(test_impl<::std::uint8_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int8_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<char>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint16_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int16_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint32_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int32_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint64_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int64_t>(3000));
+    CPPFASTBOX_ASSERT(test_impl<float>(3000));
+    CPPFASTBOX_ASSERT(test_impl<double>(3000));
+    CPPFASTBOX_ASSERT(test_convert_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_find(); }
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file min_max_element_rt.cpp
+ * @brief min_element、max_element、minmax_element、reduce和dot运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/container/algorithm.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 逐元素查找最值，作为参考实现，与std::minmax_element的规则相同
+template <typename type>
+::std::pair<::std::size_t, ::std::size_t> reference_minmax(const type* data, ::std::size_t count) noexcept
+{
+    auto smallest{0zu};
+    auto largest{0zu};
+    for(auto i{1zu}; i < count; i++)
+    {
+        if(data[i] < data[smallest]) { smallest = i; }
+        if(!(data[i] < data[largest])) { largest = i; }
+    }
+    return {smallest, largest};
+}
+
+/**
+ * @brief 以各种长度和起始位置与参考实现比较
+ *
+ * @note 元素取值范围很小，使相等的最值出现在向量的各个位置；长度覆盖8位索引溢出的分块
+ */
+template <typename type>
+[[gnu::noinline]] bool test_impl(::std::size_t rounds) noexcept
+{
+    using wrap = ::std::conditional_t<integral<type>, fixed_size_integer_t<false, sizeof(type)>, type>;
+    constexpr auto max_count{1200zu};
+    static type buffer[max_count + 8]{};
+    static type other[max_count + 8]{};
+    test_random next{};
+    for(auto round{0zu}; round < rounds; round++)
+    {
+        auto size{static_cast<::std::size_t>(next() % (round % 4 == 0 ? max_count : 80))};
+        auto begin{static_cast<::std::size_t>(next() % 8)};
+        auto range{round % 2 == 0 ? 4ull : 100ull};
+        for(auto& i : buffer) { i = static_cast<type>(next() % range); }
+        for(auto& i : other) { i = static_cast<type>(next() % range); }
+        if constexpr(signed_integral<type> || floating_point<type>)
+        {
+            if(round % 3 == 0 && size != 0) { buffer[begin + next() % size] = ::std::numeric_limits<type>::lowest(); }
+        }
+        auto data{buffer + begin};
+        auto [smallest, largest]{minmax_element(data, data + size)};
+        if(size == 0)
+        {
+            if(min_element(data, data) != data || max_element(data, data) != data || smallest != data || largest != data) { return false; }
+        }
+        else
+        {
+            auto [expect_min, expect_max]{reference_minmax(data, size)};
+            auto first_max{0zu};
+            for(auto i{1zu}; i < size; i++) { first_max = data[first_max] < data[i] ? i : first_max; }
+            if(min_element(data, data + size) != data + expect_min || max_element(data, data + size) != data + first_max) { return false; }
+            if(smallest != data + expect_min || largest != data + expect_max) { return false; }
+        }
+        wrap sum{};
+        wrap product{};
+        for(auto i{0zu}; i < size; i++)
+        {
+            sum = static_cast<wrap>(sum + static_cast<wrap>(data[i]));
+            product = static_cast<wrap>(product + static_cast<wrap>(static_cast<wrap>(data[i]) * static_cast<wrap>(other[i])));
+        }
+        // 浮点数的元素是较小的整数，和是精确的
+        if(reduce(data, data + size) != static_cast<type>(sum) || dot(data, data + size, other) != static_cast<type>(product)) { return false; }
+        if(reduce(data, data + size, static_cast<type>(1)) != static_cast<type>(static_cast<wrap>(sum + 1))) { return false; }
+    }
+    return true;
+}
+
+// NaN、正负零、指针和非连续迭代器
+[[gnu::noinline]] bool test_special_impl() noexcept
+{
+    constexpr auto nan{::std::numeric_limits<double>::quiet_NaN()};
+    double f64[200]{};
+    for(auto i{0zu}; i < 200; i++) { f64[i] = static_cast<double>((i * 37) % 101); }
+    f64[30] = nan;
+    f64[150] = nan;
+    auto ok{*min_element(f64, f64 + 200) == 0.0 && min_element(f64, f64 + 200) == f64 && max_element(f64, f64 + 200) == f64 + 131};
+    ok = ok && minmax_element(f64, f64 + 200).second == f64 + 131 && minmax_element(f64, f64 + 200).first == f64;
+    f64[0] = nan;
+    ok = ok && min_element(f64, f64 + 200) == f64 && max_element(f64, f64 + 200) == f64 && minmax_element(f64, f64 + 200).second == f64;
+    float f32[100]{};
+    f32[40] = -0.0f;
+    f32[70] = -0.0f;
+    ok = ok && min_element(f32, f32 + 100) == f32 && minmax_element(f32, f32 + 100).second == f32 + 99;
+    f32[90] = -1.0f;
+    ok = ok && min_element(f32, f32 + 100) == f32 + 90 && max_element(f32, f32 + 100) == f32;
+    ok = ok && reduce(f32, f32 + 100) == -1.0f && reduce(f32, f32 + 100, 0.5) == -0.5 && dot(f32, f32 + 100, f32) == 1.0f;
+    int values[100]{};
+    const int* pointers[100]{};
+    for(auto i{0zu}; i < 100; i++) { pointers[i] = values + (i * 7) % 100; }
+    ok = ok && *min_element(pointers, pointers + 100) == values && *max_element(pointers, pointers + 100) == values + 99;
+    ::std::reverse_iterator<const int**> rbegin{pointers + 100};
+    ::std::reverse_iterator<const int**> rend{pointers};
+    ok = ok && *::cppfastbox::max_element(rbegin, rend) == values + 99 && ::cppfastbox::min_element(rbegin, rend) == rend - 1;
+    ::std::uint8_t u8[1000]{};
+    for(auto& i : u8) { i = 255; }
+    u8[999] = 254;
+    ok = ok && reduce(u8, u8 + 1000, 0ull) == 254999 && reduce(u8, u8 + 1000) == static_cast<::std::uint8_t>(254999);
+    return ok && min_element(u8, u8 + 1000) == u8 + 999 && max_element(u8, u8 + 1000) == u8 && minmax_element(u8, u8 + 1000).second == u8 + 998;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    int data[]{3, 1, 4, 1, 5, 9, 2, 9};
+    int other[]{1, 2, 1, 2, 1, 2, 1, 2};
+    auto ok{min_element(data, data + 8) == data + 1 && max_element(data, data + 8) == data + 5};
+    ok = ok && minmax_element(data, data + 8).first == data + 1 && minmax_element(data, data + 8).second == data + 7;
+    double f64[]{1.0, -0.5, 2.5};
+    ok = ok && reduce(data, data + 8) == 34 && reduce(data, data + 8, 1ll) == 35 && dot(data, data + 8, other) == 54;
+    return ok && reduce(f64, f64 + 3) == 3.0 && dot(f64, f64 + 3, f64) == 7.5;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_min_max_element)
+{
+    CPPFASTBOX_ASSERT(test_impl<::std::uint8_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int8_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<char>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint16_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int16_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint32_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int32_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint64_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int64_t>(2000));
+    CPPFASTBOX_ASSERT(test_impl<float>(2000));
+    CPPFASTBOX_ASSERT(test_impl<double>(2000));
+    CPPFASTBOX_ASSERT(test_special_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_min_max_element(); }
+#endif
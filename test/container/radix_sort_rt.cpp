@@ -0,0 +1,157 @@
+/**
+ * @file radix_sort_rt.cpp
+ * @brief radix_sort运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/container/algorithm.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 随机的元素，round决定取值范围，使部分轮的高位字节全部相同
+template <typename type>
+type random_element(test_random& next, ::std::size_t round) noexcept
+{
+    auto value{next() >> (round % 4 * 16)};
+    if constexpr(::std::same_as<type, uint128_t> || ::std::same_as<type, int128_t>)
+    {
+        return type{static_cast<decltype(type{}.hi)>(round % 2 == 0 ? next() : 0), value};
+    }
+    else if constexpr(sizeof(type) == 16) { return static_cast<type>(static_cast<type>(round % 2 == 0 ? next() : 0) << 64 | value); }
+    else if constexpr(floating_point<type>) { return static_cast<type>(static_cast<::std::int64_t>(value) >> 8); }
+    else { return static_cast<type>(value); }
+}
+
+/**
+ * @brief 排序后有序，且与逐位异或和相同
+ *
+ * @note 长度覆盖插入排序和基数排序
+ */
+template <typename type>
+[[gnu::noinline]] bool test_impl(::std::size_t rounds, ::std::size_t max_count) noexcept
+{
+    auto data{new type[max_count]};
+    test_random next{};
+    auto ok{true};
+    for(auto round{0zu}; round < rounds && ok; round++)
+    {
+        auto size{static_cast<::std::size_t>(next() % (round % 2 == 0 ? max_count : 40))};
+        ::std::uint64_t checksum[2]{};
+        auto update{[&checksum](const type& value) noexcept {
+            ::std::uint64_t bits[2]{};
+            __builtin_memcpy(bits, &value, sizeof(type));
+            checksum[0] ^= bits[0] * 0x9e3779b97f4a7c15;
+            checksum[1] ^= bits[1] * 0x9e3779b97f4a7c15;
+        }};
+        for(auto i{0zu}; i < size; i++)
+        {
+            data[i] = random_element<type>(next, round);
+            update(data[i]);
+        }
+        radix_sort(data, data + size);
+        for(auto i{0zu}; i < size; i++)
+        {
+            update(data[i]);
+            ok = ok && (i == 0 || !(data[i] < data[i - 1]));
+        }
+        ok = ok && checksum[0] == 0 && checksum[1] == 0;
+    }
+    delete[] data;
+    return ok;
+}
+
+// 浮点数的特殊值、投影的稳定性和调用者提供的缓冲区
+[[gnu::noinline]] bool test_special_impl() noexcept
+{
+    constexpr auto infinity{::std::numeric_limits<double>::infinity()};
+    double f64[100]{};
+    for(auto i{0zu}; i < 100; i++) { f64[i] = static_cast<double>(i % 10) - 5.0; }
+    f64[10] = -0.0;
+    f64[20] = 0.0;
+    f64[30] = infinity;
+    f64[40] = -infinity;
+    f64[50] = ::std::numeric_limits<double>::lowest();
+    f64[60] = ::std::numeric_limits<double>::denorm_min();
+    radix_sort(f64, f64 + 100);
+    auto ok{f64[0] == -infinity && f64[1] == ::std::numeric_limits<double>::lowest() && f64[99] == infinity};
+    auto negative_zero{0zu};
+    for(auto i{1zu}; i < 100; i++)
+    {
+        ok = ok && !(f64[i] < f64[i - 1]);
+        // 负零排在所有正零之前
+        if(::std::bit_cast<::std::uint64_t>(f64[i]) == ::std::bit_cast<::std::uint64_t>(-0.0)) { negative_zero = i; }
+        else if(f64[i] == 0.0) { ok = ok && negative_zero != 0; }
+    }
+    struct record
+    {
+        ::std::int16_t key;
+        ::std::uint32_t order;
+    };
+    record records[1000]{};
+    test_random next{};
+    for(auto i{0u}; i < 1000; i++) { records[i] = {static_cast<::std::int16_t>(static_cast<int>(next() % 50) - 25), i}; }
+    record scratch[1000];
+    radix_sort(records, records + 1000, scratch, &record::key);
+    for(auto i{1zu}; i < 1000; i++)
+    {
+        auto& a{records[i - 1]};
+        auto& b{records[i]};
+        ok = ok && (a.key < b.key || (a.key == b.key && a.order < b.order));
+    }
+    ::std::uint32_t reversed[500]{};
+    for(auto i{0u}; i < 500; i++) { reversed[i] = i; }
+    radix_sort(reversed, reversed + 500, [](::std::uint32_t x) noexcept { return ~x; });
+    for(auto i{0u}; i < 500; i++) { ok = ok && reversed[i] == 499 - i; }
+    return ok;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    ::std::int32_t data[100]{};
+    for(auto i{0}; i < 100; i++) { data[i] = (i * 37) % 100 - 50; }
+    radix_sort(data, data + 100);
+    auto ok{true};
+    for(auto i{0}; i < 100; i++) { ok = ok && data[i] == i - 50; }
+    float f32[]{2.5f, -1.0f, 0.0f, -3.0f};
+    radix_sort(f32, f32 + 4);
+    return ok && f32[0] == -3.0f && f32[3] == 2.5f;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_radix_sort)
+{
+    CPPFASTBOX_ASSERT(test_impl<::std::uint8_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int8_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint16_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int16_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint32_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int32_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint64_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int64_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<uint128_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<int128_t>(200, 3000));
+#ifdef __SIZEOF_INT128__
+    CPPFASTBOX_ASSERT(test_impl<native_uint128_t>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<native_int128_t>(200, 3000));
+#endif
+    CPPFASTBOX_ASSERT(test_impl<float>(200, 3000));
+    CPPFASTBOX_ASSERT(test_impl<double>(200, 3000));
+    CPPFASTBOX_ASSERT(test_special_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_radix_sort(); }
+#endif
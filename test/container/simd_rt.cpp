@@ -0,0 +1,215 @@
+/**
+ * @file simd_rt.cpp
+ * @brief simd运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/container/simd.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+/**
+ * @brief 随机的元素
+ *
+ * @note 浮点数取较小的整数，保证加法和乘法的结果是精确的
+ */
+template <typename type>
+type random_element(test_random& next) noexcept
+{
+    if constexpr(integral<type>) { return static_cast<type>(next() >> 3); }
+    else { return static_cast<type>(static_cast<int>(next() >> 40) % 2001 - 1000); }
+}
+
+/**
+ * @brief 所有运算与逐元素的标量运算比较
+ *
+ * @note 整数的运算以无符号数回绕，避免有符号溢出
+ */
+template <typename type, ::std::size_t n>
+[[gnu::noinline]] bool test_impl(::std::size_t count) noexcept
+{
+    using vector = simd<type, n>;
+    using wrap = ::std::conditional_t<integral<type>, fixed_size_integer_t<false, sizeof(type)>, type>;
+    using index_type = fixed_size_integer_t<true, sizeof(type)>;
+    test_random next{};
+    type buffer_a[n]{};
+    type buffer_b[n]{};
+    // 向左轮转一个元素的索引
+    index_type rotate_index[n]{};
+    for(auto j{0zu}; j < n; j++) { rotate_index[j] = static_cast<index_type>((j + 1) % n); }
+    for(auto i{0zu}; i < count; i++)
+    {
+        for(auto j{0zu}; j < n; j++)
+        {
+            buffer_a[j] = random_element<type>(next);
+            buffer_b[j] = j % 3 == 0 ? buffer_a[j] : random_element<type>(next);
+        }
+        auto a{vector::load(buffer_a)};
+        auto b{vector::load(buffer_b)};
+        auto sum{a + b};
+        auto difference{a - b};
+        auto product{a * b};
+        auto minimum{min(a, b)};
+        auto maximum{max(a, b)};
+        auto reversed{[&]<::std::size_t... index>(::std::index_sequence<index...>) { return shuffle<(n - 1 - index)...>(a); }(
+            ::std::make_index_sequence<n>{})};
+        auto rotated{permute(a, simd<index_type, n>::load(rotate_index))};
+        auto less{(a < b).to_bitmask()};
+        auto equal{(a == b).to_bitmask()};
+        auto greater_equal{(a >= b).to_bitmask()};
+        auto blended{blend(a < b, a, b)};
+        wrap total{};
+        auto smallest{buffer_a[0]};
+        auto largest{buffer_a[0]};
+        for(auto j{0zu}; j < n; j++)
+        {
+            auto x{buffer_a[j]};
+            auto y{buffer_b[j]};
+            if(sum[j] != static_cast<type>(static_cast<wrap>(x) + static_cast<wrap>(y))) { return false; }
+            if(difference[j] != static_cast<type>(static_cast<wrap>(x) - static_cast<wrap>(y))) { return false; }
+            if(product[j] != static_cast<type>(static_cast<wrap>(x) * static_cast<wrap>(y))) { return false; }
+            if(minimum[j] != (y < x ? y : x) || maximum[j] != (x < y ? y : x) || blended[j] != minimum[j]) { return false; }
+            if(reversed[j] != buffer_a[n - 1 - j] || rotated[j] != buffer_a[(j + 1) % n]) { return false; }
+            if((less >> j & 1) != (x < y) || (equal >> j & 1) != (x == y) || (greater_equal >> j & 1) != (x >= y)) { return false; }
+            total = static_cast<wrap>(total + static_cast<wrap>(x));
+            smallest = x < smallest ? x : smallest;
+            largest = largest < x ? x : largest;
+        }
+        if(reduce_add(a) != static_cast<type>(total) || reduce_min(a) != smallest || reduce_max(a) != largest) { return false; }
+        auto mask{a < b};
+        if(mask.any() != (less != 0) || mask.count() != static_cast<::std::size_t>(::std::popcount(less))) { return false; }
+        auto first{less == 0 ? n : static_cast<::std::size_t>(::std::countr_zero(less))};
+        if(mask.all() != (less == (~0ull >> (64 - n))) || mask.first_index() != first) { return false; }
+        if(simd_mask<type, n>::from_bitmask(less).to_bitmask() != less) { return false; }
+        if constexpr(integral<type>)
+        {
+            auto shift{static_cast<int>(next() % (sizeof(type) * 8))};
+            auto shifted{a << shift};
+            auto xored{a ^ b};
+            for(auto j{0zu}; j < n; j++)
+            {
+                if(shifted[j] != static_cast<type>(static_cast<wrap>(buffer_a[j]) << shift)) { return false; }
+                if(xored[j] != static_cast<type>(buffer_a[j] ^ buffer_b[j])) { return false; }
+            }
+            auto divisor{static_cast<type>(random_element<type>(next) >> (next() % (sizeof(type) * 8)))};
+            if(divisor == 0) { divisor = 1; }
+            if constexpr(signed_integral<type>)
+            {
+                if(divisor == -1) { divisor = 3; }
+            }
+            divider<type> d{divisor};
+            auto quotient{a / d};
+            auto remainder{a % d};
+            for(auto j{0zu}; j < n; j++)
+            {
+                if(quotient[j] != static_cast<type>(buffer_a[j] / divisor)) { return false; }
+                if(remainder[j] != static_cast<type>(buffer_a[j] % divisor)) { return false; }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 掩码读写只访问掩码为真的元素
+ *
+ * @note 被屏蔽的元素读取为0，写入时保持不变
+ */
+template <typename type, ::std::size_t n>
+[[gnu::noinline]] bool test_masked_impl() noexcept
+{
+    using vector = simd<type, n>;
+    struct alignas(64)
+    {
+        type data[n * 2];
+    } buffer{};
+    for(auto i{0zu}; i < n * 2; i++) { buffer.data[i] = static_cast<type>(i + 1); }
+    if((vector::load_aligned(buffer.data) != vector::load(buffer.data)).any()) { return false; }
+    test_random next{};
+    for(auto i{0zu}; i < 200; i++)
+    {
+        auto bits{next() & (~0ull >> (64 - n))};
+        auto mask{simd_mask<type, n>::from_bitmask(bits)};
+        auto offset{static_cast<::std::size_t>(next() % (n + 1))};
+        auto loaded{vector::load_masked(buffer.data + offset, mask)};
+        type target[n]{};
+        for(auto j{0zu}; j < n; j++) { target[j] = static_cast<type>(100); }
+        loaded.store_masked(target, mask);
+        for(auto j{0zu}; j < n; j++)
+        {
+            auto selected{(bits >> j & 1) != 0};
+            if(loaded[j] != (selected ? buffer.data[offset + j] : type{})) { return false; }
+            if(target[j] != (selected ? buffer.data[offset + j] : static_cast<type>(100))) { return false; }
+        }
+    }
+    vector{static_cast<type>(7)}.store_aligned(buffer.data);
+    return (vector::load(buffer.data) == vector{static_cast<type>(7)}).all();
+}
+
+/**
+ * @brief 测试不超过原生向量大小的各种宽度
+ *
+ * @note 更宽的simd在未启用对应指令集时按值传递的调用约定不同，gcc会给出-Wpsabi警告
+ */
+template <typename type>
+bool test_sizes(::std::size_t count) noexcept
+{
+    constexpr auto native{simd_native_lanes<type>};
+    auto ok{test_impl<type, native>(count) && test_impl<type, 1>(count) && test_impl<type, 2>(count) && test_masked_impl<type, 2>()};
+    if constexpr(cpu_flags::native_simd_max_size >= 16)
+    {
+        ok = ok && test_impl<type, 16 / sizeof(type)>(count) && test_masked_impl<type, 16 / sizeof(type)>();
+    }
+    if constexpr(cpu_flags::native_simd_max_size >= 32)
+    {
+        ok = ok && test_impl<type, 32 / sizeof(type)>(count) && test_masked_impl<type, 32 / sizeof(type)>();
+    }
+    if constexpr(cpu_flags::native_simd_max_size >= 64)
+    {
+        ok = ok && test_impl<type, 64 / sizeof(type)>(count) && test_masked_impl<type, 64 / sizeof(type)>();
+    }
+    return ok;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    using vector = simd<::std::int32_t, 4>;
+    vector a{vector::vector_type{3, -1, 4, 1}};
+    vector b{2};
+    auto ok{reduce_add(a) == 7 && reduce_min(a) == -1 && reduce_max(a) == 4 && reduce_add(a * b) == 14};
+    ok = ok && (a < b).to_bitmask() == 0b1010 && (a == a).all() && (a != a).none() && (a > b).count() == 2 && (a <= b).first_index() == 1;
+    ok = ok && reduce_add(min(a, b)) == 4 && reduce_add(max(a, b)) == 11 && shuffle<3, 2, 1, 0>(a)[0] == 1 && a.high()[0] == 4;
+    ok = ok && (simd_mask<float, 8>::from_bitmask(0x81).to_bitmask() == 0x81) && reduce_add(simd<double, 2>{0.5}) == 1.0;
+    return ok && vector::size() == 4 && (~vector{0})[2] == -1 && ((a << 1) >> 1)[1] == -1;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_simd)
+{
+    CPPFASTBOX_ASSERT(test_sizes<::std::uint8_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::int8_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::uint16_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::int16_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::uint32_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::int32_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::uint64_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<::std::int64_t>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<float>(2000));
+    CPPFASTBOX_ASSERT(test_sizes<double>(2000));
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_simd(); }
+#endif
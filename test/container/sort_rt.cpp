@@ -0,0 +1,191 @@
+/**
+ * @file sort_rt.cpp
+ * @brief sort运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include <limits>
+#include "../../include/container/algorithm.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 以相等的元素数判断两个范围互为排列，元素的取值范围很小
+template <typename type>
+bool same_elements(const type* a, const type* b, ::std::size_t count, ::std::size_t range) noexcept
+{
+    for(auto value{0zu}; value < range; value++)
+    {
+        auto count_a{0zu};
+        auto count_b{0zu};
+        for(auto i{0zu}; i < count; i++)
+        {
+            count_a += a[i] == static_cast<type>(value);
+            count_b += b[i] == static_cast<type>(value);
+        }
+        if(count_a != count_b) { return false; }
+    }
+    return true;
+}
+
+/**
+ * @brief 随机、有序、逆序、重复和锯齿形的输入排序后有序且元素不变
+ *
+ * @note 元素以取值范围较小的计数核对，较大的取值范围以逐位异或和核对
+ */
+template <typename type>
+[[gnu::noinline]] bool test_impl(::std::size_t rounds, ::std::size_t max_count) noexcept
+{
+    using bits = fixed_size_integer_t<false, sizeof(type)>;
+    auto data{new type[max_count]};
+    auto copy{new type[max_count]};
+    test_random next{};
+    auto ok{true};
+    for(auto round{0zu}; round < rounds && ok; round++)
+    {
+        auto size{static_cast<::std::size_t>(next() % max_count)};
+        auto range{round % 3 == 0 ? 5zu : 100zu};
+        auto pattern{round % 6};
+        for(auto i{0zu}; i < size; i++)
+        {
+            ::std::size_t value{};
+            if(pattern == 1) { value = i * range / (size + 1); }
+            else if(pattern == 2) { value = (size - i) * range / (size + 1); }
+            else if(pattern == 3) { value = 7; }
+            else if(pattern == 4) { value = (i < size / 2 ? i : size - i) % range; }
+            else { value = static_cast<::std::size_t>(next() % range); }
+            data[i] = static_cast<type>(value);
+            copy[i] = data[i];
+        }
+        if(round % 5 == 0 && size != 0)
+        {
+            if constexpr(!unsigned_integral<type>) { data[next() % size] = ::std::numeric_limits<type>::lowest(); }
+            data[next() % size] = ::std::numeric_limits<type>::max();
+            for(auto i{0zu}; i < size; i++) { copy[i] = data[i]; }
+        }
+        sort(data, data + size);
+        bits checksum{};
+        for(auto i{0zu}; i < size; i++)
+        {
+            checksum ^= ::std::bit_cast<bits>(data[i]) ^ ::std::bit_cast<bits>(copy[i]);
+            if(i != 0 && data[i] < data[i - 1]) { ok = false; }
+        }
+        ok = ok && checksum == 0 && same_elements(data, copy, size, range);
+    }
+    delete[] data;
+    delete[] copy;
+    return ok;
+}
+
+// 大的随机输入
+template <typename type>
+[[gnu::noinline]] bool test_large_impl(::std::size_t count) noexcept
+{
+    using bits = fixed_size_integer_t<false, sizeof(type)>;
+    auto data{new type[count]};
+    test_random next{};
+    bits checksum{};
+    for(auto i{0zu}; i < count; i++)
+    {
+        if constexpr(floating_point<type>) { data[i] = static_cast<type>(static_cast<::std::int64_t>(next()) >> 20); }
+        else { data[i] = static_cast<type>(next() >> 7); }
+        checksum ^= ::std::bit_cast<bits>(data[i]);
+    }
+    sort(data, data + count);
+    auto ok{true};
+    for(auto i{0zu}; i < count; i++)
+    {
+        checksum ^= ::std::bit_cast<bits>(data[i]);
+        if(i != 0 && data[i] < data[i - 1]) { ok = false; }
+    }
+    delete[] data;
+    return ok && checksum == 0;
+}
+
+// NaN、正负零、比较函数和不能向量化的元素
+[[gnu::noinline]] bool test_special_impl() noexcept
+{
+    constexpr auto nan{::std::numeric_limits<double>::quiet_NaN()};
+    double f64[500]{};
+    test_random next{};
+    for(auto& i : f64) { i = static_cast<double>(next() % 50) - 25.0; }
+    for(auto i{0zu}; i < 500; i += 7) { f64[i] = -0.0; }
+    f64[3] = nan;
+    f64[400] = -nan;
+    f64[499] = nan;
+    sort(f64, f64 + 500);
+    auto ok{f64[497] != f64[497] && f64[498] != f64[498] && f64[499] != f64[499]};
+    auto negative_zero{0zu};
+    for(auto i{0zu}; i < 497; i++)
+    {
+        negative_zero += ::std::bit_cast<::std::uint64_t>(f64[i]) == ::std::bit_cast<::std::uint64_t>(-0.0);
+        ok = ok && (i == 0 || !(f64[i] < f64[i - 1]));
+    }
+    ok = ok && negative_zero == 72;
+    int i32[300]{};
+    for(auto& i : i32) { i = static_cast<int>(next() % 1000); }
+    sort(i32, i32 + 300, ::std::ranges::greater{});
+    for(auto i{1zu}; i < 300; i++) { ok = ok && i32[i] <= i32[i - 1]; }
+    struct pair
+    {
+        int key;
+        int value;
+    };
+    auto key_less{[](const pair& a, const pair& b) noexcept { return a.key < b.key; }};
+    pair pairs[200]{};
+    for(auto i{0zu}; i < 200; i++) { pairs[i] = {static_cast<int>(next() % 20), static_cast<int>(i)}; }
+    sort(pairs, pairs + 200, key_less);
+    auto sum{0};
+    for(auto i{0zu}; i < 200; i++)
+    {
+        sum += pairs[i].value;
+        ok = ok && (i == 0 || !key_less(pairs[i], pairs[i - 1]));
+    }
+    return ok && sum == 199 * 100;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    int data[40]{};
+    for(auto i{0}; i < 40; i++) { data[i] = (i * 17) % 40; }
+    sort(data, data + 40);
+    auto ok{true};
+    for(auto i{0}; i < 40; i++) { ok = ok && data[i] == i; }
+    double f64[]{2.5, -1.0, 0.0, 3.0};
+    sort(f64, f64 + 4);
+    return ok && f64[0] == -1.0 && f64[3] == 3.0;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_sort)
+{
+    CPPFASTBOX_ASSERT(test_impl<::std::uint8_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int8_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint16_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int16_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint32_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int32_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::uint64_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<::std::int64_t>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<float>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_impl<double>(1000, 3000));
+    CPPFASTBOX_ASSERT(test_large_impl<::std::uint32_t>(1000000));
+    CPPFASTBOX_ASSERT(test_large_impl<::std::uint64_t>(1000000));
+    CPPFASTBOX_ASSERT(test_large_impl<double>(1000000));
+    CPPFASTBOX_ASSERT(test_special_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_sort(); }
+#endif
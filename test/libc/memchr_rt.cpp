@@ -0,0 +1,120 @@
+/**
+ * @file memchr_rt.cpp
+ * @brief memchr、memrchr、rawmemchr、strchr和strrchr运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/strchr.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+template <typename char_type>
+[[gnu::noinline]] bool test_mem_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto n{sizeof(buffer.data) / sizeof(char_type)};
+    constexpr auto page{4096 / sizeof(char_type)};
+    const char_type ch{static_cast<char_type>(0x7f)};
+    for(auto size{0zu}; size <= 160; size++)
+    {
+        // 从页内起始、页内任意位置和紧贴页边界处开始
+        for(auto begin : {0zu, 1zu, 3zu, 17zu, page - size})
+        {
+            auto* str{buffer.data + begin};
+            for(auto i{0zu}; i < n; i++) { buffer.data[i] = static_cast<char_type>(1); }
+            if(libc::memchr(str, ch, size) != nullptr || libc::memrchr(str, ch, size) != nullptr) { return false; }
+            for(auto pos{0zu}; pos < size; pos++)
+            {
+                str[pos] = ch;
+                if(libc::memchr(str, ch, size) != str + pos) { return false; }
+                if(libc::memrchr(str, ch, size) != str + pos) { return false; }
+                if(libc::rawmemchr(str, ch) != str + pos) { return false; }
+                // 范围之外的ch不应被找到
+                if(pos != 0 && libc::memchr(str, ch, pos) != nullptr) { return false; }
+                if(libc::memrchr(str + pos + 1, ch, size - pos - 1) != nullptr) { return false; }
+                str[pos] = static_cast<char_type>(1);
+            }
+            if(size >= 2)
+            {
+                str[0] = ch;
+                str[size - 1] = ch;
+                if(libc::memchr(str, ch, size) != str || libc::memrchr(str, ch, size) != str + size - 1) { return false; }
+            }
+        }
+    }
+    return true;
+}
+
+template <typename char_type>
+[[gnu::noinline]] bool test_str_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    const char_type ch{static_cast<char_type>(0x7f)};
+    for(auto size{0zu}; size <= 160; size++)
+    {
+        for(auto begin : {0zu, 1zu, 3zu, 17zu, page - size - 1})
+        {
+            auto* str{buffer.data + begin};
+            for(auto i{0zu}; i < size; i++) { str[i] = static_cast<char_type>(1); }
+            str[size] = char_type{};
+            // ch位于结束符之后时不应被找到
+            str[size + 1] = ch;
+            if(libc::strchr(str, ch) != nullptr || libc::strrchr(str, ch) != nullptr) { return false; }
+            if(libc::strchr(str, char_type{}) != str + size || libc::strrchr(str, char_type{}) != str + size) { return false; }
+            for(auto pos{0zu}; pos < size; pos++)
+            {
+                str[pos] = ch;
+                if(libc::strchr(str, ch) != str + pos || libc::strrchr(str, ch) != str + pos) { return false; }
+                str[0] = ch;
+                if(libc::strchr(str, ch) != str || libc::strrchr(str, ch) != str + pos) { return false; }
+                str[0] = static_cast<char_type>(1);
+                str[pos] = static_cast<char_type>(1);
+            }
+            str[size + 1] = char_type{};
+        }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"hello world"};
+    return libc::memchr(str, u8'o', 11) == str + 4 && libc::memrchr(str, u8'o', 11) == str + 7 && libc::rawmemchr(str, u8'd') == str + 10 &&
+           libc::strchr(str, u8'l') == str + 2 && libc::strrchr(str, u8'l') == str + 9 && libc::strchr(str, u8'x') == nullptr;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_memchr)
+{
+    CPPFASTBOX_ASSERT(test_mem_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_mem_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_mem_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_strchr)
+{
+    CPPFASTBOX_ASSERT(test_str_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_str_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_str_impl<char32_t>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_memchr();
+    test_strchr();
+}
+#endif
@@ -0,0 +1,55 @@
+/**
+ * @file memcmp_rt.cpp
+ * @brief memcmp、bcmp和mismatch_index运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/memcmp.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 两段内存分别位于页的结尾，用于检查读取是否越界
+alignas(4096) unsigned char test_buffer[4096 * 2];
+
+[[gnu::noinline]] bool test_memcmp_impl() noexcept
+{
+    for(auto size{0zu}; size <= 520; size += size < 160 ? 1 : 17)
+    {
+        auto* a{test_buffer + 4096 - size};
+        auto* b{test_buffer + 4096 * 2 - size};
+        for(auto i{0zu}; i < size; i++) { a[i] = b[i] = static_cast<unsigned char>(i * 7 + 1); }
+        if(libc::mismatch_index(a, b, size) != size || libc::memcmp(a, b, size) != 0 || libc::bcmp(a, b, size) != 0) { return false; }
+        for(auto pos{0zu}; pos < size; pos++)
+        {
+            // 最高位不同以检查按unsigned char比较
+            b[pos] ^= 0x80;
+            auto expect{a[pos] < b[pos] ? -1 : 1};
+            if(libc::mismatch_index(a, b, size) != pos) { return false; }
+            auto result{libc::memcmp(a, b, size)};
+            if((result < 0 ? -1 : 1) != expect || libc::memcmp(b, a, size) * result >= 0) { return false; }
+            if(libc::bcmp(a, b, size) == 0) { return false; }
+            // 之后的不同不影响结果
+            if(pos + 1 < size) { b[size - 1] ^= 1; }
+            if(libc::mismatch_index(a, b, size) != pos || libc::bcmp(a, b, size) == 0) { return false; }
+            if(pos + 1 < size) { b[size - 1] ^= 1; }
+            b[pos] ^= 0x80;
+        }
+    }
+    return true;
+}
+
+CPPFASTBOX_TEST(test_memcmp) { CPPFASTBOX_ASSERT(test_memcmp_impl()); }
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_memcmp(); }
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @file memcpy_rt.cpp
+ * @brief memcpy和memmove运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/memcpy.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+constexpr auto buffer_size{2048zu};
+
+struct test_buffer
+{
+    alignas(64) unsigned char data[buffer_size]{};
+    unsigned char expect[buffer_size]{};
+
+    // 用不重复的数据填充缓冲区
+    [[gnu::noinline]] void reset() noexcept
+    {
+        for(auto i{0zu}; i < buffer_size; i++) { data[i] = expect[i] = static_cast<unsigned char>(i * 7 + i / 256); }
+    }
+
+    // 逐字节地模拟memmove
+    [[gnu::noinline]] void move_expect(::std::size_t dest, ::std::size_t src, ::std::size_t size) noexcept
+    {
+        if(dest < src)
+        {
+            for(auto i{0zu}; i < size; i++) { expect[dest + i] = expect[src + i]; }
+        }
+        else
+        {
+            for(auto i{size}; i != 0; i--) { expect[dest + i - 1] = expect[src + i - 1]; }
+        }
+    }
+
+    [[gnu::noinline]] bool check() const noexcept { return __builtin_memcmp(data, expect, buffer_size) == 0; }
+};
+
+[[gnu::noinline]] bool test_memcpy_impl() noexcept
+{
+    static test_buffer buffer{};
+    for(auto size{0zu}; size <= 600; size += size < 160 ? 1 : 37)
+    {
+        for(auto dest : {0zu, 1zu, 7zu, 33zu})
+        {
+            for(auto src : {1024zu, 1025zu, 1031zu, 1087zu})
+            {
+                buffer.reset();
+                buffer.move_expect(dest, src, size);
+                if(libc::memcpy(buffer.data + dest, buffer.data + src, size) != buffer.data + dest || !buffer.check()) { return false; }
+            }
+        }
+    }
+    return true;
+}
+
+[[gnu::noinline]] bool test_memmove_impl() noexcept
+{
+    static test_buffer buffer{};
+    for(auto size{0zu}; size <= 600; size += size < 160 ? 1 : 37)
+    {
+        // 包含向前重叠、向后重叠和完全重合的情况
+        for(auto offset : {0zu, 1zu, 3zu, 16zu, 63zu, 64zu, 65zu, 300zu})
+        {
+            for(auto base : {100zu, 101zu, 128zu})
+            {
+                buffer.reset();
+                buffer.move_expect(base, base + offset, size);
+                if(libc::memmove(buffer.data + base, buffer.data + base + offset, size) != buffer.data + base || !buffer.check()) { return false; }
+                buffer.reset();
+                buffer.move_expect(base + offset, base, size);
+                if(libc::memmove(buffer.data + base + offset, buffer.data + base, size) != buffer.data + base + offset || !buffer.check())
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+[[gnu::noinline]] bool test_memcpy_large_impl() noexcept
+{
+    // 超过非临时存储阈值
+    auto size{libc::detail::nontemporal_threshold() + 4096 + 13};
+    auto src{new unsigned char[size + 64]{}};
+    auto dest{new unsigned char[size + 64]{}};
+    for(auto i{0zu}; i < size + 64; i++) { src[i] = static_cast<unsigned char>(i * 13 + i / 251); }
+    libc::memcpy(dest + 3, src + 5, size);
+    auto ok{dest[2] == 0 && dest[size + 3] == 0};
+    for(auto i{0zu}; i < size; i++) { ok = ok && dest[i + 3] == src[i + 5]; }
+    delete[] src;
+    delete[] dest;
+    return ok;
+}
+
+CPPFASTBOX_TEST(test_memcpy)
+{
+    CPPFASTBOX_ASSERT(test_memcpy_impl());
+    CPPFASTBOX_ASSERT(test_memcpy_large_impl());
+}
+
+CPPFASTBOX_TEST(test_memmove) { CPPFASTBOX_ASSERT(test_memmove_impl()); }
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_memcpy();
+    test_memmove();
+}
+#endif
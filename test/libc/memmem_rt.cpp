@@ -0,0 +1,131 @@
+/**
+ * @file memmem_rt.cpp
+ * @brief memmem和strstr运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/memmem.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 朴素查找，作为比较的基准
+template <typename char_type>
+const char_type* naive_memmem(const char_type* str, ::std::size_t count, const char_type* needle, ::std::size_t needle_count) noexcept
+{
+    for(auto i{0zu}; i + needle_count <= count; i++)
+    {
+        auto j{0zu};
+        while(j < needle_count && str[i + j] == needle[j]) { j++; }
+        if(j == needle_count) { return str + i; }
+    }
+    return nullptr;
+}
+
+template <typename char_type>
+[[gnu::noinline]] bool test_random_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    static test_buffer<char_type> needle_buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    test_random next{};
+    for(auto round{0zu}; round < 4000; round++)
+    {
+        auto count{next(300)};
+        auto needle_count{next(round % 4 == 0 ? 40 : 8)};
+        // 只生成少数几种字符以产生大量部分匹配
+        auto alphabet{next(3) + 1};
+        // 使str或needle的结尾紧贴页边界
+        auto* str{buffer.data + (round % 2 == 0 ? next(64) : page - count)};
+        auto* needle{needle_buffer.data + (round % 3 == 0 ? page - needle_count - 1 : next(64))};
+        for(auto i{0zu}; i < count; i++) { str[i] = static_cast<char_type>(0x61 + next(alphabet)); }
+        for(auto i{0zu}; i < needle_count; i++) { needle[i] = static_cast<char_type>(0x61 + next(alphabet)); }
+        needle[needle_count] = char_type{};
+        // 以一定概率在str中植入needle
+        if(needle_count <= count && next(2) == 0)
+        {
+            auto pos{next(count - needle_count + 1)};
+            for(auto i{0zu}; i < needle_count; i++) { str[pos + i] = needle[i]; }
+        }
+        auto expected{naive_memmem(str, count, needle, needle_count)};
+        if(libc::memmem(str, count, needle, needle_count) != expected) { return false; }
+        if(count < page - 64)
+        {
+            str[count] = char_type{};
+            if(libc::strstr(str, needle) != expected) { return false; }
+        }
+    }
+    return true;
+}
+
+// 验证开销过大时转为two-way算法
+template <typename char_type>
+[[gnu::noinline]] bool test_pathological_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    static test_buffer<char_type> needle_buffer{};
+    constexpr auto count{sizeof(buffer.data) / sizeof(char_type) - 1};
+    for(auto needle_count : {2zu, 3zu, 17zu, 100zu, 500zu})
+    {
+        auto* str{buffer.data};
+        auto* needle{needle_buffer.data};
+        for(auto i{0zu}; i < count; i++) { str[i] = static_cast<char_type>(0x61); }
+        str[count] = char_type{};
+        // aaa...aba...a，首尾字符处处匹配
+        for(auto i{0zu}; i < needle_count; i++) { needle[i] = static_cast<char_type>(0x61); }
+        needle[needle_count / 2] = static_cast<char_type>(0x62);
+        needle[needle_count] = char_type{};
+        if(libc::memmem(str, count, needle, needle_count) != nullptr || libc::strstr(str, needle) != nullptr) { return false; }
+        auto pos{count - needle_count - 7};
+        str[pos + needle_count / 2] = static_cast<char_type>(0x62);
+        if(libc::memmem(str, count, needle, needle_count) != str + pos || libc::strstr(str, needle) != str + pos) { return false; }
+        // 周期性的needle
+        for(auto i{0zu}; i < needle_count; i++) { needle[i] = static_cast<char_type>(0x61 + i % 2); }
+        auto expected{naive_memmem(str, count, needle, needle_count)};
+        if(libc::memmem(str, count, needle, needle_count) != expected || libc::strstr(str, needle) != expected) { return false; }
+        if(libc::detail::memmem_two_way(str, count, needle, needle_count) != expected) { return false; }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"hello world, hello there"};
+    return libc::strstr(str, u8"hello") == str && libc::strstr(str, u8"there") == str + 19 && libc::strstr(str, u8"xyz") == nullptr &&
+           libc::strstr(str, u8"") == str && libc::memmem(str, 24, u8"lo t", 4) == str + 16 &&
+           libc::detail::memmem_two_way(str, 24, u8"o w", 3) == str + 4;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_memmem_random)
+{
+    CPPFASTBOX_ASSERT(test_random_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_random_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_random_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_memmem_pathological)
+{
+    CPPFASTBOX_ASSERT(test_pathological_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_pathological_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_pathological_impl<char32_t>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_memmem_random();
+    test_memmem_pathological();
+}
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file memset_rt.cpp
+ * @brief memset、bzero和explicit_bzero运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/memset.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 检查[begin, begin + size)被填充为ch，且缓冲区其余部分保持为fill
+[[gnu::noinline]] bool check_buffer(const unsigned char* buffer,
+                                    ::std::size_t buffer_size,
+                                    ::std::size_t begin,
+                                    ::std::size_t size,
+                                    unsigned char ch,
+                                    unsigned char fill) noexcept
+{
+    for(auto i{0zu}; i < buffer_size; i++)
+    {
+        auto expect{i >= begin && i < begin + size ? ch : fill};
+        if(buffer[i] != expect) { return false; }
+    }
+    return true;
+}
+
+[[gnu::noinline]] bool test_memset_impl() noexcept
+{
+    constexpr auto buffer_size{1024zu};
+    alignas(64) static unsigned char buffer[buffer_size]{};
+    for(auto size{0zu}; size <= 700; size += size < 160 ? 1 : 29)
+    {
+        for(auto begin : {0zu, 1zu, 5zu, 31zu, 64zu, 100zu})
+        {
+            __builtin_memset(buffer, 0x5a, buffer_size);
+            if(libc::memset(buffer + begin, 0x1a5, size) != buffer + begin) { return false; }
+            if(!check_buffer(buffer, buffer_size, begin, size, 0xa5, 0x5a)) { return false; }
+            libc::bzero(buffer + begin, size);
+            if(!check_buffer(buffer, buffer_size, begin, size, 0, 0x5a)) { return false; }
+            libc::memset(buffer + begin, 0xff, size);
+            libc::explicit_bzero(buffer + begin, size);
+            if(!check_buffer(buffer, buffer_size, begin, size, 0, 0x5a)) { return false; }
+        }
+    }
+    return true;
+}
+
+[[gnu::noinline]] bool test_memset_large_impl() noexcept
+{
+    // 超过非临时存储阈值
+    auto size{libc::detail::nontemporal_threshold() + 4096 + 13};
+    auto buffer{new unsigned char[size + 64]{}};
+    libc::memset(buffer + 3, 0x3c, size);
+    auto ok{check_buffer(buffer, size + 64, 3, size, 0x3c, 0)};
+    delete[] buffer;
+    return ok;
+}
+
+CPPFASTBOX_TEST(test_memset)
+{
+    CPPFASTBOX_ASSERT(test_memset_impl());
+    CPPFASTBOX_ASSERT(test_memset_large_impl());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main() { test_memset(); }
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file strcmp_rt.cpp
+ * @brief strcmp和strncmp运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/strcmp.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+constexpr int sign(int value) noexcept
+{
+    return (value > 0) - (value < 0);
+}
+
+template <typename char_type>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    static test_buffer<char_type> buffer_a{};
+    static test_buffer<char_type> buffer_b{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    // 最高位为1的字符应大于普通字符
+    const char_type high{static_cast<char_type>(char_type{1} << (sizeof(char_type) * 8 - 1))};
+    for(auto size{0zu}; size <= 100; size++)
+    {
+        // a和b分别从页内起始、页内任意位置和使结束符紧贴页边界处开始
+        for(auto begin_a : {0zu, 5zu, page - size - 1})
+        {
+            for(auto begin_b : {0zu, 3zu, 33zu, page - size - 1})
+            {
+                auto* a{buffer_a.data + begin_a};
+                auto* b{buffer_b.data + begin_b};
+                for(auto i{0zu}; i < size; i++) { a[i] = b[i] = static_cast<char_type>(0x21 + i % 90); }
+                a[size] = b[size] = char_type{};
+                if(libc::strcmp(a, b) != 0 || libc::strncmp(a, b, size) != 0 || libc::strncmp(a, b, size + 10) != 0) { return false; }
+                for(auto pos{0zu}; pos < size; pos++)
+                {
+                    a[pos] = high;
+                    if(sign(libc::strcmp(a, b)) != 1 || sign(libc::strcmp(b, a)) != -1) { return false; }
+                    if(libc::strncmp(a, b, pos) != 0 || sign(libc::strncmp(b, a, pos + 1)) != -1) { return false; }
+                    // b在pos处提前结束
+                    a[pos] = b[pos];
+                    b[pos] = char_type{};
+                    if(sign(libc::strcmp(a, b)) != 1 || sign(libc::strncmp(b, a, size)) != -1) { return false; }
+                    b[pos] = a[pos];
+                }
+            }
+        }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t a[]{u8"hello world"};
+    constexpr char8_t b[]{u8"hello there"};
+    return libc::strcmp(a, a) == 0 && libc::strcmp(a, b) > 0 && libc::strcmp(b, a) < 0 && libc::strncmp(a, b, 6) == 0 &&
+           libc::strncmp(a, b, 7) > 0 && libc::strcmp(U"abc", U"abd") < 0;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_strcmp)
+{
+    CPPFASTBOX_ASSERT(test_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_impl<char32_t>());
+}
+
+// 单字节字符按unsigned char比较，宽字符按char_type本身的符号比较
+CPPFASTBOX_TEST(test_sign)
+{
+    static test_buffer<wchar_t> wide{};
+    wide.data[0] = static_cast<wchar_t>(-1);
+    wide.data[2] = 1;
+    CPPFASTBOX_ASSERT((libc::strcmp(wide.data, wide.data + 2) < 0) == (static_cast<wchar_t>(-1) < 1));
+    static test_buffer<char> narrow{};
+    narrow.data[0] = static_cast<char>(0x80);
+    narrow.data[2] = 'a';
+    CPPFASTBOX_ASSERT(libc::strcmp(narrow.data, narrow.data + 2) > 0);
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_strcmp();
+    test_sign();
+}
+#endif
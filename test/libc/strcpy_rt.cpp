@@ -0,0 +1,157 @@
+/**
+ * @file strcpy_rt.cpp
+ * @brief strcpy、stpcpy、strncpy和strlcpy运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/strcpy.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 写入目标之外的字符，用于检查越界写入
+template <typename char_type>
+constexpr inline char_type guard_char{static_cast<char_type>(0x7e)};
+
+template <typename char_type>
+constexpr char_type fill_char(::std::size_t i) noexcept
+{
+    return i % 3 == 0 ? static_cast<char_type>(char_type{1} << (sizeof(char_type) * 8 - 1)) : static_cast<char_type>(0x61 + i % 26);
+}
+
+/**
+ * @brief 检查dest的前expected_count个字符与expected相同，之后的字符未被写入
+ *
+ */
+template <typename char_type>
+[[gnu::noinline]] bool check_dest(const char_type* dest, const char_type* expected, ::std::size_t expected_count) noexcept
+{
+    for(auto i{0zu}; i < expected_count; i++)
+    {
+        if(dest[i] != expected[i]) { return false; }
+    }
+    for(auto i{expected_count}; i < expected_count + 80; i++)
+    {
+        if(dest[i] != guard_char<char_type>) { return false; }
+    }
+    return true;
+}
+
+/**
+ * @brief 以guard_char填充dest
+ *
+ * @return dest，编译器无法得知其指向的对象，避免对不可达的大块写入路径给出越界警告
+ */
+template <typename char_type>
+[[gnu::noinline]] char_type* reset_dest(char_type* dest) noexcept
+{
+    for(auto i{0zu}; i < 512; i++) { dest[i] = guard_char<char_type>; }
+    __asm__("" : "+r"(dest));
+    return dest;
+}
+
+/**
+ * @brief 源字符串从页内任意位置和使结束符紧贴页边界处开始，目标从任意偏移开始
+ *
+ */
+template <typename char_type>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    static char_type dest_buffer[600]{};
+    static char_type expected[600]{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    for(auto size{0zu}; size <= 300; size++)
+    {
+        for(auto begin : {0zu, 1zu, 5zu, 33zu, page - size - 1})
+        {
+            auto* src{buffer.data + begin};
+            for(auto i{0zu}; i < size; i++) { src[i] = fill_char<char_type>(i); }
+            src[size] = char_type{};
+            auto* dest{reset_dest(dest_buffer + size % 7)};
+            if(libc::stpcpy(dest, src) != dest + size || !check_dest(dest, src, size + 1)) { return false; }
+            dest = reset_dest(dest);
+            if(libc::strcpy(dest, src) != dest || !check_dest(dest, src, size + 1)) { return false; }
+            for(auto count : {0zu, 1zu, size / 2, size, size + 1, size + 70})
+            {
+                // strncpy拷贝前count个字符，不足时以0填充
+                for(auto i{0zu}; i < count; i++) { expected[i] = i < size ? src[i] : char_type{}; }
+                dest = reset_dest(dest);
+                if(libc::strncpy(dest, src, count) != dest || !check_dest(dest, expected, count)) { return false; }
+                // strlcpy最多拷贝count - 1个字符并以0结尾
+                auto copied{count == 0 ? 0 : (size < count ? size : count - 1)};
+                for(auto i{0zu}; i < copied; i++) { expected[i] = src[i]; }
+                expected[copied] = char_type{};
+                dest = reset_dest(dest);
+                if(libc::strlcpy(dest, src, count) != size || !check_dest(dest, expected, count == 0 ? 0 : copied + 1)) { return false; }
+            }
+            src[size] = fill_char<char_type>(size);
+        }
+    }
+    return true;
+}
+
+// 没有结束符的字符串紧贴页边界，strncpy不应读取之后的页
+template <typename char_type>
+[[gnu::noinline]] bool test_strncpy_bound_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    static char_type dest_buffer[600]{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    for(auto i{0zu}; i < page; i++) { buffer.data[i] = fill_char<char_type>(i); }
+    for(auto size{0zu}; size <= 300; size++)
+    {
+        auto* src{buffer.data + page - size};
+        auto* dest{reset_dest(dest_buffer)};
+        if(libc::strncpy(dest, src, size) != dest || !check_dest(dest, src, size)) { return false; }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"hello world"};
+    char8_t dest[16]{};
+    char32_t wdest[8]{};
+    auto* end{libc::stpcpy(dest, str)};
+    auto ok{end == dest + 11 && dest[10] == u8'd' && dest[11] == 0};
+    libc::strncpy(dest, u8"ab", 5);
+    ok = ok && dest[1] == u8'b' && dest[2] == 0 && dest[4] == 0 && dest[5] == u8' ';
+    ok = ok && libc::strlcpy(dest, str, 4) == 11 && dest[2] == u8'l' && dest[3] == 0;
+    ok = ok && libc::strcpy(wdest, U"中文") == wdest && wdest[1] == U'文' && wdest[2] == 0;
+    return ok;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_strcpy)
+{
+    CPPFASTBOX_ASSERT(test_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_strncpy_bound)
+{
+    CPPFASTBOX_ASSERT(test_strncpy_bound_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_strncpy_bound_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_strncpy_bound_impl<char32_t>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_strcpy();
+    test_strncpy_bound();
+}
+#endif
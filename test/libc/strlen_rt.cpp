@@ -0,0 +1,99 @@
+/**
+ * @file strlen_rt.cpp
+ * @brief strlen和strnlen运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/strlen.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 交替使用仅最高位为1的字符和普通字符填充，前者曾使字级标量实现误判
+template <typename char_type>
+constexpr char_type fill_char(::std::size_t i) noexcept
+{
+    return i % 3 == 0 ? static_cast<char_type>(char_type{1} << (sizeof(char_type) * 8 - 1)) : static_cast<char_type>(0x61 + i % 26);
+}
+
+template <typename char_type>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    for(auto size{0zu}; size <= 160; size++)
+    {
+        // 从页内起始、页内任意位置和使结束符紧贴页边界处开始
+        for(auto begin : {0zu, 1zu, 3zu, 17zu, page - size - 1})
+        {
+            auto* str{buffer.data + begin};
+            for(auto i{0zu}; i < size; i++) { str[i] = fill_char<char_type>(i); }
+            str[size] = char_type{};
+            if(libc::strlen(str) != size || libc::detail::strlen_scalar(str) != size) { return false; }
+            for(auto maxlen : {0zu, 1zu, size / 2, size, size + 1, size + 100})
+            {
+                auto expected{maxlen < size ? maxlen : size};
+                if(libc::strnlen(str, maxlen) != expected || libc::detail::strnlen_scalar(str, maxlen) != expected) { return false; }
+            }
+            str[size] = fill_char<char_type>(size);
+        }
+    }
+    return true;
+}
+
+// 没有结束符的字符串紧贴页边界，strnlen不应读取之后的页
+template <typename char_type>
+[[gnu::noinline]] bool test_strnlen_bound_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    for(auto i{0zu}; i < page; i++) { buffer.data[i] = fill_char<char_type>(i); }
+    for(auto size{0zu}; size <= 160; size++)
+    {
+        auto* str{buffer.data + page - size};
+        if(libc::strnlen(str, size) != size) { return false; }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"hello world"};
+    constexpr char32_t wstr[]{U"hello"};
+    return libc::strlen(str) == 11 && libc::strlen(wstr) == 5 && libc::strnlen(str, 5) == 5 && libc::strnlen(str, 20) == 11 &&
+           libc::strnlen(wstr, 0) == 0;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_strlen)
+{
+    CPPFASTBOX_ASSERT(test_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_strnlen_bound)
+{
+    CPPFASTBOX_ASSERT(test_strnlen_bound_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_strnlen_bound_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_strnlen_bound_impl<char32_t>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_strlen();
+    test_strnlen_bound();
+}
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file strspn_rt.cpp
+ * @brief strspn、strcspn和strpbrk运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/strspn.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 逐字符比较的strspn和strcspn，作为比较的基准
+template <bool stop_in_set, typename char_type>
+::std::size_t naive_span(const char_type* str, const char_type* set) noexcept
+{
+    auto i{0zu};
+    for(; str[i] != char_type{}; i++)
+    {
+        auto found{false};
+        for(auto* ptr{set}; *ptr != char_type{}; ptr++) { found |= *ptr == str[i]; }
+        if(found == stop_in_set) { break; }
+    }
+    return i;
+}
+
+/**
+ * @brief 字符集包含1到20个字符，其中部分字符集跨越超过8种不同的行
+ *
+ * @note 字符串从页内任意位置和使结束符紧贴页边界处开始，并包含最高位为1的字符
+ */
+template <typename char_type>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    test_random next{};
+    for(auto round{0zu}; round < 3000; round++)
+    {
+        char_type set[21]{};
+        auto set_count{next(20) + 1};
+        // 大部分字符集只包含ascii标点等少数几行，其余的字符集包含任意字符
+        auto wide_set{round % 4 == 0};
+        for(auto i{0zu}; i < set_count; i++)
+        {
+            set[i] = static_cast<char_type>(wide_set ? next(255) + 1 : 0x20 + next(32));
+            if constexpr(sizeof(char_type) != 1)
+            {
+                if(round % 8 == 0) { set[i] = static_cast<char_type>(set[i] + 0x100 * next(3)); }
+            }
+        }
+        auto count{next(300)};
+        auto* str{buffer.data + (round % 2 == 0 ? next(64) : page - count - 1)};
+        // 以一定概率只使用字符集中的字符，产生较长的前缀
+        auto from_set{next(2) == 0};
+        for(auto i{0zu}; i < count; i++)
+        {
+            str[i] = from_set && next(64) != 0 ? set[next(set_count)] : static_cast<char_type>(next(255) + 1);
+        }
+        str[count] = char_type{};
+        auto span{naive_span<false>(str, set)};
+        auto cspan{naive_span<true>(str, set)};
+        if(libc::strspn(str, set) != span || libc::detail::strspn_scalar(str, set) != span) { return false; }
+        if(libc::strcspn(str, set) != cspan || libc::detail::strcspn_scalar(str, set) != cspan) { return false; }
+        if(libc::strpbrk(str, set) != (cspan == count ? nullptr : str + cspan)) { return false; }
+    }
+    return true;
+}
+
+// 空字符集与空字符串
+template <typename char_type>
+[[gnu::noinline]] bool test_empty_impl() noexcept
+{
+    static test_buffer<char_type> buffer{};
+    constexpr auto page{4096 / sizeof(char_type)};
+    const char_type empty[1]{};
+    const char_type set[]{0x61, 0x62, 0};
+    for(auto size{0zu}; size <= 100; size++)
+    {
+        auto* str{buffer.data + page - size - 1};
+        for(auto i{0zu}; i < size; i++) { str[i] = static_cast<char_type>(0x61); }
+        str[size] = char_type{};
+        if(libc::strspn(str, empty) != 0 || libc::strcspn(str, empty) != size || libc::strpbrk(str, empty) != nullptr) { return false; }
+        if(libc::strspn(str, set) != size || libc::strcspn(str, set) != 0) { return false; }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"key = value; next"};
+    return libc::strspn(str, u8"aeky") == 3 && libc::strcspn(str, u8"=;") == 4 && libc::strcspn(str, u8"") == 17 &&
+           libc::strpbrk(str, u8";") == str + 11 && libc::strpbrk(str, u8"#") == nullptr && libc::strspn(U"中文abc", U"文中") == 2;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_strspn)
+{
+    CPPFASTBOX_ASSERT(test_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_strspn_empty)
+{
+    CPPFASTBOX_ASSERT(test_empty_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_empty_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_empty_impl<char32_t>());
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_strspn();
+    test_strspn_empty();
+}
+#endif
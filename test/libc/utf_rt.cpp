@@ -0,0 +1,151 @@
+/**
+ * @file utf_rt.cpp
+ * @brief utf_validate、utf_convert和utf_convert_length运行时测试
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#include "../../include/libc/utf.h"
+#include "../test_utility.h"
+#ifdef CPPFASTBOX_HOSTED_TEST
+    #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+    #include <doctest/doctest.h>
+    #define CPPFASTBOX_ASSERT CHECK
+    #define CPPFASTBOX_TEST(name) TEST_CASE(#name)
+#else
+    #include "../../include/libc/assert.h"
+    #define CPPFASTBOX_ASSERT always_assert
+    #define CPPFASTBOX_TEST(name) void name() noexcept
+#endif
+using namespace cppfastbox;
+
+// 生成合法的码点，大部分为ascii
+inline char32_t next_code_point(test_random& next, bool ascii) noexcept
+{
+    if(ascii || next(4) != 0) { return static_cast<char32_t>(next(0x80)); }
+    switch(next(4))
+    {
+        case 0: return static_cast<char32_t>(0x80 + next(0x780));
+        case 1: return static_cast<char32_t>(0x800 + next(0xd000));
+        case 2: return static_cast<char32_t>(0xe000 + next(0x2000));
+        default: return static_cast<char32_t>(0x10000 + next(0x100000));
+    }
+}
+
+/**
+ * @brief 在每种编码中随机生成合法的字符串并随机破坏，与标量实现比较
+ *
+ * @note 部分字符串全为ascii，字符串从页内任意位置和使结尾紧贴页边界处开始
+ */
+template <typename src_char, typename dest_char>
+[[gnu::noinline]] bool test_impl() noexcept
+{
+    static test_buffer<src_char> buffer{};
+    // 输出最多为输入一页的3倍
+    static dest_char output[8192]{};
+    static dest_char expected[8192]{};
+    constexpr auto page{4096 / sizeof(src_char)};
+    test_random next{};
+    for(auto round{0zu}; round < 1000; round++)
+    {
+        // 生成足够长的字符串以跨越utf8_chunk_size
+        src_char str[4096]{};
+        auto count{0zu};
+        auto code_points{round % 16 == 0 ? 700 + next(300) : next(200)};
+        auto ascii{round % 3 == 0};
+        for(auto i{0zu}; i < code_points; i++) { count += libc::detail::utf_encode(next_code_point(next, ascii), str + count); }
+        if(count > page) { count = page; }
+        // 替换为随机的编码单元或截断，可能产生非法的字符串
+        if(round % 2 == 0 && count != 0)
+        {
+            auto unit{sizeof(src_char) == 1 ? next(0x100) : (sizeof(src_char) == 2 ? 0xd800 + next(0x800) : 0x10f000 + next(0x2000))};
+            str[next(count)] = static_cast<src_char>(unit);
+        }
+        if(round % 5 == 0 && count != 0) { count -= 1; }
+        auto* src{buffer.data + (round % 2 == 0 ? next(64) : page - count)};
+        for(auto i{0zu}; i < count; i++) { src[i] = str[i]; }
+        auto [valid, position]{libc::detail::utf_convert_scalar(src, count, static_cast<void*>(nullptr))};
+        auto validate{libc::utf_validate(src, count)};
+        if(validate.valid != valid || validate.count != position) { return false; }
+        auto scalar{libc::detail::utf_convert_scalar(src, count, expected)};
+        auto result{libc::utf_convert(src, count, output)};
+        if(result.valid != scalar.valid || result.count != scalar.count) { return false; }
+        if(!valid) { continue; }
+        if(libc::utf_convert_length<dest_char>(src, count) != scalar.count) { return false; }
+        for(auto i{0zu}; i < scalar.count; i++)
+        {
+            if(output[i] != expected[i]) { return false; }
+        }
+    }
+    return true;
+}
+
+template <typename src_char>
+bool test_all_impl() noexcept
+{
+    return test_impl<src_char, char8_t>() && test_impl<src_char, char16_t>() && test_impl<src_char, char32_t>();
+}
+
+// 检查非法的utf-8，str的前缀为ascii以使非法的部分位于向量的不同位置
+[[gnu::noinline]] bool test_invalid_utf8_impl(const char8_t* bad, ::std::size_t bad_count, bool valid) noexcept
+{
+    static test_buffer<char8_t> buffer{};
+    for(auto prefix{0zu}; prefix < 140; prefix++)
+    {
+        auto* str{buffer.data + 4096 - prefix - bad_count};
+        for(auto i{0zu}; i < prefix; i++) { str[i] = u8'a'; }
+        for(auto i{0zu}; i < bad_count; i++) { str[prefix + i] = bad[i]; }
+        auto result{libc::utf_validate(str, prefix + bad_count)};
+        if(result.valid != valid || result.count != (valid ? prefix + bad_count : prefix)) { return false; }
+    }
+    return true;
+}
+
+consteval bool test_constexpr() noexcept
+{
+    constexpr char8_t str[]{u8"a中\U0001f600"};
+    char16_t utf16[8]{};
+    char32_t utf32[8]{};
+    auto to_utf16{libc::utf_convert(str, 8, utf16)};
+    auto to_utf32{libc::utf_convert(utf16, to_utf16.count, utf32)};
+    return to_utf16.valid && to_utf16.count == 4 && utf16[2] == 0xd83d && utf16[3] == 0xde00 && to_utf32.valid && to_utf32.count == 3 &&
+           utf32[1] == U'中' && libc::utf_convert_length<char8_t>(utf32, 3) == 8 && libc::utf_validate(u8"\xed\xa0\x80", 3).count == 0 &&
+           !libc::utf_validate(u"a\xdc00", 2).valid;
+}
+
+static_assert(test_constexpr());
+
+CPPFASTBOX_TEST(test_utf)
+{
+    CPPFASTBOX_ASSERT(test_all_impl<char8_t>());
+    CPPFASTBOX_ASSERT(test_all_impl<char16_t>());
+    CPPFASTBOX_ASSERT(test_all_impl<char32_t>());
+}
+
+CPPFASTBOX_TEST(test_utf8_invalid)
+{
+    // 过长的编码
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xc0\x80", 2, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xe0\x9f\xbf", 3, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xf0\x8f\xbf\xbf", 4, false));
+    // 代理码点和超过U+10FFFF的码点
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xed\xa0\x80", 3, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xf4\x90\x80\x80", 4, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xf5\x80\x80\x80", 4, false));
+    // 截断的码点和多余的后续字节
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xe4\xb8", 2, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xf0\x9f\x98", 3, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\x80", 1, false));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xe4\xb8" "a", 3, false));
+    // 边界上合法的码点
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xed\x9f\xbf\xee\x80\x80", 6, true));
+    CPPFASTBOX_ASSERT(test_invalid_utf8_impl(u8"\xf4\x8f\xbf\xbf\xc2\x80", 6, true));
+}
+
+#ifndef CPPFASTBOX_HOSTED_TEST
+int main()
+{
+    test_utf();
+    test_utf8_invalid();
+}
+#endif
@@ -0,0 +1,32 @@
+/**
+ * @file test_utility.h
+ * @brief 运行时测试共用的辅助设施
+ *
+ * @copyright Copyright (c) 2024-present Trajectronix Open Source Group
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// 足够容纳所有测试用例，并使部分测试用例的结尾紧贴页边界
+template <typename char_type>
+struct alignas(4096) test_buffer
+{
+    char_type data[8192 / sizeof(char_type)]{};
+};
+
+// 线性同余生成器
+struct test_random
+{
+    ::std::uint64_t state{1};
+
+    ::std::uint64_t operator() () noexcept
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        return state;
+    }
+
+    // 生成[0, bound)内的随机数
+    ::std::size_t operator() (::std::size_t bound) noexcept { return static_cast<::std::size_t>((*this)() >> 33) % bound; }
+};